@@ -4,4 +4,11 @@
 const float PI = 3.14159265359;
 const float MAX_REFLECTION_LOD = 4.0;
 
+// Tangent-space normal from a normal map texel. Z is rebuilt from X and Y, so
+// two-channel (BC5) maps, whose blue channel samples as 0, decode correctly.
+vec3 unpack_normal(vec4 texel) {
+    vec2 xy = texel.rg * 2.0 - 1.0;
+    return vec3(xy, sqrt(max(0.0, 1.0 - dot(xy, xy))));
+}
+
 #endif
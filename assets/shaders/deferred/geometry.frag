@@ -54,8 +54,15 @@ vec2 encodeOctahedron(vec3 n) {
     return n.xy * 0.5 + 0.5;
 }
 
+// Tangent-space normal from a normal map texel. Z is rebuilt from X and Y, so
+// two-channel (BC5) maps, whose blue channel samples as 0, decode correctly.
+vec3 unpack_normal(vec4 texel) {
+    vec2 xy = texel.rg * 2.0 - 1.0;
+    return vec3(xy, sqrt(max(0.0, 1.0 - dot(xy, xy))));
+}
+
 vec3 getNormalFromMap() {
-    vec3 tangentNormal = texture(u_NormalMap, fs_in.TexCoord).rgb * 2.0 - 1.0;
+    vec3 tangentNormal = unpack_normal(texture(u_NormalMap, fs_in.TexCoord));
     
     vec3 N = normalize(fs_in.Normal);
     vec3 T = normalize(fs_in.Tangent.xyz);
@@ -120,7 +120,7 @@ void main() {
     // Normal
     vec3 N;
     if (u_use_normal_map) {
-        N = texture(u_normal_map, scaled_uv).rgb * 2.0 - 1.0;
+        N = unpack_normal(texture(u_normal_map, scaled_uv));
         N = normalize(v_TBN * N);
     } else {
         N = normalize(v_TBN[2]);
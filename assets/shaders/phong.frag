@@ -130,6 +130,13 @@ vec3 calculate_point_light(PointLight light, vec3 normal, vec3 frag_pos, vec3 vi
     return (diffuse + specular) * attenuation;
 }
 
+// Tangent-space normal from a normal map texel. Z is rebuilt from X and Y, so
+// two-channel (BC5) maps, whose blue channel samples as 0, decode correctly.
+vec3 unpack_normal(vec4 texel) {
+    vec2 xy = texel.rg * 2.0 - 1.0;
+    return vec3(xy, sqrt(max(0.0, 1.0 - dot(xy, xy))));
+}
+
 void main() {
     // Texture Color
     vec4 tex_color = texture(u_diffuse_map, v_texcoord);
@@ -141,8 +148,7 @@ void main() {
     vec3 norm;
     if (u_use_normal_map) {
         // Sample normal map (stored in tangent space, [0,1] -> [-1,1])
-        norm = texture(u_normal_map, v_texcoord).rgb;
-        norm = norm * 2.0 - 1.0; // Transform to [-1, 1]
+        norm = unpack_normal(texture(u_normal_map, v_texcoord));
         norm = normalize(v_TBN * norm); // Transform to world space
     } else {
         // Use geometric normal (third column of TBN)
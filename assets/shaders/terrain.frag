@@ -118,10 +118,10 @@ void main() {
     vec3 N = normalize(v_normal);
     
     if (u_use_normal_maps) {
-        vec3 n0 = texture(u_normal0, v_texcoord).rgb * 2.0 - 1.0;
-        vec3 n1 = texture(u_normal1, v_texcoord).rgb * 2.0 - 1.0;
-        vec3 n2 = texture(u_normal2, v_texcoord).rgb * 2.0 - 1.0;
-        vec3 n3 = texture(u_normal3, v_texcoord).rgb * 2.0 - 1.0;
+        vec3 n0 = unpack_normal(texture(u_normal0, v_texcoord));
+        vec3 n1 = unpack_normal(texture(u_normal1, v_texcoord));
+        vec3 n2 = unpack_normal(texture(u_normal2, v_texcoord));
+        vec3 n3 = unpack_normal(texture(u_normal3, v_texcoord));
         
         vec3 blended_normal = n0 * splat.r + n1 * splat.g + n2 * splat.b + n3 * splat.a;
         
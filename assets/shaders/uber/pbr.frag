@@ -29,6 +29,13 @@
 const float MAX_REFLECTION_LOD = 4.0;
 const float DIELECTRIC_F0 = 0.04;
 
+// Tangent-space normal from a normal map texel. Z is rebuilt from X and Y, so
+// two-channel (BC5) maps, whose blue channel samples as 0, decode correctly.
+vec3 unpack_normal(vec4 texel) {
+    vec2 xy = texel.rg * 2.0 - 1.0;
+    return vec3(xy, sqrt(max(0.0, 1.0 - dot(xy, xy))));
+}
+
 // =============================================================================
 // INPUTS
 // =============================================================================
@@ -269,7 +276,7 @@ vec3 GetNormal() {
     vec3 N = normalize(fs_in.Normal);
     
     if ((u_MaterialFlags & MAT_HAS_NORMAL) != 0) {
-        vec3 tangentNormal = texture(u_NormalMap, fs_in.TexCoord * u_UVScale).rgb * 2.0 - 1.0;
+        vec3 tangentNormal = unpack_normal(texture(u_NormalMap, fs_in.TexCoord * u_UVScale));
         
         vec3 T = normalize(fs_in.Tangent);
         vec3 B = normalize(fs_in.Bitangent);
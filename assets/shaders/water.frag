@@ -9,6 +9,7 @@ in vec3 v_to_camera;
 
 #include "common/camera.glsl"
 #include "common/scene_data.glsl"
+#include "common/math.glsl"
 
 // Water textures
 uniform sampler2D u_reflection_texture;  // Reflection of scene
@@ -74,8 +75,8 @@ void main() {
     
     // Sample normal map for lighting
     vec2 normal_coords = distorted_texcoords * 0.5;
-    vec4 normal_sample = texture(u_normal_map, normal_coords);
-    vec3 normal = normalize(vec3(normal_sample.r * 2.0 - 1.0, normal_sample.b * 3.0, normal_sample.g * 2.0 - 1.0));
+    vec3 normal_sample = unpack_normal(texture(u_normal_map, normal_coords));
+    vec3 normal = normalize(vec3(normal_sample.x, (normal_sample.z * 0.5 + 0.5) * 3.0, normal_sample.y));
     
     // Fresnel effect - more reflection at grazing angles
     vec3 view_dir = normalize(v_to_camera);
@@ -0,0 +1,81 @@
+/**
+ * @file bench_animation.cpp
+ * @brief Benchmarks for skeletal animation sampling
+ */
+
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/animation/skeleton.hpp>
+
+using namespace hz;
+
+namespace {
+
+constexpr u32 BONE_COUNT = 64; // Typical humanoid rig
+constexpr u32 KEY_COUNT = 30;  // One second at 30 Hz
+constexpr float DURATION = 1.0f;
+
+BoneAnimation make_channel(const std::string& bone_name, i32 bone_id) {
+    BoneAnimation channel;
+    channel.bone_name = bone_name;
+    channel.bone_id = bone_id;
+    for (u32 k = 0; k < KEY_COUNT; ++k) {
+        const float time = DURATION * static_cast<float>(k) / static_cast<float>(KEY_COUNT - 1);
+        channel.position_keys.push_back({time, glm::vec3(0.0f, time, 0.1f * time)});
+        channel.rotation_keys.push_back(
+            {time, glm::angleAxis(time, glm::normalize(glm::vec3(0.3f, 1.0f, 0.2f)))});
+        channel.scale_keys.push_back({time, glm::vec3(1.0f)});
+    }
+    return channel;
+}
+
+// Balanced tree of bones wired the way the model loader wires them
+void build_rig(Skeleton& skeleton, AnimationClip& clip) {
+    clip.name = "bench";
+    clip.duration = DURATION;
+    for (u32 i = 0; i < BONE_COUNT; ++i) {
+        const std::string name = "bone_" + std::to_string(i);
+        const i32 parent = i == 0 ? -1 : static_cast<i32>((i - 1) / 2);
+        const i32 id = skeleton.add_bone(name, parent, glm::mat4(1.0f));
+        if (Bone* parent_bone = skeleton.get_bone(parent)) {
+            parent_bone->children.push_back(id);
+        }
+        clip.channels.push_back(make_channel(name, id));
+    }
+}
+
+} // namespace
+
+TEST_CASE("BoneAnimation interpolation", "[benchmark][animation]") {
+    const BoneAnimation channel = make_channel("bone", 0);
+
+    // Late sample times walk most of the key list
+    BENCHMARK("interpolate_position") {
+        return channel.interpolate_position(0.9f * DURATION);
+    };
+
+    BENCHMARK("interpolate_rotation") {
+        return channel.interpolate_rotation(0.9f * DURATION);
+    };
+
+    BENCHMARK("interpolate_scale") {
+        return channel.interpolate_scale(0.9f * DURATION);
+    };
+}
+
+TEST_CASE("Skeleton::calculate_bone_transforms", "[benchmark][animation]") {
+    Skeleton skeleton;
+    AnimationClip clip;
+    build_rig(skeleton, clip);
+
+    std::vector<glm::mat4> transforms;
+    transforms.reserve(BONE_COUNT);
+
+    BENCHMARK("64 bones, 30 keys per channel") {
+        skeleton.calculate_bone_transforms(clip, 0.5f * DURATION, transforms);
+        return transforms.back()[3][1];
+    };
+}
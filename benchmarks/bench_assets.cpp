@@ -0,0 +1,197 @@
+/**
+ * @file bench_assets.cpp
+ * @brief Benchmarks for AssetRegistry lookups, OBJ import, texture compression and
+ *        SceneSerializer round-trips
+ *
+ * Textures and models need a GL context to load, so registry lookups are
+ * measured on materials, which share the same name map and slot layout, and
+ * model loading is measured on the GL-free import step.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/assets/asset_registry.hpp>
+#include <engine/assets/block_compression.hpp>
+#include <engine/assets/model.hpp>
+#include <engine/core/jobs.hpp>
+#include <engine/scene/components.hpp>
+#include <engine/scene/scene_serializer.hpp>
+
+using namespace hz;
+
+// ============================================================================
+// AssetRegistry
+// ============================================================================
+
+TEST_CASE("AssetRegistry lookups", "[benchmark][assets]") {
+    constexpr u32 MATERIAL_COUNT = 1024;
+
+    AssetRegistry registry;
+    std::vector<std::string> names;
+    std::vector<MaterialHandle> handles;
+    for (u32 i = 0; i < MATERIAL_COUNT; ++i) {
+        names.push_back("materials/surface_" + std::to_string(i));
+        handles.push_back(registry.create_material(names.back(), Material{}));
+    }
+
+    BENCHMARK("get_material(handle) x1024") {
+        f32 total = 0.0f;
+        for (MaterialHandle handle : handles) {
+            total += registry.get_material(handle)->albedo_color.r;
+        }
+        return total;
+    };
+
+    BENCHMARK("get_material_by_name x1024") {
+        u32 total = 0;
+        for (const std::string& name : names) {
+            total += registry.get_material_by_name(name).index;
+        }
+        return total;
+    };
+
+    BENCHMARK("create_material (cached) x1024") {
+        u32 total = 0;
+        for (const std::string& name : names) {
+            total += registry.create_material(name, Material{}).index;
+        }
+        return total;
+    };
+}
+
+// ============================================================================
+// OBJ Import
+// ============================================================================
+
+namespace {
+/// Writes shape_count grid objects of size x size quads, each with its own v/vt/vn
+void write_obj_grid(const std::filesystem::path& path, u32 shape_count, u32 size) {
+    std::ofstream out(path);
+    const u32 side = size + 1;
+    for (u32 s = 0; s < shape_count; ++s) {
+        out << "o grid_" << s << '\n';
+        for (u32 y = 0; y < side; ++y) {
+            for (u32 x = 0; x < side; ++x) {
+                out << "v " << x << ' ' << s << ' ' << y << '\n';
+                out << "vt " << static_cast<f32>(x) / static_cast<f32>(size) << ' '
+                    << static_cast<f32>(y) / static_cast<f32>(size) << '\n';
+                out << "vn 0 1 0\n";
+            }
+        }
+        const u32 base = s * side * side + 1;
+        for (u32 y = 0; y < size; ++y) {
+            for (u32 x = 0; x < size; ++x) {
+                const u32 a = base + y * side + x;
+                const u32 corners[4] = {a, a + 1, a + side + 1, a + side};
+                out << 'f';
+                for (u32 c : corners) {
+                    out << ' ' << c << '/' << c << '/' << c;
+                }
+                out << '\n';
+            }
+        }
+    }
+}
+} // namespace
+
+TEST_CASE("OBJ import", "[benchmark][assets]") {
+    constexpr u32 SHAPE_COUNT = 8;
+    constexpr u32 GRID_SIZE = 128; // 8 x 128 x 128 quads, ~790k face corners
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "horizon_bench.obj";
+    write_obj_grid(path, SHAPE_COUNT, GRID_SIZE);
+
+    BENCHMARK("import_obj 8 shapes (single thread)") {
+        return Model::import_obj(path.string()).meshes.size();
+    };
+
+    JobSystem::init();
+    BENCHMARK("import_obj 8 shapes (job system)") {
+        return Model::import_obj(path.string()).meshes.size();
+    };
+    JobSystem::shutdown();
+
+    std::filesystem::remove(path);
+}
+
+// ============================================================================
+// Texture Compression
+// ============================================================================
+
+TEST_CASE("Texture compression", "[benchmark][assets]") {
+    constexpr u32 SIZE = 512;
+
+    TextureImage image;
+    image.width = SIZE;
+    image.height = SIZE;
+    image.format = TextureFormat::RGBA8;
+    image.pixels.resize(static_cast<usize>(SIZE) * SIZE * 4);
+    for (usize i = 0; i < image.pixels.size(); ++i) {
+        image.pixels[i] = static_cast<u8>((i * 7 + i / 2048 * 13) & 0xFF);
+    }
+
+    JobSystem::init();
+    BENCHMARK("compress_image BC1 512x512") {
+        return compress_image(TextureFormat::BC1, image.pixels.data(), SIZE, SIZE).size();
+    };
+    BENCHMARK("compress_image BC7 512x512") {
+        return compress_image(TextureFormat::BC7, image.pixels.data(), SIZE, SIZE).size();
+    };
+    BENCHMARK("compress_texture BC7 512x512 with mips") {
+        return compress_texture(image, TextureFormat::BC7, true).pixels.size();
+    };
+    JobSystem::shutdown();
+}
+
+// ============================================================================
+// SceneSerializer
+// ============================================================================
+
+TEST_CASE("SceneSerializer round-trip", "[benchmark][scene]") {
+    constexpr u32 ENTITY_COUNT = 1000;
+
+    Scene scene;
+    for (u32 i = 0; i < ENTITY_COUNT; ++i) {
+        const Entity entity = scene.create_entity();
+        scene.registry().emplace<TagComponent>(entity, "entity_" + std::to_string(i));
+        auto& transform = scene.registry().emplace<TransformComponent>(entity);
+        transform.position = glm::vec3(static_cast<f32>(i), 0.0f, static_cast<f32>(i % 32));
+        scene.registry().emplace<MeshComponent>(entity);
+        if (i % 10 == 0) {
+            scene.registry().emplace<LightComponent>(entity);
+        }
+    }
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "horizon_bench_scene.json";
+
+    SceneSerializer writer(scene);
+    BENCHMARK("serialize 1000 entities") {
+        writer.serialize(path);
+    };
+
+    const std::filesystem::path binary_path =
+        std::filesystem::temp_directory_path() / "horizon_bench_scene.hzscene";
+    BENCHMARK("serialize_binary 1000 entities") {
+        return writer.serialize_binary(binary_path);
+    };
+
+    Scene loaded;
+    SceneSerializer reader(loaded);
+    BENCHMARK("deserialize 1000 entities") {
+        return reader.deserialize(path);
+    };
+
+    BENCHMARK("deserialize_binary 1000 entities") {
+        return reader.deserialize_binary(binary_path);
+    };
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(binary_path);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file bench_main.cpp
+ * @brief Entry point for horizon_bench
+ *
+ * Without an explicit --reporter, results go to the console and to
+ * horizon_bench.xml (Catch2 XML reporter) in the working directory, so runs
+ * can be diffed or uploaded without extra flags. Each <BenchmarkResults>
+ * element holds the mean, standard deviation and outlier counts.
+ *
+ * Every run also writes horizon_bench.json next to it, from a listener, for
+ * scripts that would rather not parse XML. (Catch2's JSON reporter is not
+ * used: it drops benchmark results.)
+ */
+
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/detail/catch_benchmark_stats.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <engine/core/log.hpp>
+#include <engine/core/memory.hpp>
+#include <nlohmann/json.hpp>
+
+namespace {
+
+/**
+ * @brief Writes each benchmark's mean, its confidence bounds and standard deviation, in ns
+ */
+class BenchmarkJsonListener : public Catch::EventListenerBase {
+public:
+    using Catch::EventListenerBase::EventListenerBase;
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        m_results.push_back({{"name", stats.info.name},
+                             {"mean_ns", stats.mean.point.count()},
+                             {"mean_low_ns", stats.mean.lower_bound.count()},
+                             {"mean_high_ns", stats.mean.upper_bound.count()},
+                             {"std_dev_ns", stats.standardDeviation.point.count()},
+                             {"samples", stats.info.samples},
+                             {"iterations", stats.info.iterations}});
+    }
+
+    void testRunEnded(const Catch::TestRunStats&) override {
+        if (m_results.empty()) {
+            return;
+        }
+        std::ofstream("horizon_bench.json") << nlohmann::json{{"benchmarks", m_results}}.dump(2)
+                                            << '\n';
+    }
+
+private:
+    nlohmann::json::array_t m_results;
+};
+
+} // namespace
+
+CATCH_REGISTER_LISTENER(BenchmarkJsonListener)
+
+int main(int argc, char* argv[]) {
+    hz::Log::init(hz::LogLevel::Off, hz::LogLevel::Off);
+    hz::MemoryContext::init();
+
+    std::vector<char*> args(argv, argv + argc);
+
+    bool has_reporter = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        has_reporter |= arg == "-r" || arg.starts_with("--reporter");
+    }
+
+    char reporter_flag[] = "--reporter";
+    char console_reporter[] = "console";
+    char xml_reporter[] = "xml::out=horizon_bench.xml";
+    if (!has_reporter) {
+        args.insert(args.end(), {reporter_flag, console_reporter, reporter_flag, xml_reporter});
+    }
+
+    const int result = Catch::Session().run(static_cast<int>(args.size()), args.data());
+
+    hz::MemoryContext::shutdown();
+    hz::Log::shutdown();
+    return result;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file bench_memory.cpp
+ * @brief Benchmarks for LinearArena and HandlePool
+ */
+
+#include <cstddef>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/handle_pool.hpp>
+#include <engine/core/memory.hpp>
+
+using namespace hz;
+
+namespace {
+struct Particle {
+    f32 position[3]{};
+    f32 velocity[3]{};
+    f32 life{0.0f};
+};
+} // namespace
+
+// ============================================================================
+// LinearArena
+// ============================================================================
+
+TEST_CASE("LinearArena allocation", "[benchmark][memory][arena]") {
+    constexpr usize COUNT = 4096;
+
+    LinearArena fixed(COUNT * 64);
+    BENCHMARK("fixed arena: 4096 x 48 B + reset") {
+        void* last = nullptr;
+        for (usize i = 0; i < COUNT; ++i) {
+            last = fixed.allocate(48, alignof(std::max_align_t));
+        }
+        fixed.reset();
+        return last;
+    };
+
+    LinearArena virtual_arena(VirtualArenaConfig{});
+    BENCHMARK("virtual arena: 4096 x 48 B + reset") {
+        void* last = nullptr;
+        for (usize i = 0; i < COUNT; ++i) {
+            last = virtual_arena.allocate(48, alignof(std::max_align_t));
+        }
+        virtual_arena.reset();
+        return last;
+    };
+
+    BENCHMARK("pmr::vector<u32> growth in arena") {
+        usize size = 0;
+        {
+            std::pmr::vector<u32> values(&virtual_arena);
+            for (u32 i = 0; i < COUNT; ++i) {
+                values.push_back(i);
+            }
+            size = values.size();
+        }
+        virtual_arena.reset();
+        return size;
+    };
+
+    // Baseline: the same growth pattern on the global heap
+    BENCHMARK("std::vector<u32> growth on heap") {
+        std::vector<u32> values;
+        for (u32 i = 0; i < COUNT; ++i) {
+            values.push_back(i);
+        }
+        return values.size();
+    };
+}
+
+// ============================================================================
+// HandlePool
+// ============================================================================
+
+TEST_CASE("HandlePool vs ad-hoc containers", "[benchmark][handle_pool]") {
+    constexpr u32 COUNT = 10'000;
+
+    BENCHMARK("HandlePool churn + iterate") {
+        HandlePool<Particle> pool;
+        pool.reserve(COUNT);
+        std::vector<HandlePool<Particle>::HandleType> handles;
+        handles.reserve(COUNT);
+        for (u32 i = 0; i < COUNT; ++i) {
+            handles.push_back(pool.emplace());
+        }
+        for (u32 i = 0; i < COUNT; i += 3) {
+            pool.erase(handles[i]);
+        }
+        f32 total = 0.0f;
+        for (const Particle& p : pool) {
+            total += p.life;
+        }
+        return total;
+    };
+
+    // Vector + index with an alive flag (ParticleSystem / HitboxSystem style)
+    BENCHMARK("vector + index churn + iterate") {
+        struct Entry {
+            Particle value;
+            bool alive{false};
+        };
+        std::vector<Entry> entries;
+        std::vector<u32> free_list;
+        entries.reserve(COUNT);
+        for (u32 i = 0; i < COUNT; ++i) {
+            entries.push_back({Particle{}, true});
+        }
+        for (u32 i = 0; i < COUNT; i += 3) {
+            entries[i].alive = false;
+            free_list.push_back(i);
+        }
+        f32 total = 0.0f;
+        for (const Entry& e : entries) {
+            if (e.alive) {
+                total += e.value.life;
+            }
+        }
+        return total;
+    };
+
+    // Keyed map (AssetRegistry / AudioSystem style)
+    BENCHMARK("unordered_map churn + iterate") {
+        std::unordered_map<u32, Particle> map;
+        map.reserve(COUNT);
+        for (u32 i = 0; i < COUNT; ++i) {
+            map.emplace(i, Particle{});
+        }
+        for (u32 i = 0; i < COUNT; i += 3) {
+            map.erase(i);
+        }
+        f32 total = 0.0f;
+        for (const auto& [id, p] : map) {
+            total += p.life;
+        }
+        return total;
+    };
+}
@@ -0,0 +1,56 @@
+/**
+ * @file bench_particles.cpp
+ * @brief Benchmarks for CPU particle simulation
+ *
+ * No GL context is created, so ParticleEmitter skips its instance upload and
+ * only the simulation is measured.
+ */
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/renderer/particle_system.hpp>
+
+using namespace hz;
+
+TEST_CASE("ParticleEmitter::update", "[benchmark][particles]") {
+    constexpr u32 MAX_PARTICLES = 10'000;
+    constexpr float DT = 1.0f / 60.0f;
+
+    SECTION("steady state") {
+        ParticleEmitterConfig config;
+        config.max_particles = MAX_PARTICLES;
+        config.burst_mode = true;
+        config.life_min = 1.0e6f; // Nothing expires while measuring
+        config.life_max = 1.0e6f;
+        config.drag = 0.1f;
+
+        ParticleEmitter emitter;
+        emitter.init(config);
+        emitter.emit_burst(MAX_PARTICLES);
+
+        BENCHMARK("10k live particles") {
+            emitter.update(DT);
+            return emitter.active_count();
+        };
+    }
+
+    SECTION("continuous emission") {
+        // ~2000 particles alive, 1000 spawned and expired per second
+        ParticleEmitterConfig config;
+        config.max_particles = MAX_PARTICLES;
+        config.emit_rate = 1000.0f;
+        config.life_min = 1.5f;
+        config.life_max = 2.5f;
+
+        ParticleEmitter emitter;
+        emitter.init(config);
+        for (int i = 0; i < 180; ++i) {
+            emitter.update(DT);
+        }
+
+        BENCHMARK("1000 particles/s, 2 s lifetime") {
+            emitter.update(DT);
+            return emitter.active_count();
+        };
+    }
+}
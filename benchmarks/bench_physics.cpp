@@ -0,0 +1,148 @@
+/**
+ * @file bench_physics.cpp
+ * @brief Benchmarks for hitbox queries and projectile simulation
+ */
+
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/physics/hitbox_system.hpp>
+#include <engine/physics/physics_world.hpp>
+#include <engine/physics/projectile_system.hpp>
+#include <engine/scene/command_buffer.hpp>
+
+using namespace hz;
+
+namespace {
+
+constexpr u32 TARGET_COUNT = 32;
+
+/**
+ * @brief Physics world with a row of humanoid hitbox sets along +x at z = 20
+ */
+struct HitboxField {
+    PhysicsWorld physics;
+    HitboxSystem hitboxes;
+    entt::registry registry;
+
+    HitboxField() {
+        physics.init();
+        hitboxes.init(physics);
+        for (u32 i = 0; i < TARGET_COUNT; ++i) {
+            const entt::entity entity = registry.create();
+            auto& comp =
+                registry.emplace<HitboxComponent>(entity, HitboxComponent::create_humanoid());
+            hitboxes.create_hitbox_bodies(entity, comp, target_position(i));
+        }
+        physics.update(1.0f / 60.0f);
+    }
+
+    ~HitboxField() {
+        registry.view<HitboxComponent>().each(
+            [&](HitboxComponent& comp) { hitboxes.destroy_hitbox_bodies(comp); });
+        hitboxes.shutdown();
+        physics.shutdown();
+    }
+
+    HZ_NON_COPYABLE(HitboxField);
+    HZ_NON_MOVABLE(HitboxField);
+
+    static glm::vec3 target_position(u32 index) {
+        return {2.0f * static_cast<f32>(index), 0.0f, 20.0f};
+    }
+};
+
+} // namespace
+
+TEST_CASE("HitboxSystem::raycast_hitboxes", "[benchmark][physics][hitbox]") {
+    HitboxField field;
+
+    RaycastHit hit;
+    Hitbox* hitbox = nullptr;
+    entt::entity entity = entt::null;
+
+    const glm::vec3 forward{0.0f, 0.0f, 1.0f};
+    const glm::vec3 chest =
+        HitboxField::target_position(TARGET_COUNT / 2) + glm::vec3(0.0f, 1.2f, 0.0f);
+
+    BENCHMARK("hit (torso)") {
+        return field.hitboxes.raycast_hitboxes(chest - glm::vec3(0.0f, 0.0f, 20.0f), forward,
+                                               100.0f, field.registry, hit, hitbox, entity);
+    };
+
+    BENCHMARK("miss (over heads)") {
+        return field.hitboxes.raycast_hitboxes(chest + glm::vec3(0.0f, 5.0f, -20.0f), forward,
+                                               100.0f, field.registry, hit, hitbox, entity);
+    };
+}
+
+TEST_CASE("ProjectileSystem::update", "[benchmark][physics][projectile]") {
+    constexpr u32 PROJECTILE_COUNT = 256;
+
+    HitboxField field;
+    ProjectileSystem projectiles;
+    projectiles.init(field.physics, field.hitboxes);
+
+    // Bullets cross the target row just above head height, so every step
+    // sweeps a ray through the broadphase without resolving a hit.
+    ProjectileData data;
+    data.type = ProjectileType::Ballistic;
+    data.muzzle_velocity = 100.0f;
+    data.gravity_scale = 0.0f;
+    data.max_lifetime = 1.0e9f;
+
+    for (u32 i = 0; i < PROJECTILE_COUNT; ++i) {
+        const f32 x = 2.0f * static_cast<f32>(TARGET_COUNT) * static_cast<f32>(i) /
+                      static_cast<f32>(PROJECTILE_COUNT);
+        projectiles.spawn_ballistic({x, 2.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, data, entt::null,
+                                    field.registry);
+    }
+
+    // Every iteration rewinds to the spawn state, so each step covers the same
+    // flight segment however many iterations Catch2 runs per sample. Subtract
+    // the "rewind only" baseline from the update timing.
+    auto view = field.registry.view<ProjectileComponent>();
+    std::vector<ProjectileComponent> spawned;
+    spawned.reserve(PROJECTILE_COUNT);
+    view.each([&](const ProjectileComponent& proj) { spawned.push_back(proj); });
+    const auto rewind = [&] {
+        usize index = 0;
+        view.each([&](ProjectileComponent& proj) { proj = spawned[index++]; });
+    };
+
+    BENCHMARK_ADVANCED("rewind only (baseline)")(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&] { rewind(); });
+    };
+
+    BENCHMARK_ADVANCED("256 ballistic projectiles (with rewind)")(Catch::Benchmark::Chronometer meter) {
+        // Nothing is destroyed mid-flight, but drop any recorded commands so
+        // they cannot pile up across samples
+        command_buffer(field.registry).clear();
+        meter.measure([&] {
+            rewind();
+            projectiles.update(field.registry, 1.0f / 60.0f);
+        });
+    };
+    REQUIRE(command_buffer(field.registry).empty());
+
+    projectiles.shutdown();
+}
+
+TEST_CASE("ProjectileSystem::fire_hitscan", "[benchmark][physics][projectile]") {
+    HitboxField field;
+    ProjectileSystem projectiles;
+    projectiles.init(field.physics, field.hitboxes);
+
+    const ProjectileData data;
+    const glm::vec3 origin =
+        HitboxField::target_position(TARGET_COUNT / 2) + glm::vec3(0.0f, 1.6f, -20.0f);
+
+    BENCHMARK("headshot at 20 m") {
+        return projectiles.fire_hitscan(origin, {0.0f, 0.0f, 1.0f}, data, entt::null,
+                                         field.registry)
+            .final_damage;
+    };
+
+    projectiles.shutdown();
+}
@@ -1,5 +1,10 @@
 #include "asset_registry.hpp"
 
+#include "block_compression.hpp"
+
+#include <algorithm>
+#include <chrono>
+
 namespace hz {
 
 // ============================================================================
@@ -29,12 +34,53 @@ TextureHandle AssetRegistry::load_texture(std::string_view path, const TexturePa
     return {index, 1};
 }
 
+TextureHandle AssetRegistry::load_texture_async(std::string_view path,
+                                                const TextureParams& params) {
+    std::string path_str(path);
+
+    auto it = m_texture_path_to_index.find(path_str);
+    if (it != m_texture_path_to_index.end()) {
+        auto& slot = m_textures[it->second];
+        return {it->second, slot.generation};
+    }
+
+    if (!m_placeholder_texture.is_valid()) {
+        const u8 white[4] = {255, 255, 255, 255};
+        TextureParams placeholder_params;
+        placeholder_params.generate_mipmaps = false;
+        placeholder_params.min_filter = TextureFilter::Nearest;
+        m_placeholder_texture = Texture::create(1, 1, TextureFormat::RGBA8, white,
+                                                placeholder_params);
+    }
+    m_streamer.start();
+
+    const u32 index = static_cast<u32>(m_textures.size());
+    const u64 ticket = m_next_ticket++;
+    m_textures.push_back({Texture{}, 1, path_str, AssetState::Pending, ticket});
+    m_texture_path_to_index[path_str] = index;
+    ++m_streaming_count;
+
+    if (m_residency_enabled) {
+        m_managed_texture_params[index] = params;
+        m_streamer.submit([this, index, ticket, path_str, params] {
+            push_streamed(decode_levels(index, ticket, path_str, params, std::nullopt));
+        });
+        return {index, 1};
+    }
+    m_streamer.submit([this, index, ticket, path_str, params] {
+        push_streamed(StreamedTexture{index, ticket, Texture::decode_file(path_str, params), params});
+    });
+    return {index, 1};
+}
+
 Texture* AssetRegistry::get_texture(TextureHandle handle) {
     if (handle.index >= m_textures.size())
         return nullptr;
     auto& slot = m_textures[handle.index];
     if (slot.generation != handle.generation)
         return nullptr;
+    if (slot.state != AssetState::Resident)
+        return &m_placeholder_texture;
     return &slot.asset;
 }
 
@@ -44,26 +90,122 @@ const Texture* AssetRegistry::get_texture(TextureHandle handle) const {
     const auto& slot = m_textures[handle.index];
     if (slot.generation != handle.generation)
         return nullptr;
+    if (slot.state != AssetState::Resident)
+        return &m_placeholder_texture;
     return &slot.asset;
 }
 
+AssetState AssetRegistry::texture_state(TextureHandle handle) const {
+    if (handle.index >= m_textures.size() ||
+        m_textures[handle.index].generation != handle.generation)
+        return AssetState::Failed;
+    return m_textures[handle.index].state;
+}
+
+void AssetRegistry::set_placeholder_texture(Texture texture) {
+    m_placeholder_texture = std::move(texture);
+}
+
 bool AssetRegistry::reload_texture(TextureHandle handle) {
     if (handle.index >= m_textures.size())
         return false;
     auto& slot = m_textures[handle.index];
-    if (slot.generation != handle.generation)
+    if (slot.generation != handle.generation || slot.state == AssetState::Pending)
         return false;
 
+    if (m_residency.is_tracked(handle.index)) {
+        // Drop any level change in flight and reload at the resident level
+        m_residency.cancel(handle.index);
+        slot.ticket = m_next_ticket++;
+        const StreamedTexture streamed =
+            decode_levels(handle.index, slot.ticket, slot.path,
+                          m_managed_texture_params[handle.index],
+                          m_residency.resident_mip(handle.index));
+        Texture new_tex = Texture::create(streamed.image, streamed.params);
+        if (!new_tex.is_valid())
+            return false;
+
+        slot.asset = std::move(new_tex);
+        slot.generation++;
+        m_residency.track(handle.index, streamed.chain_width, streamed.chain_height,
+                          streamed.image.format, streamed.chain_mips, streamed.mip);
+        HZ_ENGINE_INFO("Reloaded texture: {}", slot.path);
+        return true;
+    }
+
     Texture new_tex = Texture::load_from_file(slot.path);
     if (!new_tex.is_valid())
         return false;
 
     slot.asset = std::move(new_tex);
+    slot.state = AssetState::Resident;
     slot.generation++;
     HZ_ENGINE_INFO("Reloaded texture: {}", slot.path);
     return true;
 }
 
+// ============================================================================
+// Texture Residency
+// ============================================================================
+
+void AssetRegistry::enable_texture_residency(u64 budget_bytes) {
+    m_residency_enabled = true;
+    m_residency.set_budget(budget_bytes);
+}
+
+void AssetRegistry::request_texture_mip(TextureHandle handle, u32 mip) {
+    if (handle.index < m_textures.size() &&
+        m_textures[handle.index].generation == handle.generation) {
+        m_residency.request(handle.index, mip);
+    }
+}
+
+void AssetRegistry::request_texture_size(TextureHandle handle, f32 screen_pixels) {
+    if (handle.index < m_textures.size() &&
+        m_textures[handle.index].generation == handle.generation) {
+        m_residency.request_screen_size(handle.index, screen_pixels);
+    }
+}
+
+AssetRegistry::StreamedTexture AssetRegistry::decode_levels(u32 index, u64 ticket,
+                                                            const std::string& path,
+                                                            const TextureParams& params,
+                                                            std::optional<u32> first_mip) {
+    StreamedTexture streamed{index, ticket, Texture::decode_file(path, params), params};
+    streamed.managed = true;
+    const TextureImage& image = streamed.image;
+    if (!image.is_valid()) {
+        return streamed;
+    }
+
+    // Uncompressed textures get the rest of their chain from glGenerateMipmap
+    streamed.chain_width = image.width;
+    streamed.chain_height = image.height;
+    if (is_block_compressed(image.format)) {
+        streamed.chain_mips = image.mip_count;
+    } else {
+        streamed.chain_mips = params.generate_mipmaps ? full_mip_count(image.width, image.height)
+                                                      : 1;
+    }
+    streamed.mip = std::min(first_mip.value_or(TextureResidency::tail_mip_for(
+                                image.width, image.height, streamed.chain_mips)),
+                            streamed.chain_mips - 1);
+    streamed.image = drop_top_mips(image, streamed.mip);
+    return streamed;
+}
+
+void AssetRegistry::stream_levels(const TextureMipChange& change) {
+    auto& slot = m_textures[change.id];
+    const u64 ticket = m_next_ticket++;
+    slot.ticket = ticket;
+    m_streamer.submit([this, index = change.id, ticket, mip = change.mip, path = slot.path,
+                       params = m_managed_texture_params[change.id]] {
+        StreamedTexture streamed = decode_levels(index, ticket, path, params, mip);
+        streamed.level_change = true;
+        push_streamed(std::move(streamed));
+    });
+}
+
 // ============================================================================
 // Model Management
 // ============================================================================
@@ -77,15 +219,8 @@ ModelHandle AssetRegistry::load_model(std::string_view path) {
         return {it->second, slot.generation};
     }
 
-    // Load based on extension
-    Model model;
-    if (path_str.ends_with(".gltf") || path_str.ends_with(".glb")) {
-        model = Model::load_from_gltf(path);
-    } else if (path_str.ends_with(".fbx")) {
-        model = Model::load_from_fbx(path);
-    } else {
-        model = Model::load_from_obj(path);
-    }
+    // Load based on extension, or from the cooked file if it is up to date
+    Model model = Model::load_from_file(path);
     if (!model.is_valid()) {
         return ModelHandle::invalid();
     }
@@ -97,11 +232,36 @@ ModelHandle AssetRegistry::load_model(std::string_view path) {
     return {index, 1};
 }
 
+ModelHandle AssetRegistry::load_model_async(std::string_view path) {
+    std::string path_str(path);
+
+    auto it = m_model_path_to_index.find(path_str);
+    if (it != m_model_path_to_index.end()) {
+        auto& slot = m_models[it->second];
+        return {it->second, slot.generation};
+    }
+
+    m_streamer.start();
+
+    const u32 index = static_cast<u32>(m_models.size());
+    const u64 ticket = m_next_ticket++;
+    m_models.push_back({Model{}, 1, path_str, AssetState::Pending, ticket});
+    m_model_path_to_index[path_str] = index;
+    ++m_streaming_count;
+
+    m_streamer.submit([this, index, ticket, path_str] {
+        ModelData data = Model::read_file(path_str);
+        Model::decode_textures(data);
+        push_streamed(StreamedModel{index, ticket, std::move(data)});
+    });
+    return {index, 1};
+}
+
 Model* AssetRegistry::get_model(ModelHandle handle) {
     if (handle.index >= m_models.size())
         return nullptr;
     auto& slot = m_models[handle.index];
-    if (slot.generation != handle.generation)
+    if (slot.generation != handle.generation || slot.state != AssetState::Resident)
         return nullptr;
     return &slot.asset;
 }
@@ -110,30 +270,30 @@ const Model* AssetRegistry::get_model(ModelHandle handle) const {
     if (handle.index >= m_models.size())
         return nullptr;
     const auto& slot = m_models[handle.index];
-    if (slot.generation != handle.generation)
+    if (slot.generation != handle.generation || slot.state != AssetState::Resident)
         return nullptr;
     return &slot.asset;
 }
 
+AssetState AssetRegistry::model_state(ModelHandle handle) const {
+    if (handle.index >= m_models.size() || m_models[handle.index].generation != handle.generation)
+        return AssetState::Failed;
+    return m_models[handle.index].state;
+}
+
 bool AssetRegistry::reload_model(ModelHandle handle) {
     if (handle.index >= m_models.size())
         return false;
     auto& slot = m_models[handle.index];
-    if (slot.generation != handle.generation)
+    if (slot.generation != handle.generation || slot.state == AssetState::Pending)
         return false;
 
-    Model new_model;
-    if (slot.path.ends_with(".gltf") || slot.path.ends_with(".glb")) {
-        new_model = Model::load_from_gltf(slot.path);
-    } else if (slot.path.ends_with(".fbx")) {
-        new_model = Model::load_from_fbx(slot.path);
-    } else {
-        new_model = Model::load_from_obj(slot.path);
-    }
+    Model new_model = Model::load_from_file(slot.path);
     if (!new_model.is_valid())
         return false;
 
     slot.asset = std::move(new_model);
+    slot.state = AssetState::Resident;
     slot.generation++;
     HZ_ENGINE_INFO("Reloaded model: {}", slot.path);
     return true;
@@ -213,6 +373,112 @@ SoundHandle AssetRegistry::load_sound(const std::string& path, AudioSystem& audi
     return handle;
 }
 
+// ============================================================================
+// Streaming
+// ============================================================================
+
+void AssetRegistry::push_streamed(StreamedAsset asset) {
+    std::lock_guard lock(m_streamed_mutex);
+    m_streamed.push_back(std::move(asset));
+}
+
+u32 AssetRegistry::update_streaming(f64 budget_ms) {
+    if (m_residency_enabled) {
+        for (const TextureMipChange& change : m_residency.update()) {
+            stream_levels(change);
+        }
+    }
+
+    {
+        std::lock_guard lock(m_streamed_mutex);
+        for (StreamedAsset& asset : m_streamed) {
+            m_ready.push_back(std::move(asset));
+        }
+        m_streamed.clear();
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    u32 uploaded = 0;
+    while (!m_ready.empty()) {
+        StreamedAsset asset = std::move(m_ready.front());
+        m_ready.pop_front();
+        if (std::visit([this](auto& streamed) { return upload_streamed(streamed); }, asset)) {
+            ++uploaded;
+        }
+        const f64 elapsed_ms =
+            std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+        if (elapsed_ms >= budget_ms) {
+            break;
+        }
+    }
+    return uploaded;
+}
+
+bool AssetRegistry::upload_streamed(StreamedTexture& streamed) {
+    // Requests dropped by clear() leave results that match no slot
+    if (streamed.index >= m_textures.size())
+        return false;
+    auto& slot = m_textures[streamed.index];
+    if (slot.ticket != streamed.ticket)
+        return false;
+
+    if (streamed.level_change) {
+        // The resident levels stay bound until the new ones are uploaded
+        Texture texture = Texture::create(streamed.image, streamed.params);
+        if (!texture.is_valid()) {
+            m_residency.fail(streamed.index);
+            HZ_ENGINE_ERROR("Failed to stream mip {} of texture: {}", streamed.mip, slot.path);
+            return false;
+        }
+        slot.asset = std::move(texture);
+        m_residency.complete(streamed.index, streamed.mip);
+        return true;
+    }
+
+    if (slot.state != AssetState::Pending)
+        return false;
+
+    --m_streaming_count;
+    Texture texture = Texture::create(streamed.image, streamed.params);
+    if (!texture.is_valid()) {
+        slot.state = AssetState::Failed;
+        HZ_ENGINE_ERROR("Failed to stream texture: {}", slot.path);
+        return false;
+    }
+
+    slot.asset = std::move(texture);
+    slot.state = AssetState::Resident;
+    if (streamed.managed) {
+        m_residency.track(streamed.index, streamed.chain_width, streamed.chain_height,
+                          streamed.image.format, streamed.chain_mips, streamed.mip);
+    }
+    HZ_ENGINE_INFO("Streamed texture: {} ({}x{})", slot.path, streamed.image.width,
+                   streamed.image.height);
+    return true;
+}
+
+bool AssetRegistry::upload_streamed(StreamedModel& streamed) {
+    if (streamed.index >= m_models.size())
+        return false;
+    auto& slot = m_models[streamed.index];
+    if (slot.state != AssetState::Pending || slot.ticket != streamed.ticket)
+        return false;
+
+    --m_streaming_count;
+    Model model = Model::from_data(std::move(streamed.data), slot.path);
+    if (!model.is_valid()) {
+        slot.state = AssetState::Failed;
+        HZ_ENGINE_ERROR("Failed to stream model: {}", slot.path);
+        return false;
+    }
+
+    slot.asset = std::move(model);
+    slot.state = AssetState::Resident;
+    HZ_ENGINE_INFO("Streamed model: {} ({} meshes)", slot.path, slot.asset.mesh_count());
+    return true;
+}
+
 // ============================================================================
 // Utility
 // ============================================================================
@@ -235,6 +501,14 @@ void AssetRegistry::clear() {
     m_material_name_to_index.clear();
     m_default_material = MaterialHandle::invalid();
     m_loaded_sounds.clear();
+    m_ready.clear();
+    {
+        std::lock_guard lock(m_streamed_mutex);
+        m_streamed.clear();
+    }
+    m_streaming_count = 0;
+    m_residency.clear();
+    m_managed_texture_params.clear();
     HZ_ENGINE_INFO("Asset registry cleared");
 }
 
@@ -3,25 +3,48 @@
 /**
  * @file asset_registry.hpp
  * @brief Central registry for asset management
+ *
+ * Assets load synchronously through load_texture()/load_model(), or stream
+ * through the *_async variants: file reads and decoding run on AssetStreamer
+ * threads, and update_streaming() uploads the results on the render thread
+ * within a per-frame time budget.
+ *
+ * With texture residency enabled, streamed textures also stream their mip
+ * levels in and out within a VRAM budget, following the levels the renderer
+ * requests each frame (see texture_residency.hpp).
  */
 
 #include "engine/core/log.hpp"
 #include "engine/core/types.hpp"
 
+#include <deque>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 #include <engine/assets/asset_handle.hpp>
+#include <engine/assets/asset_streamer.hpp>
 #include <engine/assets/material.hpp>
 #include <engine/assets/model.hpp>
 #include <engine/assets/texture.hpp>
+#include <engine/assets/texture_residency.hpp>
 #include <engine/audio/audio_engine.hpp>
 
 namespace hz {
 
+/**
+ * @brief Residency of a registry asset
+ */
+enum class AssetState : u8 {
+    Resident, // Loaded and uploaded
+    Pending,  // Streaming; textures resolve to the placeholder, models to nullptr
+    Failed,   // Streaming failed; resolves as if still pending
+};
+
 /**
  * @brief Central asset registry with handle-based access
  */
@@ -42,32 +65,105 @@ public:
      */
     TextureHandle load_texture(std::string_view path, const TextureParams& params = {});
 
+    /**
+     * @brief Start streaming a texture and return its handle at once
+     *
+     * The handle stays Pending until update_streaming() uploads the texture.
+     * Returns the existing handle if the path is already loaded or streaming.
+     */
+    TextureHandle load_texture_async(std::string_view path, const TextureParams& params = {});
+
     /**
      * @brief Get texture by handle
+     *
+     * A streamed texture that is not resident yet resolves to the placeholder.
      */
     [[nodiscard]] Texture* get_texture(TextureHandle handle);
     [[nodiscard]] const Texture* get_texture(TextureHandle handle) const;
 
+    [[nodiscard]] AssetState texture_state(TextureHandle handle) const;
+
+    /**
+     * @brief Replace the placeholder bound for non-resident streamed textures
+     *
+     * Defaults to 1x1 white, created by the first load_texture_async().
+     */
+    void set_placeholder_texture(Texture texture);
+
     /**
      * @brief Reload a texture from disk
+     *
+     * A residency-managed texture reloads at its resident level.
      */
     bool reload_texture(TextureHandle handle);
 
+    // ========================================================================
+    // Texture Residency
+    // ========================================================================
+
+    /**
+     * @brief Manage the mip levels of textures streamed from now on, within budget_bytes of VRAM
+     *
+     * Managed textures first load their tail (64 texels and smaller) and then
+     * stream levels in and out as request_texture_mip()/request_texture_size()
+     * ask for them. A budget of 0 streams requested levels without a limit.
+     * Call again to change the budget. Textures loaded with load_texture() and
+     * model material textures stay whole and resident.
+     */
+    void enable_texture_residency(u64 budget_bytes);
+
+    [[nodiscard]] bool is_texture_residency_enabled() const noexcept {
+        return m_residency_enabled;
+    }
+
+    /**
+     * @brief Ask for a managed texture's levels from mip down this frame
+     */
+    void request_texture_mip(TextureHandle handle, u32 mip);
+
+    /**
+     * @brief Ask for the level a managed texture needs when it covers screen_pixels
+     *
+     * See TextureResidency::projected_size() for a CPU estimate from distance.
+     */
+    void request_texture_size(TextureHandle handle, f32 screen_pixels);
+
+    /**
+     * @brief Resident bytes, pending level changes and evictions of managed textures
+     */
+    [[nodiscard]] TextureResidencyStats texture_residency_stats() const noexcept {
+        return m_residency.stats();
+    }
+
     // ========================================================================
     // Model Management
     // ========================================================================
 
     /**
      * @brief Load or get cached model
+     *
+     * Loads path's cooked file (path + ".hzmesh", see horizon_cook) instead
+     * of the source when the cooked file is at least as new.
      */
     ModelHandle load_model(std::string_view path);
 
+    /**
+     * @brief Start streaming a model and its material textures and return its handle at once
+     *
+     * The handle stays Pending until update_streaming() uploads the model.
+     */
+    ModelHandle load_model_async(std::string_view path);
+
     /**
      * @brief Get model by handle
+     *
+     * Returns nullptr while a streamed model is not resident.
      */
     [[nodiscard]] Model* get_model(ModelHandle handle);
     [[nodiscard]] const Model* get_model(ModelHandle handle) const;
 
+    [[nodiscard]] AssetState model_state(ModelHandle handle) const;
+
     /**
      * @brief Reload a model from disk
      */
@@ -107,6 +203,30 @@ public:
      */
     SoundHandle load_sound(const std::string& path, AudioSystem& audio);
 
+    // ========================================================================
+    // Streaming
+    // ========================================================================
+
+    static constexpr f64 DEFAULT_STREAMING_BUDGET_MS = 2.0;
+
+    /**
+     * @brief Upload finished streaming loads; call once per frame on the render thread
+     *
+     * Uploads in request order until budget_ms has passed, always at least
+     * one, and leaves the rest for later frames. A single asset is never
+     * split across frames. With texture residency enabled, first plans the
+     * frame's mip levels from the requests made since the last call and
+     * starts streaming the changes.
+     *
+     * @return Number of assets that became resident
+     */
+    u32 update_streaming(f64 budget_ms = DEFAULT_STREAMING_BUDGET_MS);
+
+    /**
+     * @brief Streamed assets that are neither resident nor failed
+     */
+    [[nodiscard]] u32 streaming_count() const noexcept { return m_streaming_count; }
+
     // ========================================================================
     // Utility
     // ========================================================================
@@ -134,8 +254,40 @@ private:
         T asset;
         u32 generation{1};
         std::string path;
+        AssetState state{AssetState::Resident};
+        u64 ticket{0}; // Streaming request the slot waits for
     };
 
+    // Results handed from streaming threads to update_streaming()
+    struct StreamedTexture {
+        u32 index;
+        u64 ticket;
+        TextureImage image;
+        TextureParams params;
+        // Residency-managed textures only
+        bool managed{false};
+        bool level_change{false}; // New levels for a resident texture
+        u32 mip{0};               // Level of the full chain the image starts at
+        u32 chain_width{0};
+        u32 chain_height{0};
+        u32 chain_mips{0};
+    };
+    struct StreamedModel {
+        u32 index;
+        u64 ticket;
+        ModelData data;
+    };
+    using StreamedAsset = std::variant<StreamedTexture, StreamedModel>;
+
+    /// Decode levels first_mip and down of a managed texture, or its tail if first_mip is empty
+    static StreamedTexture decode_levels(u32 index, u64 ticket, const std::string& path,
+                                         const TextureParams& params,
+                                         std::optional<u32> first_mip);
+    void stream_levels(const TextureMipChange& change);
+    void push_streamed(StreamedAsset asset);
+    bool upload_streamed(StreamedTexture& streamed);
+    bool upload_streamed(StreamedModel& streamed);
+
     std::vector<AssetSlot<Texture, TextureHandle>> m_textures;
     std::unordered_map<std::string, u32, TransparentStringHash, std::equal_to<>> m_texture_path_to_index;
 
@@ -148,6 +300,20 @@ private:
 
     // Sound cache (path -> handle)
     std::unordered_map<std::string, SoundHandle, TransparentStringHash, std::equal_to<>> m_loaded_sounds;
+
+    // Texture residency
+    TextureResidency m_residency;
+    bool m_residency_enabled{false};
+    std::unordered_map<u32, TextureParams> m_managed_texture_params; // By texture slot
+
+    // Streaming
+    Texture m_placeholder_texture;
+    u64 m_next_ticket{1}; // Never reset, so results of requests dropped by clear() match no slot
+    u32 m_streaming_count{0};
+    std::deque<StreamedAsset> m_ready; // Render thread only
+    std::mutex m_streamed_mutex;
+    std::vector<StreamedAsset> m_streamed; // Guarded by m_streamed_mutex
+    AssetStreamer m_streamer;              // Last, so its threads stop before the queues go away
 };
 
 } // namespace hz
@@ -0,0 +1,77 @@
+#include "asset_streamer.hpp"
+
+#include "engine/core/log.hpp"
+#include "engine/core/profiler.hpp"
+
+#include <string>
+
+namespace hz {
+
+void AssetStreamer::start(u32 thread_count) {
+    if (is_running()) {
+        return;
+    }
+
+    m_stopping = false;
+    m_threads.reserve(thread_count);
+    for (u32 i = 0; i < thread_count; ++i) {
+        m_threads.emplace_back(&AssetStreamer::thread_main, this, i);
+    }
+    HZ_ENGINE_INFO("Asset streamer started ({} threads)", thread_count);
+}
+
+void AssetStreamer::stop() {
+    if (!is_running()) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+        m_queue.clear();
+    }
+    m_wake.notify_all();
+
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+    m_threads.clear();
+}
+
+void AssetStreamer::submit(Work work) {
+    if (!is_running()) {
+        work();
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_queue.push_back(std::move(work));
+    }
+    m_wake.notify_one();
+}
+
+usize AssetStreamer::queued() const {
+    std::lock_guard lock(m_mutex);
+    return m_queue.size();
+}
+
+void AssetStreamer::thread_main([[maybe_unused]] u32 index) {
+    HZ_PROFILE_THREAD("Streaming " + std::to_string(index));
+
+    while (true) {
+        Work work;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            work = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        work();
+    }
+}
+
+} // namespace hz
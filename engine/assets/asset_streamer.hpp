@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file asset_streamer.hpp
+ * @brief Background threads for asset file reads and decoding
+ *
+ * Loads block on disk and spend most of their time in image decoding and mesh
+ * import, none of which needs GL. AssetRegistry runs that work here and keeps
+ * only the upload on the render thread.
+ *
+ * The streamer is separate from the JobSystem on purpose: a load can block on
+ * I/O for a long time, and a job that does would stall frame work waiting on
+ * the same workers (or the main thread, which helps run jobs while it waits).
+ */
+
+#include "engine/core/types.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hz {
+
+/**
+ * @brief FIFO pool of threads for blocking asset work
+ */
+class AssetStreamer {
+public:
+    using Work = std::function<void()>;
+
+    static constexpr u32 DEFAULT_THREAD_COUNT = 2;
+
+    AssetStreamer() = default;
+    ~AssetStreamer() { stop(); }
+
+    HZ_NON_COPYABLE(AssetStreamer);
+    HZ_NON_MOVABLE(AssetStreamer);
+
+    /**
+     * @brief Start the streaming threads (no-op if already running)
+     */
+    void start(u32 thread_count = DEFAULT_THREAD_COUNT);
+
+    /**
+     * @brief Discard queued work, wait for running work and join the threads
+     */
+    void stop();
+
+    [[nodiscard]] bool is_running() const noexcept { return !m_threads.empty(); }
+
+    /**
+     * @brief Queue work for a streaming thread, or run it inline when not running
+     *
+     * Work must not throw.
+     */
+    void submit(Work work);
+
+    /**
+     * @brief Work queued but not yet picked up by a thread
+     */
+    [[nodiscard]] usize queued() const;
+
+private:
+    void thread_main(u32 index);
+
+    std::vector<std::thread> m_threads;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<Work> m_queue;
+    bool m_stopping{false};
+};
+
+} // namespace hz
@@ -0,0 +1,792 @@
+#include "block_compression.hpp"
+
+#include "engine/core/jobs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace hz {
+
+namespace {
+
+constexpr u32 BLOCK_PIXELS = 16;
+
+using Pixel = std::array<f32, 4>;
+
+f32 clamp_byte(f32 value) {
+    return std::clamp(value, 0.0f, 255.0f);
+}
+
+f32 distance_squared(const Pixel& a, const Pixel& b, u32 channels) {
+    f32 sum = 0.0f;
+    for (u32 c = 0; c < channels; ++c) {
+        const f32 d = a[c] - b[c];
+        sum += d * d;
+    }
+    return sum;
+}
+
+// ============================================================================
+// Endpoint Fitting
+// ============================================================================
+
+/**
+ * @brief Endpoints of a block's pixels along their principal axis
+ *
+ * The axis is found by power iteration on the covariance of the first
+ * `channels` channels, starting from the row of the channel that varies most
+ * (which, unlike a fixed start, is never orthogonal to the answer).
+ * Projecting every pixel onto the axis gives the extremes.
+ */
+void fit_principal_axis(const Pixel* pixels, u32 channels, Pixel& first, Pixel& second) {
+    Pixel mean{};
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        for (u32 c = 0; c < channels; ++c) {
+            mean[c] += pixels[i][c];
+        }
+    }
+    for (u32 c = 0; c < channels; ++c) {
+        mean[c] /= static_cast<f32>(BLOCK_PIXELS);
+    }
+
+    f32 covariance[4][4] = {};
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        for (u32 a = 0; a < channels; ++a) {
+            for (u32 b = a; b < channels; ++b) {
+                covariance[a][b] += (pixels[i][a] - mean[a]) * (pixels[i][b] - mean[b]);
+            }
+        }
+    }
+    for (u32 a = 0; a < channels; ++a) {
+        for (u32 b = 0; b < a; ++b) {
+            covariance[a][b] = covariance[b][a];
+        }
+    }
+
+    u32 widest = 0;
+    for (u32 c = 1; c < channels; ++c) {
+        if (covariance[c][c] > covariance[widest][widest]) {
+            widest = c;
+        }
+    }
+    Pixel axis{};
+    for (u32 c = 0; c < channels; ++c) {
+        axis[c] = covariance[widest][c];
+    }
+    if (covariance[widest][widest] <= 0.0f) {
+        axis[0] = 1.0f; // Flat block: any axis works
+    }
+    for (u32 iteration = 0; iteration < 8; ++iteration) {
+        Pixel next{};
+        f32 length = 0.0f;
+        for (u32 a = 0; a < channels; ++a) {
+            for (u32 b = 0; b < channels; ++b) {
+                next[a] += covariance[a][b] * axis[b];
+            }
+            length = std::max(length, std::abs(next[a]));
+        }
+        if (length < 1e-6f) {
+            break; // Flat block: any axis works
+        }
+        for (u32 c = 0; c < channels; ++c) {
+            axis[c] = next[c] / length;
+        }
+    }
+
+    f32 axis_length_squared = 0.0f;
+    for (u32 c = 0; c < channels; ++c) {
+        axis_length_squared += axis[c] * axis[c];
+    }
+
+    f32 low = 0.0f;
+    f32 high = 0.0f;
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        f32 t = 0.0f;
+        for (u32 c = 0; c < channels; ++c) {
+            t += (pixels[i][c] - mean[c]) * axis[c];
+        }
+        low = std::min(low, t);
+        high = std::max(high, t);
+    }
+    for (u32 c = 0; c < channels; ++c) {
+        first[c] = clamp_byte(mean[c] + axis[c] * high / axis_length_squared);
+        second[c] = clamp_byte(mean[c] + axis[c] * low / axis_length_squared);
+    }
+}
+
+/**
+ * @brief Least-squares endpoints for fixed per-pixel weights
+ *
+ * Each pixel is modeled as weight * first + (1 - weight) * second.
+ *
+ * @return false if the weights cannot determine both endpoints
+ */
+bool refit_endpoints(const Pixel* pixels, const f32* weights, u32 channels, Pixel& first,
+                     Pixel& second) {
+    f32 aa = 0.0f;
+    f32 ab = 0.0f;
+    f32 bb = 0.0f;
+    Pixel ax{};
+    Pixel bx{};
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        const f32 a = weights[i];
+        const f32 b = 1.0f - a;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (u32 c = 0; c < channels; ++c) {
+            ax[c] += a * pixels[i][c];
+            bx[c] += b * pixels[i][c];
+        }
+    }
+    const f32 determinant = aa * bb - ab * ab;
+    if (std::abs(determinant) < 1e-6f) {
+        return false;
+    }
+    for (u32 c = 0; c < channels; ++c) {
+        first[c] = clamp_byte((bb * ax[c] - ab * bx[c]) / determinant);
+        second[c] = clamp_byte((aa * bx[c] - ab * ax[c]) / determinant);
+    }
+    return true;
+}
+
+void load_pixels(const u8* rgba, Pixel* pixels) {
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        for (u32 c = 0; c < 4; ++c) {
+            pixels[i][c] = static_cast<f32>(rgba[i * 4 + c]);
+        }
+    }
+}
+
+void write_bits(u8* block, u32& position, u32 value, u32 count) {
+    for (u32 bit = 0; bit < count; ++bit, ++position) {
+        if ((value >> bit) & 1u) {
+            block[position / 8] = static_cast<u8>(block[position / 8] | (1u << (position % 8)));
+        }
+    }
+}
+
+u32 read_bits(const u8* block, u32& position, u32 count) {
+    u32 value = 0;
+    for (u32 bit = 0; bit < count; ++bit, ++position) {
+        value |= static_cast<u32>((block[position / 8] >> (position % 8)) & 1u) << bit;
+    }
+    return value;
+}
+
+// ============================================================================
+// BC1 (color)
+// ============================================================================
+
+u16 pack_565(const Pixel& color) {
+    const auto r = static_cast<u32>(std::lround(color[0] * 31.0f / 255.0f));
+    const auto g = static_cast<u32>(std::lround(color[1] * 63.0f / 255.0f));
+    const auto b = static_cast<u32>(std::lround(color[2] * 31.0f / 255.0f));
+    return static_cast<u16>((r << 11) | (g << 5) | b);
+}
+
+Pixel unpack_565(u16 value) {
+    const u32 r = (value >> 11) & 31u;
+    const u32 g = (value >> 5) & 63u;
+    const u32 b = value & 31u;
+    return {static_cast<f32>((r << 3) | (r >> 2)), static_cast<f32>((g << 2) | (g >> 4)),
+            static_cast<f32>((b << 3) | (b >> 2)), 255.0f};
+}
+
+/// Palette as the decoder builds it; four_color is false for the BC1 3-color + black mode
+std::array<Pixel, 4> color_palette(u16 c0, u16 c1, bool four_color) {
+    std::array<Pixel, 4> palette{unpack_565(c0), unpack_565(c1), Pixel{}, Pixel{}};
+    for (u32 c = 0; c < 3; ++c) {
+        const u32 a = static_cast<u32>(palette[0][c]);
+        const u32 b = static_cast<u32>(palette[1][c]);
+        if (four_color) {
+            palette[2][c] = static_cast<f32>((2 * a + b) / 3);
+            palette[3][c] = static_cast<f32>((a + 2 * b) / 3);
+        } else {
+            palette[2][c] = static_cast<f32>((a + b) / 2);
+            palette[3][c] = 0.0f;
+        }
+    }
+    palette[2][3] = 255.0f;
+    palette[3][3] = four_color ? 255.0f : 0.0f;
+    return palette;
+}
+
+/// Pick indices for a pair of quantized endpoints; returns the total error
+f32 index_color_block(const Pixel* pixels, u16 c0, u16 c1, u32& indices) {
+    const auto palette = color_palette(c0, c1, true);
+    indices = 0;
+    f32 total = 0.0f;
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        u32 best = 0;
+        f32 best_error = std::numeric_limits<f32>::max();
+        for (u32 p = 0; p < 4; ++p) {
+            const f32 error = distance_squared(pixels[i], palette[p], 3);
+            if (error < best_error) {
+                best_error = error;
+                best = p;
+            }
+        }
+        indices |= best << (2 * i);
+        total += best_error;
+    }
+    return total;
+}
+
+void encode_color_block(const Pixel* pixels, u8* block) {
+    Pixel first{};
+    Pixel second{};
+    fit_principal_axis(pixels, 3, first, second);
+
+    u16 best_c0 = 0;
+    u16 best_c1 = 0;
+    u32 best_indices = 0;
+    f32 best_error = std::numeric_limits<f32>::max();
+    for (u32 pass = 0; pass < 2; ++pass) {
+        u16 c0 = pack_565(first);
+        u16 c1 = pack_565(second);
+        // c0 > c1 selects the 4-color mode, which BC3 decoders assume as well
+        if (c0 < c1) {
+            std::swap(c0, c1);
+        }
+        u32 indices = 0;
+        const f32 error = index_color_block(pixels, c0, c1, indices);
+        if (error < best_error) {
+            best_error = error;
+            best_c0 = c0;
+            best_c1 = c1;
+            best_indices = indices;
+        }
+        // Equal endpoints leave every index at 0, which decodes the same in either mode
+        if (c0 == c1) {
+            break;
+        }
+
+        constexpr f32 WEIGHTS[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+        f32 weights[BLOCK_PIXELS];
+        for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+            weights[i] = WEIGHTS[(indices >> (2 * i)) & 3u];
+        }
+        if (!refit_endpoints(pixels, weights, 3, first, second)) {
+            break;
+        }
+    }
+
+    std::memcpy(block, &best_c0, 2);
+    std::memcpy(block + 2, &best_c1, 2);
+    std::memcpy(block + 4, &best_indices, 4);
+}
+
+void decode_color_block(const u8* block, u8* rgba, bool force_four_color) {
+    u16 c0 = 0;
+    u16 c1 = 0;
+    u32 indices = 0;
+    std::memcpy(&c0, block, 2);
+    std::memcpy(&c1, block + 2, 2);
+    std::memcpy(&indices, block + 4, 4);
+    const auto palette = color_palette(c0, c1, force_four_color || c0 > c1);
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        const Pixel& color = palette[(indices >> (2 * i)) & 3u];
+        for (u32 c = 0; c < 4; ++c) {
+            rgba[i * 4 + c] = static_cast<u8>(color[c]);
+        }
+    }
+}
+
+// ============================================================================
+// BC4 (one channel, used by BC3 alpha and BC5)
+// ============================================================================
+
+std::array<u32, 8> channel_palette(u32 a0, u32 a1) {
+    std::array<u32, 8> palette{a0, a1, 0, 0, 0, 0, 0, 0};
+    if (a0 > a1) {
+        for (u32 k = 2; k < 8; ++k) {
+            palette[k] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+        }
+    } else {
+        for (u32 k = 2; k < 6; ++k) {
+            palette[k] = ((6 - k) * a0 + (k - 1) * a1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+    return palette;
+}
+
+void encode_channel_block(const u8* rgba, u32 channel, u8* block) {
+    u32 low = 255;
+    u32 high = 0;
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        low = std::min<u32>(low, rgba[i * 4 + channel]);
+        high = std::max<u32>(high, rgba[i * 4 + channel]);
+    }
+
+    // high > low selects the 8-value mode; a flat block uses index 0 throughout
+    const auto palette = channel_palette(high, low);
+    u64 indices = 0;
+    if (high != low) {
+        for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+            const u32 value = rgba[i * 4 + channel];
+            u32 best = 0;
+            u32 best_error = std::numeric_limits<u32>::max();
+            for (u32 k = 0; k < 8; ++k) {
+                const u32 error =
+                    value > palette[k] ? value - palette[k] : palette[k] - value;
+                if (error < best_error) {
+                    best_error = error;
+                    best = k;
+                }
+            }
+            indices |= static_cast<u64>(best) << (3 * i);
+        }
+    }
+
+    block[0] = static_cast<u8>(high);
+    block[1] = static_cast<u8>(low);
+    for (u32 byte = 0; byte < 6; ++byte) {
+        block[2 + byte] = static_cast<u8>(indices >> (8 * byte));
+    }
+}
+
+void decode_channel_block(const u8* block, u8* rgba, u32 channel) {
+    const auto palette = channel_palette(block[0], block[1]);
+    u64 indices = 0;
+    for (u32 byte = 0; byte < 6; ++byte) {
+        indices |= static_cast<u64>(block[2 + byte]) << (8 * byte);
+    }
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        rgba[i * 4 + channel] = static_cast<u8>(palette[(indices >> (3 * i)) & 7u]);
+    }
+}
+
+// ============================================================================
+// BC7 Mode 6 (RGBA, one subset, 7-bit endpoints + p-bit, 4-bit indices)
+// ============================================================================
+
+constexpr u32 BC7_WEIGHTS[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+struct Bc7Endpoint {
+    std::array<u32, 4> value; // 7-bit
+    u32 pbit;
+
+    [[nodiscard]] Pixel expand() const {
+        return {static_cast<f32>(value[0] << 1 | pbit), static_cast<f32>(value[1] << 1 | pbit),
+                static_cast<f32>(value[2] << 1 | pbit), static_cast<f32>(value[3] << 1 | pbit)};
+    }
+};
+
+/// Round an endpoint to 7 bits per channel plus a shared p-bit, picking the closer p-bit
+Bc7Endpoint quantize_bc7(const Pixel& color) {
+    Bc7Endpoint best{};
+    f32 best_error = std::numeric_limits<f32>::max();
+    for (u32 pbit = 0; pbit < 2; ++pbit) {
+        Bc7Endpoint candidate{};
+        candidate.pbit = pbit;
+        for (u32 c = 0; c < 4; ++c) {
+            const f32 q = std::round((color[c] - static_cast<f32>(pbit)) / 2.0f);
+            candidate.value[c] = static_cast<u32>(std::clamp(q, 0.0f, 127.0f));
+        }
+        const f32 error = distance_squared(candidate.expand(), color, 4);
+        if (error < best_error) {
+            best_error = error;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+std::array<Pixel, 16> bc7_palette(const Bc7Endpoint& e0, const Bc7Endpoint& e1) {
+    const Pixel a = e0.expand();
+    const Pixel b = e1.expand();
+    std::array<Pixel, 16> palette{};
+    for (u32 k = 0; k < 16; ++k) {
+        for (u32 c = 0; c < 4; ++c) {
+            const u32 value = ((64 - BC7_WEIGHTS[k]) * static_cast<u32>(a[c]) +
+                               BC7_WEIGHTS[k] * static_cast<u32>(b[c]) + 32) >>
+                              6;
+            palette[k][c] = static_cast<f32>(value);
+        }
+    }
+    return palette;
+}
+
+f32 index_bc7_block(const Pixel* pixels, const Bc7Endpoint& e0, const Bc7Endpoint& e1,
+                    std::array<u32, 16>& indices) {
+    const auto palette = bc7_palette(e0, e1);
+    f32 total = 0.0f;
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        u32 best = 0;
+        f32 best_error = std::numeric_limits<f32>::max();
+        for (u32 k = 0; k < 16; ++k) {
+            const f32 error = distance_squared(pixels[i], palette[k], 4);
+            if (error < best_error) {
+                best_error = error;
+                best = k;
+            }
+        }
+        indices[i] = best;
+        total += best_error;
+    }
+    return total;
+}
+
+void encode_bc7_block(const Pixel* pixels, u8* block) {
+    Pixel first{};
+    Pixel second{};
+    fit_principal_axis(pixels, 4, first, second);
+
+    Bc7Endpoint best_e0{};
+    Bc7Endpoint best_e1{};
+    std::array<u32, 16> best_indices{};
+    f32 best_error = std::numeric_limits<f32>::max();
+    for (u32 pass = 0; pass < 3; ++pass) {
+        const Bc7Endpoint e0 = quantize_bc7(first);
+        const Bc7Endpoint e1 = quantize_bc7(second);
+        std::array<u32, 16> indices{};
+        const f32 error = index_bc7_block(pixels, e0, e1, indices);
+        if (error < best_error) {
+            best_error = error;
+            best_e0 = e0;
+            best_e1 = e1;
+            best_indices = indices;
+        }
+        if (error == 0.0f) {
+            break;
+        }
+
+        f32 weights[BLOCK_PIXELS];
+        for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+            weights[i] = 1.0f - static_cast<f32>(BC7_WEIGHTS[indices[i]]) / 64.0f;
+        }
+        if (!refit_endpoints(pixels, weights, 4, first, second)) {
+            break;
+        }
+    }
+
+    // The first index is stored without its top bit, so it must be below 8
+    if (best_indices[0] >= 8) {
+        std::swap(best_e0, best_e1);
+        for (u32& index : best_indices) {
+            index = 15 - index;
+        }
+    }
+
+    std::memset(block, 0, 16);
+    u32 position = 0;
+    write_bits(block, position, 1u << 6, 7); // Mode 6
+    for (u32 c = 0; c < 4; ++c) {
+        write_bits(block, position, best_e0.value[c], 7);
+        write_bits(block, position, best_e1.value[c], 7);
+    }
+    write_bits(block, position, best_e0.pbit, 1);
+    write_bits(block, position, best_e1.pbit, 1);
+    write_bits(block, position, best_indices[0], 3);
+    for (u32 i = 1; i < BLOCK_PIXELS; ++i) {
+        write_bits(block, position, best_indices[i], 4);
+    }
+}
+
+bool decode_bc7_block(const u8* block, u8* rgba) {
+    if ((block[0] & 0x7F) != 0x40) {
+        return false; // Only mode 6 is supported
+    }
+
+    u32 position = 7;
+    Bc7Endpoint e0{};
+    Bc7Endpoint e1{};
+    for (u32 c = 0; c < 4; ++c) {
+        e0.value[c] = read_bits(block, position, 7);
+        e1.value[c] = read_bits(block, position, 7);
+    }
+    e0.pbit = read_bits(block, position, 1);
+    e1.pbit = read_bits(block, position, 1);
+
+    const auto palette = bc7_palette(e0, e1);
+    for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+        const u32 index = read_bits(block, position, i == 0 ? 3 : 4);
+        for (u32 c = 0; c < 4; ++c) {
+            rgba[i * 4 + c] = static_cast<u8>(palette[index][c]);
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Mip Filtering
+// ============================================================================
+
+const std::array<f32, 256>& srgb_to_linear_table() {
+    static const std::array<f32, 256> table = [] {
+        std::array<f32, 256> values{};
+        for (u32 i = 0; i < 256; ++i) {
+            const f32 c = static_cast<f32>(i) / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+u8 linear_to_srgb(f32 linear) {
+    const f32 c = linear <= 0.0031308f ? linear * 12.92f
+                                       : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+    return static_cast<u8>(std::lround(std::clamp(c, 0.0f, 1.0f) * 255.0f));
+}
+
+/// Expand any uncompressed TextureImage to RGBA8, as GL would sample it
+std::vector<u8> to_rgba8(const TextureImage& image) {
+    u32 channels = 4;
+    switch (image.format) {
+    case TextureFormat::R8:
+        channels = 1;
+        break;
+    case TextureFormat::RG8:
+        channels = 2;
+        break;
+    case TextureFormat::RGB8:
+    case TextureFormat::SRGB8:
+        channels = 3;
+        break;
+    default:
+        break;
+    }
+
+    const usize count = static_cast<usize>(image.width) * image.height;
+    std::vector<u8> rgba(count * 4);
+    for (usize i = 0; i < count; ++i) {
+        const u8* source = image.pixels.data() + i * channels;
+        u8* target = rgba.data() + i * 4;
+        target[0] = source[0];
+        target[1] = channels > 1 ? source[1] : 0;
+        target[2] = channels > 2 ? source[2] : 0;
+        target[3] = channels > 3 ? source[3] : 255;
+    }
+    return rgba;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+usize compressed_size(TextureFormat format, u32 width, u32 height) noexcept {
+    const usize blocks_x = (static_cast<usize>(width) + 3) / 4;
+    const usize blocks_y = (static_cast<usize>(height) + 3) / 4;
+    return blocks_x * blocks_y * block_bytes(format);
+}
+
+void encode_block(TextureFormat format, const u8* rgba, u8* block) {
+    Pixel pixels[BLOCK_PIXELS];
+    load_pixels(rgba, pixels);
+
+    switch (format) {
+    case TextureFormat::BC1:
+    case TextureFormat::BC1_SRGB:
+        encode_color_block(pixels, block);
+        break;
+    case TextureFormat::BC3:
+    case TextureFormat::BC3_SRGB:
+        encode_channel_block(rgba, 3, block);
+        encode_color_block(pixels, block + 8);
+        break;
+    case TextureFormat::BC5:
+        encode_channel_block(rgba, 0, block);
+        encode_channel_block(rgba, 1, block + 8);
+        break;
+    case TextureFormat::BC7:
+    case TextureFormat::BC7_SRGB:
+        encode_bc7_block(pixels, block);
+        break;
+    default:
+        break;
+    }
+}
+
+bool decode_block(TextureFormat format, const u8* block, u8* rgba) {
+    switch (format) {
+    case TextureFormat::BC1:
+    case TextureFormat::BC1_SRGB:
+        decode_color_block(block, rgba, false);
+        return true;
+    case TextureFormat::BC3:
+    case TextureFormat::BC3_SRGB:
+        decode_color_block(block + 8, rgba, true);
+        decode_channel_block(block, rgba, 3);
+        return true;
+    case TextureFormat::BC5:
+        decode_channel_block(block, rgba, 0);
+        decode_channel_block(block + 8, rgba, 1);
+        for (u32 i = 0; i < BLOCK_PIXELS; ++i) {
+            rgba[i * 4 + 2] = 0;
+            rgba[i * 4 + 3] = 255;
+        }
+        return true;
+    case TextureFormat::BC7:
+    case TextureFormat::BC7_SRGB:
+        return decode_bc7_block(block, rgba);
+    default:
+        return false;
+    }
+}
+
+std::vector<u8> compress_image(TextureFormat format, const u8* rgba, u32 width, u32 height) {
+    const u32 blocks_x = (width + 3) / 4;
+    const u32 blocks_y = (height + 3) / 4;
+    const u32 stride = block_bytes(format);
+    std::vector<u8> blocks(compressed_size(format, width, height));
+    if (blocks.empty()) {
+        return blocks;
+    }
+
+    JobSystem::parallel_for(blocks_y, [&](usize begin, usize end) {
+        u8 pixels[BLOCK_PIXELS * 4];
+        for (usize by = begin; by < end; ++by) {
+            for (u32 bx = 0; bx < blocks_x; ++bx) {
+                for (u32 y = 0; y < 4; ++y) {
+                    const u32 source_y = std::min(static_cast<u32>(by) * 4 + y, height - 1);
+                    for (u32 x = 0; x < 4; ++x) {
+                        const u32 source_x = std::min(bx * 4 + x, width - 1);
+                        std::memcpy(pixels + (y * 4 + x) * 4,
+                                    rgba + (static_cast<usize>(source_y) * width + source_x) * 4,
+                                    4);
+                    }
+                }
+                encode_block(format, pixels, blocks.data() + (by * blocks_x + bx) * stride);
+            }
+        }
+    });
+    return blocks;
+}
+
+std::vector<u8> decompress_image(TextureFormat format, const u8* blocks, u32 width, u32 height) {
+    const u32 blocks_x = (width + 3) / 4;
+    const u32 blocks_y = (height + 3) / 4;
+    const u32 stride = block_bytes(format);
+    if (stride == 0) {
+        return {};
+    }
+
+    std::vector<u8> rgba(static_cast<usize>(width) * height * 4);
+    u8 pixels[BLOCK_PIXELS * 4];
+    for (u32 by = 0; by < blocks_y; ++by) {
+        for (u32 bx = 0; bx < blocks_x; ++bx) {
+            if (!decode_block(format, blocks + (static_cast<usize>(by) * blocks_x + bx) * stride,
+                              pixels)) {
+                return {};
+            }
+            for (u32 y = 0; y < 4 && by * 4 + y < height; ++y) {
+                for (u32 x = 0; x < 4 && bx * 4 + x < width; ++x) {
+                    std::memcpy(
+                        rgba.data() + (static_cast<usize>(by * 4 + y) * width + bx * 4 + x) * 4,
+                        pixels + (y * 4 + x) * 4, 4);
+                }
+            }
+        }
+    }
+    return rgba;
+}
+
+std::vector<u8> downsample_image(const u8* rgba, u32 width, u32 height, bool srgb) {
+    const u32 target_width = mip_extent(width, 1);
+    const u32 target_height = mip_extent(height, 1);
+    const auto& to_linear = srgb_to_linear_table();
+
+    std::vector<u8> target(static_cast<usize>(target_width) * target_height * 4);
+    for (u32 y = 0; y < target_height; ++y) {
+        for (u32 x = 0; x < target_width; ++x) {
+            f32 sum[4] = {};
+            for (u32 dy = 0; dy < 2; ++dy) {
+                for (u32 dx = 0; dx < 2; ++dx) {
+                    const u32 sx = std::min(x * 2 + dx, width - 1);
+                    const u32 sy = std::min(y * 2 + dy, height - 1);
+                    const u8* source = rgba + (static_cast<usize>(sy) * width + sx) * 4;
+                    for (u32 c = 0; c < 4; ++c) {
+                        sum[c] += srgb && c < 3 ? to_linear[source[c]]
+                                                : static_cast<f32>(source[c]);
+                    }
+                }
+            }
+            u8* out = target.data() + (static_cast<usize>(y) * target_width + x) * 4;
+            for (u32 c = 0; c < 4; ++c) {
+                out[c] = srgb && c < 3 ? linear_to_srgb(sum[c] / 4.0f)
+                                       : static_cast<u8>(std::lround(sum[c] / 4.0f));
+            }
+        }
+    }
+    return target;
+}
+
+TextureImage drop_top_mips(const TextureImage& image, u32 first_mip) {
+    if (!image.is_valid() || first_mip == 0) {
+        return image;
+    }
+
+    TextureImage result;
+    result.path = image.path;
+    if (is_block_compressed(image.format)) {
+        first_mip = std::min(first_mip, image.mip_count - 1);
+        usize offset = 0;
+        for (u32 level = 0; level < first_mip; ++level) {
+            offset += compressed_size(image.format, mip_extent(image.width, level),
+                                      mip_extent(image.height, level));
+        }
+        result.width = mip_extent(image.width, first_mip);
+        result.height = mip_extent(image.height, first_mip);
+        result.format = image.format;
+        result.mip_count = image.mip_count - first_mip;
+        result.pixels.assign(image.pixels.begin() + static_cast<std::ptrdiff_t>(offset),
+                             image.pixels.end());
+        return result;
+    }
+
+    const bool srgb = image.format == TextureFormat::SRGB8 || image.format == TextureFormat::SRGBA8;
+    first_mip = std::min(first_mip, full_mip_count(image.width, image.height) - 1);
+    std::vector<u8> level = to_rgba8(image);
+    u32 width = image.width;
+    u32 height = image.height;
+    for (u32 i = 0; i < first_mip; ++i) {
+        level = downsample_image(level.data(), width, height, srgb);
+        width = mip_extent(width, 1);
+        height = mip_extent(height, 1);
+    }
+    result.width = width;
+    result.height = height;
+    result.format = srgb ? TextureFormat::SRGBA8 : TextureFormat::RGBA8;
+    result.pixels = std::move(level);
+    return result;
+}
+
+TextureImage compress_texture(const TextureImage& image, TextureFormat format, bool srgb_mips) {
+    if (!image.is_valid() || is_block_compressed(image.format) || !is_block_compressed(format)) {
+        return {};
+    }
+
+    TextureImage result;
+    result.width = image.width;
+    result.height = image.height;
+    result.format = format;
+    result.path = image.path;
+    result.mip_count = 0;
+
+    std::vector<u8> level = to_rgba8(image);
+    u32 width = image.width;
+    u32 height = image.height;
+    while (true) {
+        const std::vector<u8> blocks = compress_image(format, level.data(), width, height);
+        result.pixels.insert(result.pixels.end(), blocks.begin(), blocks.end());
+        ++result.mip_count;
+        if (width == 1 && height == 1) {
+            break;
+        }
+        level = downsample_image(level.data(), width, height, srgb_mips);
+        width = mip_extent(width, 1);
+        height = mip_extent(height, 1);
+    }
+    return result;
+}
+
+} // namespace hz
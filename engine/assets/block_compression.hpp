@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file block_compression.hpp
+ * @brief CPU encoder and decoder for BC1, BC3, BC5 and BC7 textures
+ *
+ * Block-compressed textures stay compressed in VRAM: BC1 is 4 bits per pixel,
+ * BC3, BC5 and BC7 are 8, against 32 for RGBA8. The encoder needs no GPU, so
+ * horizon_cook can compress textures on build machines.
+ *
+ * Every format works on 4x4 blocks of RGBA8 pixels:
+ * - BC1: RGB, alpha ignored
+ * - BC3: RGB plus a separately encoded alpha channel
+ * - BC5: red and green only, for tangent-space normal maps
+ * - BC7: RGBA at the best quality of the four; the encoder writes mode 6 only
+ *   (one subset, 4-bit indices), which any BC7 decoder reads
+ */
+
+#include "engine/assets/texture.hpp"
+#include "engine/core/types.hpp"
+
+#include <vector>
+
+namespace hz {
+
+/**
+ * @brief Bytes per 4x4 block, or 0 for uncompressed formats
+ */
+[[nodiscard]] constexpr u32 block_bytes(TextureFormat format) noexcept {
+    switch (format) {
+    case TextureFormat::BC1:
+    case TextureFormat::BC1_SRGB:
+        return 8;
+    case TextureFormat::BC3:
+    case TextureFormat::BC3_SRGB:
+    case TextureFormat::BC5:
+    case TextureFormat::BC7:
+    case TextureFormat::BC7_SRGB:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+[[nodiscard]] constexpr bool is_block_compressed(TextureFormat format) noexcept {
+    return block_bytes(format) != 0;
+}
+
+/**
+ * @brief Size of one compressed mip level, in bytes
+ */
+[[nodiscard]] usize compressed_size(TextureFormat format, u32 width, u32 height) noexcept;
+
+/**
+ * @brief Extent of a mip level (never below 1)
+ */
+[[nodiscard]] constexpr u32 mip_extent(u32 size, u32 level) noexcept {
+    return (size >> level) > 0 ? size >> level : 1;
+}
+
+/**
+ * @brief Levels in a full mip chain, down to 1x1
+ */
+[[nodiscard]] constexpr u32 full_mip_count(u32 width, u32 height) noexcept {
+    u32 count = 1;
+    for (u32 size = width > height ? width : height; size > 1; size >>= 1) {
+        ++count;
+    }
+    return count;
+}
+
+// ============================================================================
+// Blocks
+// ============================================================================
+
+/**
+ * @brief Encode one 4x4 block of RGBA8 pixels (row by row) into block_bytes(format) bytes
+ */
+void encode_block(TextureFormat format, const u8* rgba, u8* block);
+
+/**
+ * @brief Decode one block into 4x4 RGBA8 pixels
+ *
+ * @return false for BC7 blocks in a mode other than 6, or an uncompressed format
+ */
+[[nodiscard]] bool decode_block(TextureFormat format, const u8* block, u8* rgba);
+
+// ============================================================================
+// Images
+// ============================================================================
+
+/**
+ * @brief Compress an RGBA8 image; edge pixels repeat to fill partial blocks
+ *
+ * Block rows are encoded on the JobSystem.
+ */
+[[nodiscard]] std::vector<u8> compress_image(TextureFormat format, const u8* rgba, u32 width,
+                                             u32 height);
+
+/**
+ * @brief Decompress one mip level to RGBA8
+ *
+ * @return An empty vector if a block cannot be decoded
+ */
+[[nodiscard]] std::vector<u8> decompress_image(TextureFormat format, const u8* blocks, u32 width,
+                                               u32 height);
+
+/**
+ * @brief Halve an RGBA8 image with a 2x2 box filter
+ *
+ * @param srgb Average color channels in linear light; alpha is always linear
+ */
+[[nodiscard]] std::vector<u8> downsample_image(const u8* rgba, u32 width, u32 height, bool srgb);
+
+/**
+ * @brief Drop the levels above first_mip, so first_mip becomes level 0
+ *
+ * Block-compressed images keep their stored levels from first_mip down.
+ * Uncompressed images hold only level 0; they are box-filtered down to
+ * first_mip as RGBA8 (SRGBA8 for sRGB formats), leaving the rest of the chain
+ * to glGenerateMipmap. first_mip is clamped to the last level.
+ */
+[[nodiscard]] TextureImage drop_top_mips(const TextureImage& image, u32 first_mip);
+
+/**
+ * @brief Compress a decoded image and its full mip chain, down to 1x1
+ *
+ * The result's pixels hold every level back to back, largest first.
+ *
+ * @param srgb_mips Filter mips in linear light (color textures)
+ */
+[[nodiscard]] TextureImage compress_texture(const TextureImage& image, TextureFormat format,
+                                            bool srgb_mips);
+
+} // namespace hz
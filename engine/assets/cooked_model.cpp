@@ -0,0 +1,398 @@
+#include "cooked_model.hpp"
+
+#include "engine/core/byte_stream.hpp"
+#include "engine/core/log.hpp"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace hz {
+
+namespace {
+
+static_assert(std::endian::native == std::endian::little, "Cooked models are stored little-endian");
+static_assert(sizeof(CookedModelHeader) == 32 && sizeof(CookedMesh) == 24);
+static_assert(std::is_trivially_copyable_v<Vertex> && alignof(Vertex) <= 16);
+
+constexpr usize BLOCK_ALIGNMENT = 16;
+
+usize align_up(usize value) {
+    return (value + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+}
+
+// ============================================================================
+// Packed Block
+// ============================================================================
+
+void write_string(ByteWriter& out, const std::string& value) {
+    out.write_value(static_cast<u32>(value.size()));
+    out.write(value.data(), value.size());
+}
+
+[[nodiscard]] bool read_string(ByteReader& in, std::string& value) {
+    u32 size = 0;
+    if (!in.read_value(size) || size > in.remaining()) {
+        return false;
+    }
+    value.resize(size);
+    return in.read(value.data(), size);
+}
+
+template <typename T>
+void write_array(ByteWriter& out, const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write_value(static_cast<u32>(values.size()));
+    out.write(values.data(), values.size() * sizeof(T));
+}
+
+template <typename T>
+[[nodiscard]] bool read_array(ByteReader& in, std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    u32 count = 0;
+    if (!in.read_value(count) || u64{count} * sizeof(T) > in.remaining()) {
+        return false;
+    }
+    values.resize(count);
+    return in.read(values.data(), values.size() * sizeof(T));
+}
+
+void write_skeleton(ByteWriter& out, const Skeleton& skeleton) {
+    out.write_value(skeleton.global_inverse_transform());
+    out.write_value(skeleton.bone_count());
+    for (u32 id = 0; id < skeleton.bone_count(); ++id) {
+        const Bone& bone = *skeleton.get_bone(static_cast<i32>(id));
+        write_string(out, bone.name);
+        out.write_value(bone.parent_id);
+        out.write_value(bone.offset_matrix);
+        out.write_value(bone.position);
+        out.write_value(bone.rotation);
+        out.write_value(bone.scale);
+        write_array(out, bone.children);
+    }
+}
+
+[[nodiscard]] bool read_skeleton(ByteReader& in, Skeleton& skeleton) {
+    glm::mat4 global_inverse{1.0f};
+    u32 bone_count = 0;
+    if (!in.read_value(global_inverse) || !in.read_value(bone_count)) {
+        return false;
+    }
+    skeleton.set_global_inverse_transform(global_inverse);
+
+    const auto valid_bone = [bone_count](i32 id) {
+        return id >= 0 && static_cast<u32>(id) < bone_count;
+    };
+    for (u32 id = 0; id < bone_count; ++id) {
+        std::string name;
+        i32 parent_id = -1;
+        glm::mat4 offset{1.0f};
+        if (!read_string(in, name) || !in.read_value(parent_id) || !in.read_value(offset) ||
+            (parent_id != -1 && !valid_bone(parent_id))) {
+            return false;
+        }
+        Bone& bone = *skeleton.get_bone(skeleton.add_bone(name, parent_id, offset));
+        if (!in.read_value(bone.position) || !in.read_value(bone.rotation) ||
+            !in.read_value(bone.scale) || !read_array(in, bone.children)) {
+            return false;
+        }
+        for (const i32 child : bone.children) {
+            if (!valid_bone(child)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void write_animation(ByteWriter& out, const AnimationClip& clip) {
+    write_string(out, clip.name);
+    out.write_value(clip.duration);
+    out.write_value(clip.ticks_per_second);
+    out.write_value(static_cast<u32>(clip.channels.size()));
+    for (const BoneAnimation& channel : clip.channels) {
+        write_string(out, channel.bone_name);
+        out.write_value(channel.bone_id);
+        write_array(out, channel.position_keys);
+        write_array(out, channel.rotation_keys);
+        write_array(out, channel.scale_keys);
+    }
+}
+
+[[nodiscard]] bool read_animation(ByteReader& in, AnimationClip& clip) {
+    u32 channel_count = 0;
+    if (!read_string(in, clip.name) || !in.read_value(clip.duration) ||
+        !in.read_value(clip.ticks_per_second) || !in.read_value(channel_count) ||
+        channel_count > in.remaining()) {
+        return false;
+    }
+    clip.channels.resize(channel_count);
+    for (BoneAnimation& channel : clip.channels) {
+        if (!read_string(in, channel.bone_name) || !in.read_value(channel.bone_id) ||
+            !read_array(in, channel.position_keys) || !read_array(in, channel.rotation_keys) ||
+            !read_array(in, channel.scale_keys)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void write_texture_source(ByteWriter& out, const TextureSource& source) {
+    write_string(out, source.path);
+    write_array(out, source.embedded);
+    out.write_value(static_cast<u8>(source.srgb));
+}
+
+[[nodiscard]] bool read_texture_source(ByteReader& in, TextureSource& source) {
+    u8 srgb = 0;
+    if (!read_string(in, source.path) || !read_array(in, source.embedded) ||
+        !in.read_value(srgb)) {
+        return false;
+    }
+    source.srgb = srgb != 0;
+    return true;
+}
+
+void write_material(ByteWriter& out, const MaterialData& material) {
+    write_string(out, material.name);
+    write_texture_source(out, material.albedo_texture);
+    write_texture_source(out, material.normal_texture);
+    write_texture_source(out, material.metallic_roughness_texture);
+    write_texture_source(out, material.ao_texture);
+    write_texture_source(out, material.emissive_texture);
+    out.write_value(material.albedo_color);
+    out.write_value(material.metallic);
+    out.write_value(material.roughness);
+    out.write_value(material.emissive_color);
+}
+
+[[nodiscard]] bool read_material(ByteReader& in, MaterialData& material) {
+    return read_string(in, material.name) && read_texture_source(in, material.albedo_texture) &&
+           read_texture_source(in, material.normal_texture) &&
+           read_texture_source(in, material.metallic_roughness_texture) &&
+           read_texture_source(in, material.ao_texture) &&
+           read_texture_source(in, material.emissive_texture) &&
+           in.read_value(material.albedo_color) && in.read_value(material.metallic) &&
+           in.read_value(material.roughness) && in.read_value(material.emissive_color);
+}
+
+void write_extras(ByteWriter& out, const ModelData& data) {
+    out.write_value(static_cast<u8>(data.skeleton != nullptr));
+    if (data.skeleton) {
+        write_skeleton(out, *data.skeleton);
+    }
+    out.write_value(static_cast<u32>(data.animations.size()));
+    for (const auto& clip : data.animations) {
+        write_animation(out, *clip);
+    }
+    out.write_value(static_cast<u32>(data.materials.size()));
+    for (const MaterialData& material : data.materials) {
+        write_material(out, material);
+    }
+}
+
+[[nodiscard]] bool read_extras(ByteReader& in, ModelData& data) {
+    u8 has_skeleton = 0;
+    if (!in.read_value(has_skeleton)) {
+        return false;
+    }
+    if (has_skeleton != 0) {
+        data.skeleton = std::make_shared<Skeleton>();
+        if (!read_skeleton(in, *data.skeleton)) {
+            return false;
+        }
+    }
+
+    u32 animation_count = 0;
+    if (!in.read_value(animation_count) || animation_count > in.remaining()) {
+        return false;
+    }
+    for (u32 i = 0; i < animation_count; ++i) {
+        auto clip = std::make_shared<AnimationClip>();
+        if (!read_animation(in, *clip)) {
+            return false;
+        }
+        data.animations.push_back(std::move(clip));
+    }
+
+    u32 material_count = 0;
+    if (!in.read_value(material_count) || material_count > in.remaining()) {
+        return false;
+    }
+    data.materials.resize(material_count);
+    for (MaterialData& material : data.materials) {
+        if (!read_material(in, material)) {
+            return false;
+        }
+    }
+    return in.remaining() == 0;
+}
+
+/**
+ * @brief True if [offset, offset + size) lies inside a file of file_size bytes
+ */
+bool block_in_file(u64 offset, u64 size, usize file_size) {
+    return offset % BLOCK_ALIGNMENT == 0 && offset <= file_size && size <= file_size - offset;
+}
+
+} // namespace
+
+// ============================================================================
+// Cooked Files
+// ============================================================================
+
+std::filesystem::path cooked_model_path(const std::filesystem::path& source) {
+    std::filesystem::path cooked = source;
+    cooked += COOKED_MODEL_EXTENSION;
+    return cooked;
+}
+
+bool is_cooked_model_current(const std::filesystem::path& source) {
+    return is_cooked_file_current(source, cooked_model_path(source));
+}
+
+bool is_cooked_file_current(const std::filesystem::path& source,
+                            const std::filesystem::path& cooked) {
+    std::error_code error;
+    const auto cooked_time = std::filesystem::last_write_time(cooked, error);
+    if (error) {
+        return false;
+    }
+    const auto source_time = std::filesystem::last_write_time(source, error);
+    // A cooked file without its source (a shipped build) is always current
+    return error || cooked_time >= source_time;
+}
+
+bool write_cooked_model(const ModelData& data, const std::filesystem::path& path) {
+    std::vector<u8> extras;
+    ByteWriter extras_out(extras);
+    write_extras(extras_out, data);
+
+    // Layout: header, mesh table, each mesh's vertex and index blocks, then the extras
+    CookedModelHeader header{};
+    std::memcpy(header.magic, COOKED_MODEL_MAGIC, sizeof(COOKED_MODEL_MAGIC));
+    header.version = COOKED_MODEL_VERSION;
+    header.vertex_size = sizeof(Vertex);
+    header.mesh_count = static_cast<u32>(data.meshes.size());
+
+    std::vector<CookedMesh> meshes(data.meshes.size());
+    usize offset = align_up(sizeof(CookedModelHeader) + meshes.size() * sizeof(CookedMesh));
+    for (usize i = 0; i < meshes.size(); ++i) {
+        const MeshData& mesh = data.meshes[i];
+        meshes[i].vertex_count = static_cast<u32>(mesh.vertices.size());
+        meshes[i].index_count = static_cast<u32>(mesh.indices.size());
+        meshes[i].vertex_offset = offset;
+        offset = align_up(offset + mesh.vertices.size() * sizeof(Vertex));
+        meshes[i].index_offset = offset;
+        offset = align_up(offset + mesh.indices.size() * sizeof(u32));
+    }
+    header.extras_offset = offset;
+    header.extras_size = extras.size();
+
+    std::vector<u8> bytes(offset + extras.size());
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    if (!meshes.empty()) {
+        std::memcpy(bytes.data() + sizeof(header), meshes.data(),
+                    meshes.size() * sizeof(CookedMesh));
+    }
+    for (usize i = 0; i < meshes.size(); ++i) {
+        const MeshData& mesh = data.meshes[i];
+        if (!mesh.vertices.empty()) {
+            std::memcpy(bytes.data() + meshes[i].vertex_offset, mesh.vertices.data(),
+                        mesh.vertices.size() * sizeof(Vertex));
+        }
+        if (!mesh.indices.empty()) {
+            std::memcpy(bytes.data() + meshes[i].index_offset, mesh.indices.data(),
+                        mesh.indices.size() * sizeof(u32));
+        }
+    }
+    std::memcpy(bytes.data() + header.extras_offset, extras.data(), extras.size());
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        HZ_ENGINE_ERROR("Failed to open file for writing: {}", path.string());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        HZ_ENGINE_ERROR("Failed to write cooked model: {}", path.string());
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Cooked Model
+// ============================================================================
+
+bool CookedModel::open(const std::filesystem::path& path) {
+    m_meshes.clear();
+    m_extras = {};
+    if (!m_file.open(path)) {
+        HZ_ENGINE_ERROR("Failed to open cooked model: {}", path.string());
+        return false;
+    }
+
+    const auto fail = [&](const char* reason) {
+        HZ_ENGINE_ERROR("Invalid cooked model {}: {}", path.string(), reason);
+        m_file.close();
+        m_meshes.clear();
+        m_extras = {};
+        return false;
+    };
+
+    const usize file_size = m_file.size();
+    CookedModelHeader header{};
+    if (file_size < sizeof(header)) {
+        return fail("file is truncated");
+    }
+    std::memcpy(&header, m_file.data(), sizeof(header));
+    if (std::memcmp(header.magic, COOKED_MODEL_MAGIC, sizeof(COOKED_MODEL_MAGIC)) != 0) {
+        return fail("not a cooked model");
+    }
+    if (header.version != COOKED_MODEL_VERSION || header.vertex_size != sizeof(Vertex)) {
+        return fail("cooked by another engine version; cook it again");
+    }
+    if (!block_in_file(sizeof(header), u64{header.mesh_count} * sizeof(CookedMesh), file_size) ||
+        !block_in_file(header.extras_offset, header.extras_size, file_size)) {
+        return fail("file is truncated");
+    }
+
+    m_meshes.resize(header.mesh_count);
+    if (!m_meshes.empty()) {
+        std::memcpy(m_meshes.data(), m_file.data() + sizeof(header),
+                    m_meshes.size() * sizeof(CookedMesh));
+    }
+    for (const CookedMesh& mesh : m_meshes) {
+        const u64 vertex_bytes = u64{mesh.vertex_count} * sizeof(Vertex);
+        const u64 index_bytes = u64{mesh.index_count} * sizeof(u32);
+        if (!block_in_file(mesh.vertex_offset, vertex_bytes, file_size) ||
+            !block_in_file(mesh.index_offset, index_bytes, file_size)) {
+            return fail("mesh block out of bounds");
+        }
+    }
+
+    ByteReader extras(m_file.bytes().subspan(header.extras_offset, header.extras_size));
+    if (!read_extras(extras, m_extras)) {
+        return fail("skeleton, animation or material data is corrupt");
+    }
+    return true;
+}
+
+std::span<const Vertex> CookedModel::vertices(u32 mesh) const {
+    const CookedMesh& entry = m_meshes[mesh];
+    return {reinterpret_cast<const Vertex*>(m_file.data() + entry.vertex_offset),
+            entry.vertex_count};
+}
+
+std::span<const u32> CookedModel::indices(u32 mesh) const {
+    const CookedMesh& entry = m_meshes[mesh];
+    return {reinterpret_cast<const u32*>(m_file.data() + entry.index_offset), entry.index_count};
+}
+
+} // namespace hz
@@ -0,0 +1,121 @@
+#pragma once
+
+/**
+ * @file cooked_model.hpp
+ * @brief Packed model format written by horizon_cook and mapped at runtime
+ *
+ * A cooked model (.hzmesh) stores each mesh's Vertex and index arrays exactly
+ * as Mesh uploads them, so a load maps the file and hands every block to GL
+ * without touching a vertex: no parsing, no tangent generation, no
+ * deduplication. The skeleton, animations and material descriptions follow in
+ * one small packed block.
+ *
+ * Cooked files sit next to their source (character.fbx.hzmesh next to
+ * character.fbx). Model::load_from_file() uses the cooked file while it is at
+ * least as new as the source.
+ */
+
+#include "engine/assets/model.hpp"
+#include "engine/core/types.hpp"
+#include "engine/platform/mapped_file.hpp"
+
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace hz {
+
+// ============================================================================
+// File Format
+// ============================================================================
+
+/// Bump when the header, a mesh entry, the packed block or Vertex changes
+inline constexpr u32 COOKED_MODEL_VERSION = 1;
+inline constexpr char COOKED_MODEL_MAGIC[4] = {'H', 'Z', 'M', 'D'};
+inline constexpr const char* COOKED_MODEL_EXTENSION = ".hzmesh";
+
+/**
+ * @brief Start of a cooked model, followed by mesh_count CookedMesh entries
+ *
+ * Blocks are 16-byte aligned. Values are stored in native (little-endian)
+ * layout.
+ */
+struct CookedModelHeader {
+    char magic[4];
+    u32 version;
+    u32 vertex_size; // sizeof(Vertex) when cooked
+    u32 mesh_count;
+    u64 extras_offset; // Packed skeleton, animations and materials
+    u64 extras_size;
+};
+
+/**
+ * @brief Location of one mesh's vertex (Vertex[]) and index (u32[]) blocks
+ */
+struct CookedMesh {
+    u64 vertex_offset;
+    u64 index_offset;
+    u32 vertex_count;
+    u32 index_count;
+};
+
+/**
+ * @brief Path of the cooked file for a source model
+ */
+[[nodiscard]] std::filesystem::path cooked_model_path(const std::filesystem::path& source);
+
+/**
+ * @brief True if the source's cooked file exists and is not older than the source
+ */
+[[nodiscard]] bool is_cooked_model_current(const std::filesystem::path& source);
+
+/**
+ * @brief True if cooked exists and is not older than source
+ *
+ * A cooked file without its source (a shipped build) is always current.
+ */
+[[nodiscard]] bool is_cooked_file_current(const std::filesystem::path& source,
+                                          const std::filesystem::path& cooked);
+
+/**
+ * @brief Write imported model data as a cooked model
+ */
+bool write_cooked_model(const ModelData& data, const std::filesystem::path& path);
+
+// ============================================================================
+// Cooked Model
+// ============================================================================
+
+/**
+ * @brief A mapped, validated cooked model
+ *
+ * open() checks every block against the file size and decodes the packed
+ * block. Index values are not scanned; they are trusted as written by the
+ * cooker. Vertex and index spans point into the mapping and stay valid until
+ * the CookedModel is destroyed or opens another file.
+ */
+class CookedModel {
+public:
+    CookedModel() = default;
+
+    /**
+     * @return false if the file is missing, of another version or corrupt
+     */
+    [[nodiscard]] bool open(const std::filesystem::path& path);
+
+    [[nodiscard]] u32 mesh_count() const noexcept { return static_cast<u32>(m_meshes.size()); }
+    [[nodiscard]] std::span<const Vertex> vertices(u32 mesh) const;
+    [[nodiscard]] std::span<const u32> indices(u32 mesh) const;
+
+    /**
+     * @brief Skeleton, animations and materials; meshes are left empty
+     */
+    [[nodiscard]] ModelData& extras() noexcept { return m_extras; }
+
+private:
+    MappedFile m_file;
+    std::vector<CookedMesh> m_meshes;
+    ModelData m_extras;
+};
+
+} // namespace hz
@@ -0,0 +1,285 @@
+#include "cooked_texture.hpp"
+
+#include "block_compression.hpp"
+#include "cooked_model.hpp"
+#include "engine/core/byte_stream.hpp"
+#include "engine/core/log.hpp"
+#include "engine/platform/mapped_file.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <vector>
+
+namespace hz {
+
+namespace {
+
+static_assert(std::endian::native == std::endian::little, "DDS files are little-endian");
+
+// ============================================================================
+// DDS Layout
+// ============================================================================
+
+constexpr u32 DDS_MAGIC = 0x20534444; // "DDS "
+constexpr u32 DDS_HEADER_SIZE = 124;
+constexpr u32 DDS_PIXEL_FORMAT_SIZE = 32;
+
+constexpr u32 DDSD_CAPS = 0x1;
+constexpr u32 DDSD_HEIGHT = 0x2;
+constexpr u32 DDSD_WIDTH = 0x4;
+constexpr u32 DDSD_PIXELFORMAT = 0x1000;
+constexpr u32 DDSD_MIPMAPCOUNT = 0x20000;
+constexpr u32 DDSD_LINEARSIZE = 0x80000;
+constexpr u32 DDPF_FOURCC = 0x4;
+constexpr u32 DDSCAPS_COMPLEX = 0x8;
+constexpr u32 DDSCAPS_TEXTURE = 0x1000;
+constexpr u32 DDSCAPS_MIPMAP = 0x400000;
+constexpr u32 DDS_DIMENSION_TEXTURE2D = 3;
+
+constexpr u32 MAX_EXTENT = 16384;
+
+constexpr u32 four_cc(const char (&code)[5]) {
+    return static_cast<u32>(code[0]) | static_cast<u32>(code[1]) << 8 |
+           static_cast<u32>(code[2]) << 16 | static_cast<u32>(code[3]) << 24;
+}
+
+struct DdsPixelFormat {
+    u32 size;
+    u32 flags;
+    u32 four_cc;
+    u32 rgb_bit_count;
+    u32 masks[4];
+};
+
+struct DdsHeader {
+    u32 size;
+    u32 flags;
+    u32 height;
+    u32 width;
+    u32 pitch_or_linear_size;
+    u32 depth;
+    u32 mip_count;
+    u32 reserved1[11];
+    DdsPixelFormat pixel_format;
+    u32 caps;
+    u32 caps2;
+    u32 caps3;
+    u32 caps4;
+    u32 reserved2;
+};
+
+struct DdsHeaderDx10 {
+    u32 dxgi_format;
+    u32 resource_dimension;
+    u32 misc_flag;
+    u32 array_size;
+    u32 misc_flags2;
+};
+
+static_assert(sizeof(DdsHeader) == DDS_HEADER_SIZE && sizeof(DdsHeaderDx10) == 20);
+
+// DXGI_FORMAT values
+constexpr u32 DXGI_BC1_UNORM = 71;
+constexpr u32 DXGI_BC1_UNORM_SRGB = 72;
+constexpr u32 DXGI_BC3_UNORM = 77;
+constexpr u32 DXGI_BC3_UNORM_SRGB = 78;
+constexpr u32 DXGI_BC5_UNORM = 83;
+constexpr u32 DXGI_BC7_UNORM = 98;
+constexpr u32 DXGI_BC7_UNORM_SRGB = 99;
+
+u32 to_dxgi(TextureFormat format) {
+    switch (format) {
+    case TextureFormat::BC1:
+        return DXGI_BC1_UNORM;
+    case TextureFormat::BC1_SRGB:
+        return DXGI_BC1_UNORM_SRGB;
+    case TextureFormat::BC3:
+        return DXGI_BC3_UNORM;
+    case TextureFormat::BC3_SRGB:
+        return DXGI_BC3_UNORM_SRGB;
+    case TextureFormat::BC5:
+        return DXGI_BC5_UNORM;
+    case TextureFormat::BC7:
+        return DXGI_BC7_UNORM;
+    case TextureFormat::BC7_SRGB:
+        return DXGI_BC7_UNORM_SRGB;
+    default:
+        return 0;
+    }
+}
+
+bool from_dxgi(u32 dxgi, TextureFormat& format) {
+    switch (dxgi) {
+    case DXGI_BC1_UNORM:
+        format = TextureFormat::BC1;
+        return true;
+    case DXGI_BC1_UNORM_SRGB:
+        format = TextureFormat::BC1_SRGB;
+        return true;
+    case DXGI_BC3_UNORM:
+        format = TextureFormat::BC3;
+        return true;
+    case DXGI_BC3_UNORM_SRGB:
+        format = TextureFormat::BC3_SRGB;
+        return true;
+    case DXGI_BC5_UNORM:
+        format = TextureFormat::BC5;
+        return true;
+    case DXGI_BC7_UNORM:
+        format = TextureFormat::BC7;
+        return true;
+    case DXGI_BC7_UNORM_SRGB:
+        format = TextureFormat::BC7_SRGB;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool from_four_cc(u32 code, TextureFormat& format) {
+    if (code == four_cc("DXT1")) {
+        format = TextureFormat::BC1;
+    } else if (code == four_cc("DXT5")) {
+        format = TextureFormat::BC3;
+    } else if (code == four_cc("BC5U") || code == four_cc("ATI2")) {
+        format = TextureFormat::BC5;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+usize mip_chain_size(TextureFormat format, u32 width, u32 height, u32 mip_count) {
+    usize size = 0;
+    for (u32 level = 0; level < mip_count; ++level) {
+        size += compressed_size(format, mip_extent(width, level), mip_extent(height, level));
+    }
+    return size;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Paths
+// ============================================================================
+
+std::filesystem::path cooked_texture_path(const std::filesystem::path& source) {
+    std::filesystem::path cooked = source;
+    cooked += COOKED_TEXTURE_EXTENSION;
+    return cooked;
+}
+
+bool is_cooked_texture_current(const std::filesystem::path& source) {
+    return is_cooked_file_current(source, cooked_texture_path(source));
+}
+
+// ============================================================================
+// Writing
+// ============================================================================
+
+bool write_dds(const TextureImage& image, const std::filesystem::path& path) {
+    const u32 dxgi = to_dxgi(image.format);
+    if (dxgi == 0 || !image.is_valid() || image.mip_count == 0 ||
+        image.pixels.size() !=
+            mip_chain_size(image.format, image.width, image.height, image.mip_count)) {
+        HZ_ENGINE_ERROR("Cannot write {} as DDS: not a complete block-compressed image",
+                        path.string());
+        return false;
+    }
+
+    DdsHeader header{};
+    header.size = DDS_HEADER_SIZE;
+    header.flags =
+        DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+    header.height = image.height;
+    header.width = image.width;
+    header.pitch_or_linear_size =
+        static_cast<u32>(compressed_size(image.format, image.width, image.height));
+    header.mip_count = image.mip_count;
+    header.pixel_format.size = DDS_PIXEL_FORMAT_SIZE;
+    header.pixel_format.flags = DDPF_FOURCC;
+    header.pixel_format.four_cc = four_cc("DX10");
+    header.caps = DDSCAPS_TEXTURE | (image.mip_count > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0);
+
+    DdsHeaderDx10 dx10{};
+    dx10.dxgi_format = dxgi;
+    dx10.resource_dimension = DDS_DIMENSION_TEXTURE2D;
+    dx10.array_size = 1;
+
+    std::vector<u8> bytes;
+    ByteWriter out(bytes);
+    out.write_value(DDS_MAGIC);
+    out.write_value(header);
+    out.write_value(dx10);
+    out.write(image.pixels.data(), image.pixels.size());
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        HZ_ENGINE_ERROR("Failed to open file for writing: {}", path.string());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        HZ_ENGINE_ERROR("Failed to write DDS: {}", path.string());
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+TextureImage read_dds(const std::filesystem::path& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        return {};
+    }
+
+    ByteReader in(file.bytes());
+    u32 magic = 0;
+    DdsHeader header{};
+    if (!in.read_value(magic) || magic != DDS_MAGIC || !in.read_value(header) ||
+        header.size != DDS_HEADER_SIZE || !(header.pixel_format.flags & DDPF_FOURCC)) {
+        HZ_ENGINE_ERROR("Not a compressed DDS file: {}", path.string());
+        return {};
+    }
+
+    TextureImage image;
+    bool known = false;
+    if (header.pixel_format.four_cc == four_cc("DX10")) {
+        DdsHeaderDx10 dx10{};
+        known = in.read_value(dx10) && dx10.resource_dimension == DDS_DIMENSION_TEXTURE2D &&
+                dx10.array_size <= 1 && from_dxgi(dx10.dxgi_format, image.format);
+    } else {
+        known = from_four_cc(header.pixel_format.four_cc, image.format);
+    }
+    if (!known) {
+        HZ_ENGINE_ERROR("Unsupported DDS format (BC1, BC3, BC5 and BC7 only): {}",
+                        path.string());
+        return {};
+    }
+
+    image.width = header.width;
+    image.height = header.height;
+    image.mip_count = header.mip_count == 0 ? 1 : header.mip_count;
+    const u32 max_mips = static_cast<u32>(std::bit_width(std::max(image.width, image.height)));
+    if (image.width == 0 || image.height == 0 || image.width > MAX_EXTENT ||
+        image.height > MAX_EXTENT || image.mip_count > max_mips) {
+        HZ_ENGINE_ERROR("Corrupt DDS header: {}", path.string());
+        return {};
+    }
+
+    const usize size = mip_chain_size(image.format, image.width, image.height, image.mip_count);
+    image.pixels.resize(size);
+    if (!in.read(image.pixels.data(), size)) {
+        HZ_ENGINE_ERROR("Truncated DDS file: {}", path.string());
+        return {};
+    }
+    image.path = path.string();
+    return image;
+}
+
+} // namespace hz
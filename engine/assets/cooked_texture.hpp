@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file cooked_texture.hpp
+ * @brief Block-compressed textures with prebuilt mip chains, stored as DDS
+ *
+ * horizon_cook compresses source images (PNG, JPG, TGA, BMP) to BC1, BC3, BC5
+ * or BC7 and writes them next to the source (albedo.png.dds next to
+ * albedo.png). Texture::decode_file() reads the cooked file while it is at
+ * least as new as the source, so textures upload compressed with every mip
+ * level and no glGenerateMipmap.
+ *
+ * Files use the DX10 DDS header, which DirectXTex, texconv and most image
+ * tools read. Legacy DXT1/DXT5/BC5U files load as well.
+ */
+
+#include "engine/assets/texture.hpp"
+#include "engine/core/types.hpp"
+
+#include <filesystem>
+
+namespace hz {
+
+inline constexpr const char* COOKED_TEXTURE_EXTENSION = ".dds";
+
+/**
+ * @brief Path of the cooked file for a source image
+ */
+[[nodiscard]] std::filesystem::path cooked_texture_path(const std::filesystem::path& source);
+
+/**
+ * @brief True if the source's cooked file exists and is not older than the source
+ */
+[[nodiscard]] bool is_cooked_texture_current(const std::filesystem::path& source);
+
+/**
+ * @brief Write a block-compressed image and its mips as DDS
+ */
+bool write_dds(const TextureImage& image, const std::filesystem::path& path);
+
+/**
+ * @brief Read a BC1, BC3, BC5 or BC7 DDS file with its mips
+ *
+ * @return An invalid image if the file is missing, corrupt or another format
+ */
+[[nodiscard]] TextureImage read_dds(const std::filesystem::path& path);
+
+} // namespace hz
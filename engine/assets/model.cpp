@@ -1,5 +1,7 @@
 #include "model.hpp"
 
+#include "cooked_model.hpp"
+#include "engine/core/jobs.hpp"
 #include "engine/core/log.hpp"
 
 #define TINYOBJLOADER_IMPLEMENTATION
@@ -12,11 +14,301 @@
 #include "engine/vendor/tinygltf/tiny_gltf.h" // Assuming we set include path correctly or use relative
 #include "engine/vendor/ufbx/ufbx.h"
 
+#include <algorithm>
+#include <bit>
+#include <filesystem>
 #include <unordered_map>
+#include <utility>
 
 namespace hz {
 
+// ============================================================================
+// Loading
+// ============================================================================
+
 Model Model::load_from_obj(std::string_view path) {
+    return from_data(import_obj(path), path);
+}
+
+Model Model::load_from_gltf(std::string_view path) {
+    return from_data(import_gltf(path), path);
+}
+
+Model Model::load_from_fbx(std::string_view path) {
+    return from_data(import_fbx(path), path);
+}
+
+Model Model::load_from_cooked(std::string_view path) {
+    CookedModel cooked;
+    if (!cooked.open(path)) {
+        return {};
+    }
+
+    Model model;
+    model.m_path = path;
+    model.m_meshes.reserve(cooked.mesh_count());
+    for (u32 i = 0; i < cooked.mesh_count(); ++i) {
+        model.m_meshes.emplace_back(cooked.vertices(i), cooked.indices(i));
+    }
+    ModelData& extras = cooked.extras();
+    model.m_skeleton = std::move(extras.skeleton);
+    model.m_animations = std::move(extras.animations);
+    model.set_materials(extras.materials);
+
+    HZ_ENGINE_INFO("Loaded cooked model: {} ({} meshes)", path, model.m_meshes.size());
+    return model;
+}
+
+Model Model::load_from_file(std::string_view path) {
+    if (is_cooked_model_current(path)) {
+        Model model = load_from_cooked(cooked_model_path(path).string());
+        if (model.is_valid()) {
+            model.m_path = path;
+            return model;
+        }
+        HZ_ENGINE_WARN("Falling back to the source of {}", path);
+    }
+    return from_data(import_file(path), path);
+}
+
+ModelData Model::read_file(std::string_view path) {
+    if (is_cooked_model_current(path)) {
+        CookedModel cooked;
+        if (cooked.open(cooked_model_path(path))) {
+            ModelData data = std::move(cooked.extras());
+            data.meshes.resize(cooked.mesh_count());
+            for (u32 i = 0; i < cooked.mesh_count(); ++i) {
+                const auto vertices = cooked.vertices(i);
+                const auto indices = cooked.indices(i);
+                data.meshes[i].vertices.assign(vertices.begin(), vertices.end());
+                data.meshes[i].indices.assign(indices.begin(), indices.end());
+            }
+            return data;
+        }
+        HZ_ENGINE_WARN("Falling back to the source of {}", path);
+    }
+    return import_file(path);
+}
+
+ModelData Model::import_file(std::string_view path) {
+    if (path.ends_with(".gltf") || path.ends_with(".glb")) {
+        return import_gltf(path);
+    }
+    if (path.ends_with(".fbx")) {
+        return import_fbx(path);
+    }
+    return import_obj(path);
+}
+
+Model Model::from_data(ModelData data, std::string_view path) {
+    Model model;
+    model.m_path = path;
+    model.m_meshes.reserve(data.meshes.size());
+    for (MeshData& mesh : data.meshes) {
+        model.m_meshes.emplace_back(std::move(mesh.vertices), std::move(mesh.indices));
+    }
+    model.m_skeleton = std::move(data.skeleton);
+    model.m_animations = std::move(data.animations);
+    model.set_materials(data.materials);
+    return model;
+}
+
+static TextureParams material_texture_params(const TextureSource& source) {
+    TextureParams params;
+    params.srgb = source.srgb;
+    params.flip_y = false; // FBX uses OpenGL convention typically
+    params.generate_mipmaps = true;
+    return params;
+}
+
+static void decode_material_texture(TextureSource& source) {
+    if (!source.is_set() || source.image.is_valid()) {
+        return;
+    }
+    const TextureParams params = material_texture_params(source);
+    if (!source.embedded.empty()) {
+        source.image = Texture::decode_memory(source.embedded.data(), source.embedded.size(),
+                                              params);
+    }
+    if (!source.image.is_valid() && !source.path.empty()) {
+        source.image = Texture::decode_file(source.path, params);
+    }
+}
+
+void Model::decode_textures(ModelData& data) {
+    for (MaterialData& material : data.materials) {
+        decode_material_texture(material.albedo_texture);
+        decode_material_texture(material.normal_texture);
+        decode_material_texture(material.metallic_roughness_texture);
+        decode_material_texture(material.ao_texture);
+        decode_material_texture(material.emissive_texture);
+    }
+}
+
+static std::shared_ptr<Texture> load_material_texture(const TextureSource& source) {
+    if (!source.is_set()) {
+        return nullptr;
+    }
+
+    const TextureParams params = material_texture_params(source);
+    if (source.image.is_valid()) {
+        auto uploaded = std::make_shared<Texture>(Texture::create(source.image, params));
+        return uploaded->is_valid() ? uploaded : nullptr;
+    }
+
+    if (!source.embedded.empty()) {
+        auto loaded = std::make_shared<Texture>(
+            Texture::load_from_memory(source.embedded.data(), source.embedded.size(), params));
+        if (loaded->is_valid()) {
+            return loaded;
+        }
+    }
+    if (!source.path.empty()) {
+        auto loaded = std::make_shared<Texture>(Texture::load_from_file(source.path, params));
+        if (loaded->is_valid()) {
+            return loaded;
+        }
+    }
+    return nullptr;
+}
+
+void Model::set_materials(const std::vector<MaterialData>& materials) {
+    m_fbx_materials.clear();
+    m_fbx_materials.reserve(materials.size());
+    for (const MaterialData& data : materials) {
+        FBXMaterial material;
+        material.name = data.name;
+        material.albedo_texture = load_material_texture(data.albedo_texture);
+        material.normal_texture = load_material_texture(data.normal_texture);
+        material.metallic_roughness_texture =
+            load_material_texture(data.metallic_roughness_texture);
+        material.ao_texture = load_material_texture(data.ao_texture);
+        material.emissive_texture = load_material_texture(data.emissive_texture);
+        material.albedo_color = data.albedo_color;
+        material.metallic = data.metallic;
+        material.roughness = data.roughness;
+        material.emissive_color = data.emissive_color;
+        m_fbx_materials.push_back(std::move(material));
+    }
+}
+
+// ============================================================================
+// OBJ Import
+// ============================================================================
+
+/**
+ * @brief Maps an OBJ (vertex, normal, texcoord) index triple to its Vertex in a mesh
+ *
+ * Open addressing with linear probing over one flat array of 16-byte slots,
+ * so a lookup hashes three ints and touches one or two cache lines. The table
+ * starts at about half the corner count and doubles at 3/4 load.
+ */
+class ObjVertexMap {
+public:
+    explicit ObjVertexMap(usize corner_count)
+        : m_slots(std::bit_ceil(std::max<usize>(corner_count / 2, 64))) {}
+
+    /**
+     * @brief Find the vertex for key, or add next_vertex for it
+     * @return The vertex index, and whether key was added
+     */
+    std::pair<u32, bool> try_emplace(const tinyobj::index_t& key, u32 next_vertex) {
+        if ((m_size + 1) * 4 > m_slots.size() * 3) {
+            grow();
+        }
+        Slot* slot = find(key);
+        if (slot->vertex != EMPTY) {
+            return {slot->vertex, false};
+        }
+        *slot = {key.vertex_index, key.normal_index, key.texcoord_index, next_vertex};
+        ++m_size;
+        return {next_vertex, true};
+    }
+
+private:
+    static constexpr u32 EMPTY = ~0u;
+
+    struct Slot {
+        i32 position{0};
+        i32 normal{0};
+        i32 texcoord{0};
+        u32 vertex{EMPTY};
+    };
+
+    static usize hash(i32 position, i32 normal, i32 texcoord) {
+        u64 h = static_cast<u32>(position) * 0x9E3779B97F4A7C15ull;
+        h ^= static_cast<u32>(normal) * 0xC2B2AE3D27D4EB4Full;
+        h ^= static_cast<u32>(texcoord) * 0x165667B19E3779F9ull;
+        return static_cast<usize>(h ^ (h >> 29));
+    }
+
+    Slot* find(const tinyobj::index_t& key) {
+        const usize mask = m_slots.size() - 1;
+        for (usize i = hash(key.vertex_index, key.normal_index, key.texcoord_index);; ++i) {
+            Slot& slot = m_slots[i & mask];
+            if (slot.vertex == EMPTY ||
+                (slot.position == key.vertex_index && slot.normal == key.normal_index &&
+                 slot.texcoord == key.texcoord_index)) {
+                return &slot;
+            }
+        }
+    }
+
+    void grow() {
+        std::vector<Slot> old(m_slots.size() * 2);
+        old.swap(m_slots);
+        for (const Slot& slot : old) {
+            if (slot.vertex != EMPTY) {
+                *find({slot.position, slot.normal, slot.texcoord}) = slot;
+            }
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    usize m_size{0};
+};
+
+/**
+ * @brief Build one shape's vertices, merging face corners with identical index triples
+ */
+static MeshData build_obj_mesh(const tinyobj::attrib_t& attrib, const tinyobj::mesh_t& shape) {
+    MeshData mesh;
+    mesh.indices.reserve(shape.indices.size());
+    ObjVertexMap unique_vertices(shape.indices.size());
+
+    for (const auto& index : shape.indices) {
+        const auto [vertex_index, inserted] =
+            unique_vertices.try_emplace(index, static_cast<u32>(mesh.vertices.size()));
+        mesh.indices.push_back(vertex_index);
+        if (!inserted) {
+            continue;
+        }
+
+        Vertex& vertex = mesh.vertices.emplace_back();
+
+        // Position
+        const auto position = 3 * static_cast<size_t>(index.vertex_index);
+        vertex.position = {attrib.vertices[position + 0], attrib.vertices[position + 1],
+                           attrib.vertices[position + 2]};
+
+        // Normal
+        if (index.normal_index >= 0) {
+            const auto normal = 3 * static_cast<size_t>(index.normal_index);
+            vertex.normal = {attrib.normals[normal + 0], attrib.normals[normal + 1],
+                             attrib.normals[normal + 2]};
+        }
+
+        // Texcoord
+        if (index.texcoord_index >= 0) {
+            const auto texcoord = 2 * static_cast<size_t>(index.texcoord_index);
+            vertex.texcoord = {attrib.texcoords[texcoord + 0],
+                               1.0f - attrib.texcoords[texcoord + 1]};
+        }
+    }
+    return mesh;
+}
+
+ModelData Model::import_obj(std::string_view path) {
     tinyobj::attrib_t attrib;
     std::vector<tinyobj::shape_t> shapes;
     std::vector<tinyobj::material_t> materials;
@@ -41,53 +333,22 @@ Model Model::load_from_obj(std::string_view path) {
         HZ_ENGINE_WARN("OBJ warning: {}", warn);
     }
 
-    Model model;
-    model.m_path = path;
-
-    // Process each shape into a mesh
-    for (const auto& shape : shapes) {
-        std::vector<Vertex> vertices;
-        std::vector<u32> indices;
-        std::unordered_map<std::string, u32, TransparentStringHash, std::equal_to<>>
-            unique_vertices;
-
-        for (const auto& index : shape.mesh.indices) {
-            Vertex vertex{};
-
-            // Position
-            vertex.position = {attrib.vertices[3 * static_cast<size_t>(index.vertex_index) + 0],
-                               attrib.vertices[3 * static_cast<size_t>(index.vertex_index) + 1],
-                               attrib.vertices[3 * static_cast<size_t>(index.vertex_index) + 2]};
-
-            // Normal
-            if (index.normal_index >= 0) {
-                vertex.normal = {attrib.normals[3 * static_cast<size_t>(index.normal_index) + 0],
-                                 attrib.normals[3 * static_cast<size_t>(index.normal_index) + 1],
-                                 attrib.normals[3 * static_cast<size_t>(index.normal_index) + 2]};
-            }
+    ModelData model;
 
-            // Texcoord
-            if (index.texcoord_index >= 0) {
-                vertex.texcoord = {
-                    attrib.texcoords[2 * static_cast<size_t>(index.texcoord_index) + 0],
-                    1.0f - attrib.texcoords[2 * static_cast<size_t>(index.texcoord_index) + 1]};
+    // Shapes are independent, so each one is deduplicated on its own job
+    std::vector<MeshData> meshes(shapes.size());
+    JobSystem::parallel_for(
+        shapes.size(),
+        [&](usize begin, usize end) {
+            for (usize i = begin; i < end; ++i) {
+                meshes[i] = build_obj_mesh(attrib, shapes[i].mesh);
             }
+        },
+        1);
 
-            // Deduplicate vertices
-            std::string key = std::to_string(index.vertex_index) + "_" +
-                              std::to_string(index.normal_index) + "_" +
-                              std::to_string(index.texcoord_index);
-
-            if (unique_vertices.count(key) == 0) {
-                unique_vertices[key] = static_cast<u32>(vertices.size());
-                vertices.push_back(vertex);
-            }
-
-            indices.push_back(unique_vertices[key]);
-        }
-
-        if (!vertices.empty()) {
-            model.m_meshes.emplace_back(std::move(vertices), std::move(indices));
+    for (MeshData& mesh : meshes) {
+        if (!mesh.vertices.empty()) {
+            model.meshes.push_back(std::move(mesh));
         }
     }
 
@@ -195,7 +456,7 @@ static void calculate_tangents(std::vector<Vertex>& vertices, const std::vector<
     }
 }
 
-Model Model::load_from_gltf(std::string_view path) {
+ModelData Model::import_gltf(std::string_view path) {
     tinygltf::Model gltf_model;
     tinygltf::TinyGLTF loader;
     std::string err;
@@ -217,8 +478,7 @@ Model Model::load_from_gltf(std::string_view path) {
         return {};
     }
 
-    Model model;
-    model.m_path = path;
+    ModelData model;
 
     // Helper to get buffer data
     auto get_buffer_data = [&](const tinygltf::Accessor& accessor) -> const unsigned char* {
@@ -234,7 +494,7 @@ Model Model::load_from_gltf(std::string_view path) {
     if (!gltf_model.skins.empty()) {
         const auto& skin = gltf_model.skins[0]; // Assuming one skin for now
         auto skeleton = std::make_shared<Skeleton>();
-        model.m_skeleton = skeleton;
+        model.skeleton = skeleton;
 
         // Resize Accessors for IBM
         const float* ibm_data = nullptr;
@@ -314,7 +574,7 @@ Model Model::load_from_gltf(std::string_view path) {
             int bone_id = node_to_bone_id[channel.target_node];
             const auto& node = gltf_model.nodes[channel.target_node];
 
-            Bone* bone = model.m_skeleton->get_bone(bone_id);
+            Bone* bone = model.skeleton->get_bone(bone_id);
             if (!bone)
                 continue;
             std::string bone_name = bone->name;
@@ -374,12 +634,12 @@ Model Model::load_from_gltf(std::string_view path) {
         }
 
         if (!clip->channels.empty()) {
-            model.m_animations.push_back(clip);
+            model.animations.push_back(clip);
         }
     }
 
-    if (!model.m_animations.empty()) {
-        HZ_ENGINE_INFO("Loaded Animations: {}", model.m_animations.size());
+    if (!model.animations.empty()) {
+        HZ_ENGINE_INFO("Loaded Animations: {}", model.animations.size());
     }
 
     // Helper to compute world transform for a node
@@ -685,16 +945,16 @@ Model Model::load_from_gltf(std::string_view path) {
                     HZ_ENGINE_INFO("  Mesh primitive: {} vertices, {} indices", vertices.size(),
                                    indices.size());
                 }
-                model.m_meshes.emplace_back(std::move(vertices), std::move(indices));
+                model.meshes.push_back({std::move(vertices), std::move(indices)});
             }
         } // end primitives loop
     } // end nodes loop
 
-    HZ_ENGINE_INFO("Loaded GLTF: {} ({} meshes)", path, model.m_meshes.size());
+    HZ_ENGINE_INFO("Loaded GLTF: {} ({} meshes)", path, model.meshes.size());
     return model;
 }
 
-Model Model::load_from_fbx(std::string_view path) {
+ModelData Model::import_fbx(std::string_view path) {
     ufbx_load_opts opts = {};
     opts.target_axes = ufbx_axes_right_handed_y_up;
     opts.target_unit_meters = 1.0f;
@@ -712,8 +972,7 @@ Model Model::load_from_fbx(std::string_view path) {
         return {};
     }
 
-    Model model;
-    model.m_path = path;
+    ModelData model;
 
     // --- 1. Load Skeleton ---
     // Identify all nodes that are used as bones by any skin cluster
@@ -797,7 +1056,7 @@ Model Model::load_from_fbx(std::string_view path) {
     });
 
     if (!bone_nodes.empty()) {
-        model.m_skeleton = skeleton;
+        model.skeleton = skeleton;
 
         // Helper to convert ufbx matrix
         auto to_glm = [](const ufbx_matrix& m) {
@@ -1065,7 +1324,7 @@ Model Model::load_from_fbx(std::string_view path) {
                                min_bounds.x, min_bounds.y, min_bounds.z, max_bounds.x, max_bounds.y,
                                max_bounds.z, is_skinned ? "yes" : "no");
                 calculate_tangents(vertices, indices);
-                model.m_meshes.emplace_back(std::move(vertices), std::move(indices));
+                model.meshes.push_back({std::move(vertices), std::move(indices)});
             }
         }
     }
@@ -1135,9 +1394,9 @@ Model Model::load_from_fbx(std::string_view path) {
                 clip->channels.push_back(channel);
             }
 
-            model.m_animations.push_back(clip);
+            model.animations.push_back(clip);
         }
-        HZ_ENGINE_INFO("Loaded FBX Animations: {}", model.m_animations.size());
+        HZ_ENGINE_INFO("Loaded FBX Animations: {}", model.animations.size());
     }
 
     // --- 3. Load Materials ---
@@ -1153,7 +1412,7 @@ Model Model::load_from_fbx(std::string_view path) {
     for (size_t i = 0; i < scene->materials.count; ++i) {
         ufbx_material* mat = scene->materials.data[i];
 
-        FBXMaterial fbx_mat;
+        MaterialData fbx_mat;
         fbx_mat.name = std::string(mat->name.data, mat->name.length);
 
         // Extract base color from material
@@ -1164,28 +1423,19 @@ Model Model::load_from_fbx(std::string_view path) {
                           static_cast<float>(mat->fbx.diffuse_color.value_vec3.z));
         }
 
-        // Helper lambda to load texture from ufbx_texture
-        auto load_texture_from_ufbx = [&](ufbx_texture* tex,
-                                          bool is_srgb) -> std::shared_ptr<Texture> {
+        // Helper lambda to locate the image behind a ufbx_texture
+        auto texture_source = [&](ufbx_texture* tex, bool is_srgb) -> TextureSource {
+            TextureSource source;
+            source.srgb = is_srgb;
             if (!tex)
-                return nullptr;
+                return source;
 
-            TextureParams params;
-            params.srgb = is_srgb;
-            params.flip_y = false; // FBX uses OpenGL convention typically
-            params.generate_mipmaps = true;
-
-            // Check for embedded texture data first
+            // Embedded texture data is tried first, the file path second
             if (tex->content.size > 0) {
-                auto loaded = std::make_shared<Texture>(
-                    Texture::load_from_memory(static_cast<const unsigned char*>(tex->content.data),
-                                              tex->content.size, params));
-                if (loaded->is_valid()) {
-                    return loaded;
-                }
+                const auto* content = static_cast<const u8*>(tex->content.data);
+                source.embedded.assign(content, content + tex->content.size);
             }
 
-            // Try loading from file
             std::string tex_path;
             if (tex->filename.length > 0) {
                 tex_path = std::string(tex->filename.data, tex->filename.length);
@@ -1196,54 +1446,44 @@ Model Model::load_from_fbx(std::string_view path) {
                 tex_path = std::string(tex->absolute_filename.data, tex->absolute_filename.length);
             }
 
-            if (!tex_path.empty()) {
-                auto loaded = std::make_shared<Texture>(Texture::load_from_file(tex_path, params));
-                if (loaded->is_valid()) {
-                    return loaded;
-                }
-                // Try with base_dir prefix
-                if (tex_path[0] != '/') {
-                    loaded = std::make_shared<Texture>(
-                        Texture::load_from_file(base_dir + tex_path, params));
-                    if (loaded->is_valid()) {
-                        return loaded;
-                    }
-                }
+            // Fall back to the FBX directory if the stored path does not exist
+            if (!tex_path.empty() && tex_path[0] != '/' && !std::filesystem::exists(tex_path) &&
+                std::filesystem::exists(base_dir + tex_path)) {
+                tex_path = base_dir + tex_path;
             }
-
-            return nullptr;
+            source.path = std::move(tex_path);
+            return source;
         };
 
-        // Load albedo/diffuse texture
+        // Albedo/diffuse texture
         if (mat->fbx.diffuse_color.texture) {
-            fbx_mat.albedo_texture = load_texture_from_ufbx(mat->fbx.diffuse_color.texture, true);
+            fbx_mat.albedo_texture = texture_source(mat->fbx.diffuse_color.texture, true);
         }
 
-        // Load normal map
+        // Normal map
         if (mat->fbx.normal_map.texture) {
-            fbx_mat.normal_texture = load_texture_from_ufbx(mat->fbx.normal_map.texture, false);
+            fbx_mat.normal_texture = texture_source(mat->fbx.normal_map.texture, false);
         } else if (mat->fbx.bump.texture) {
             // Some FBX files use bump instead of normal
-            fbx_mat.normal_texture = load_texture_from_ufbx(mat->fbx.bump.texture, false);
+            fbx_mat.normal_texture = texture_source(mat->fbx.bump.texture, false);
         }
 
         // Try PBR maps if available
-        if (mat->pbr.base_color.texture && !fbx_mat.albedo_texture) {
-            fbx_mat.albedo_texture = load_texture_from_ufbx(mat->pbr.base_color.texture, true);
+        if (mat->pbr.base_color.texture && !fbx_mat.albedo_texture.is_set()) {
+            fbx_mat.albedo_texture = texture_source(mat->pbr.base_color.texture, true);
         }
-        if (mat->pbr.normal_map.texture && !fbx_mat.normal_texture) {
-            fbx_mat.normal_texture = load_texture_from_ufbx(mat->pbr.normal_map.texture, false);
+        if (mat->pbr.normal_map.texture && !fbx_mat.normal_texture.is_set()) {
+            fbx_mat.normal_texture = texture_source(mat->pbr.normal_map.texture, false);
         }
         if (mat->pbr.roughness.texture) {
             fbx_mat.metallic_roughness_texture =
-                load_texture_from_ufbx(mat->pbr.roughness.texture, false);
+                texture_source(mat->pbr.roughness.texture, false);
         }
         if (mat->pbr.ambient_occlusion.texture) {
-            fbx_mat.ao_texture = load_texture_from_ufbx(mat->pbr.ambient_occlusion.texture, false);
+            fbx_mat.ao_texture = texture_source(mat->pbr.ambient_occlusion.texture, false);
         }
         if (mat->pbr.emission_color.texture) {
-            fbx_mat.emissive_texture =
-                load_texture_from_ufbx(mat->pbr.emission_color.texture, true);
+            fbx_mat.emissive_texture = texture_source(mat->pbr.emission_color.texture, true);
         }
 
         // Extract PBR scalar values
@@ -1254,14 +1494,14 @@ Model Model::load_from_fbx(std::string_view path) {
             fbx_mat.roughness = static_cast<float>(mat->pbr.roughness.value_real);
         }
 
-        model.m_fbx_materials.push_back(std::move(fbx_mat));
+        model.materials.push_back(std::move(fbx_mat));
     }
 
-    if (!model.m_fbx_materials.empty()) {
-        HZ_ENGINE_INFO("Loaded FBX Materials: {}", model.m_fbx_materials.size());
+    if (!model.materials.empty()) {
+        HZ_ENGINE_INFO("Loaded FBX Materials: {}", model.materials.size());
     }
 
-    HZ_ENGINE_INFO("Loaded FBX: {} ({} meshes)", path, model.m_meshes.size());
+    HZ_ENGINE_INFO("Loaded FBX: {} ({} meshes)", path, model.meshes.size());
     ufbx_free_scene(scene);
     return model;
 }
@@ -38,6 +38,57 @@ struct FBXMaterial {
     glm::vec3 emissive_color{0.0f};
 };
 
+/**
+ * @brief Where a material texture is loaded from
+ */
+struct TextureSource {
+    std::string path;         // Image file, tried when the embedded image is missing or bad
+    std::vector<u8> embedded; // Encoded image stored inside the model file
+    bool srgb{false};
+    TextureImage image;       // Decoded ahead of upload by Model::decode_textures(); not cooked
+
+    [[nodiscard]] bool is_set() const noexcept { return !path.empty() || !embedded.empty(); }
+};
+
+/**
+ * @brief Material description imported from an FBX file, before its textures are loaded
+ */
+struct MaterialData {
+    std::string name;
+
+    TextureSource albedo_texture;
+    TextureSource normal_texture;
+    TextureSource metallic_roughness_texture;
+    TextureSource ao_texture;
+    TextureSource emissive_texture;
+
+    glm::vec3 albedo_color{1.0f};
+    float metallic{0.0f};
+    float roughness{0.5f};
+    glm::vec3 emissive_color{0.0f};
+};
+
+/**
+ * @brief Vertices and indices of one mesh, ready for upload
+ */
+struct MeshData {
+    std::vector<Vertex> vertices;
+    std::vector<u32> indices;
+};
+
+/**
+ * @brief Everything imported from a model file, on the CPU
+ *
+ * Importing needs no GL context, so the asset cooker uses the same importers as
+ * the runtime.
+ */
+struct ModelData {
+    std::vector<MeshData> meshes;
+    std::shared_ptr<Skeleton> skeleton;
+    std::vector<std::shared_ptr<AnimationClip>> animations;
+    std::vector<MaterialData> materials;
+};
+
 /**
  * @brief Loaded 3D model with meshes, skeleton, and animations
  */
@@ -64,6 +115,46 @@ public:
      */
     [[nodiscard]] static Model load_from_fbx(std::string_view path);
 
+    /**
+     * @brief Load model from a cooked .hzmesh file (see cooked_model.hpp)
+     *
+     * Vertex and index blocks are uploaded straight from the mapped file.
+     */
+    [[nodiscard]] static Model load_from_cooked(std::string_view path);
+
+    /**
+     * @brief Load a source model, preferring its cooked file when that is up to date
+     */
+    [[nodiscard]] static Model load_from_file(std::string_view path);
+
+    /**
+     * @brief Import a source model (OBJ, GLTF/GLB or FBX, by extension) without uploading it
+     */
+    [[nodiscard]] static ModelData import_file(std::string_view path);
+    [[nodiscard]] static ModelData import_obj(std::string_view path);
+    [[nodiscard]] static ModelData import_gltf(std::string_view path);
+    [[nodiscard]] static ModelData import_fbx(std::string_view path);
+
+    /**
+     * @brief CPU half of load_from_file(): import the source, or copy the cooked file
+     *
+     * Needs no GL context, so streaming threads read models with it and the
+     * render thread only runs from_data().
+     */
+    [[nodiscard]] static ModelData read_file(std::string_view path);
+
+    /**
+     * @brief Decode every material texture into its TextureSource::image (no GL)
+     */
+    static void decode_textures(ModelData& data);
+
+    /**
+     * @brief Upload imported data and load its material textures
+     *
+     * Textures already decoded by decode_textures() are only uploaded.
+     */
+    [[nodiscard]] static Model from_data(ModelData data, std::string_view path);
+
     /**
      * @brief Draw all meshes
      */
@@ -142,6 +233,8 @@ private:
 
     // FBX-specific material data
     std::vector<FBXMaterial> m_fbx_materials;
+
+    void set_materials(const std::vector<MaterialData>& materials);
 };
 
 } // namespace hz
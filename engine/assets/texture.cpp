@@ -1,7 +1,11 @@
 #include "texture.hpp"
 
+#include "engine/assets/block_compression.hpp"
+#include "engine/assets/cooked_texture.hpp"
 #include "engine/vendor/glad/glad.h"
 
+#include <cstring>
+
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
@@ -80,6 +84,20 @@ GLenum to_gl_internal_format(TextureFormat format) {
         return GL_SRGB8;
     case TextureFormat::SRGBA8:
         return GL_SRGB8_ALPHA8;
+    case TextureFormat::BC1:
+        return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case TextureFormat::BC1_SRGB:
+        return GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+    case TextureFormat::BC3:
+        return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case TextureFormat::BC3_SRGB:
+        return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+    case TextureFormat::BC5:
+        return GL_COMPRESSED_RG_RGTC2;
+    case TextureFormat::BC7:
+        return GL_COMPRESSED_RGBA_BPTC_UNORM;
+    case TextureFormat::BC7_SRGB:
+        return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
     }
     return GL_RGBA8;
 }
@@ -96,61 +114,161 @@ GLenum to_gl_format(TextureFormat format) {
     case TextureFormat::RGBA8:
     case TextureFormat::SRGBA8:
         return GL_RGBA;
+    default:
+        return GL_RGBA; // Compressed formats upload with glCompressedTexImage2D
     }
-    return GL_RGBA;
 }
 
-} // anonymous namespace
-
-Texture Texture::load_from_file(std::string_view path, const TextureParams& params) {
-    // Load image with stb_image
-    // GLTF uses OpenGL UV convention (origin at bottom-left), so flip_y should be false for GLTF
-    // For other formats (OBJ, etc.) flip_y = true is typically needed
-    stbi_set_flip_vertically_on_load(params.flip_y ? 1 : 0);
+void apply_sampler_params(const TextureParams& params) {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    static_cast<GLint>(to_gl_filter(params.min_filter, true)));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                    static_cast<GLint>(to_gl_filter(params.mag_filter, false)));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
+                    static_cast<GLint>(to_gl_wrap(params.wrap_s)));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
+                    static_cast<GLint>(to_gl_wrap(params.wrap_t)));
+}
 
-    int width, height, channels;
-    unsigned char* data = stbi_load(std::string(path).c_str(), &width, &height, &channels, 0);
+bool has_gl_extension(const char* name) {
+    if (!glGetStringi) {
+        return false;
+    }
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const auto* extension =
+            reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (extension && std::strcmp(extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
 
-    if (!data) {
-        HZ_ENGINE_ERROR("Failed to load texture: {}", path);
-        return {};
+/// RGTC is core in GL 3.0; S3TC and BPTC are extensions on a 4.1 context
+bool is_format_supported(TextureFormat format) {
+    static const bool s3tc = has_gl_extension("GL_EXT_texture_compression_s3tc");
+    static const bool bptc = has_gl_extension("GL_ARB_texture_compression_bptc");
+    switch (format) {
+    case TextureFormat::BC1:
+    case TextureFormat::BC1_SRGB:
+    case TextureFormat::BC3:
+    case TextureFormat::BC3_SRGB:
+        return s3tc;
+    case TextureFormat::BC7:
+    case TextureFormat::BC7_SRGB:
+        return bptc;
+    default:
+        return true;
     }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+namespace {
 
-    // Determine format
-    TextureFormat format;
+TextureFormat format_for_channels(int channels, bool srgb) {
     switch (channels) {
     case 1:
-        format = TextureFormat::R8;
-        break;
+        return TextureFormat::R8;
     case 2:
-        format = TextureFormat::RG8;
-        break;
+        return TextureFormat::RG8;
     case 3:
-        format = params.srgb ? TextureFormat::SRGB8 : TextureFormat::RGB8;
-        break;
+        return srgb ? TextureFormat::SRGB8 : TextureFormat::RGB8;
     case 4:
     default:
-        format = params.srgb ? TextureFormat::SRGBA8 : TextureFormat::RGBA8;
-        break;
+        return srgb ? TextureFormat::SRGBA8 : TextureFormat::RGBA8;
     }
+}
 
-    Texture tex = create(static_cast<u32>(width), static_cast<u32>(height), format, data, params);
-    tex.m_path = path;
+/// Cooked files record their own color space; params.srgb decides, as for source images
+TextureFormat with_color_space(TextureFormat format, bool srgb) {
+    switch (format) {
+    case TextureFormat::BC1:
+    case TextureFormat::BC1_SRGB:
+        return srgb ? TextureFormat::BC1_SRGB : TextureFormat::BC1;
+    case TextureFormat::BC3:
+    case TextureFormat::BC3_SRGB:
+        return srgb ? TextureFormat::BC3_SRGB : TextureFormat::BC3;
+    case TextureFormat::BC7:
+    case TextureFormat::BC7_SRGB:
+        return srgb ? TextureFormat::BC7_SRGB : TextureFormat::BC7;
+    default:
+        return format;
+    }
+}
 
-    stbi_image_free(data);
+bool is_srgb(TextureFormat format) {
+    return format == TextureFormat::SRGB8 || format == TextureFormat::SRGBA8 ||
+           format == TextureFormat::BC1_SRGB || format == TextureFormat::BC3_SRGB ||
+           format == TextureFormat::BC7_SRGB;
+}
 
-    HZ_ENGINE_INFO("Loaded texture: {} ({}x{}, {} channels)", path, width, height, channels);
-    return tex;
+/// Copy stb_image's pixels into a TextureImage and free them
+TextureImage make_image(unsigned char* pixels, int width, int height, int channels, bool srgb) {
+    TextureImage image;
+    image.width = static_cast<u32>(width);
+    image.height = static_cast<u32>(height);
+    image.format = format_for_channels(channels, srgb);
+    const size_t size = static_cast<size_t>(width) * static_cast<size_t>(height) *
+                        static_cast<size_t>(channels);
+    image.pixels.assign(pixels, pixels + size);
+    stbi_image_free(pixels);
+    return image;
 }
 
-Texture Texture::load_from_memory(const unsigned char* data, size_t size,
-                                  const TextureParams& params) {
+} // anonymous namespace
+
+TextureImage Texture::decode_file(std::string_view path, const TextureParams& params) {
+    // Cooked files are stored top row first, so a flipped load needs the source
+    const std::filesystem::path file_path(path);
+    const bool is_dds = file_path.extension() == COOKED_TEXTURE_EXTENSION;
+    if (is_dds || (!params.flip_y && is_cooked_texture_current(file_path))) {
+        TextureImage image = read_dds(is_dds ? file_path : cooked_texture_path(file_path));
+        if (image.is_valid()) {
+            image.format = with_color_space(image.format, params.srgb);
+            image.path = path;
+            return image;
+        }
+        if (is_dds) {
+            HZ_ENGINE_ERROR("Failed to load texture: {}", path);
+            return {};
+        }
+        HZ_ENGINE_WARN("Ignoring unreadable cooked texture for {}", path);
+    }
+
+    // Load image with stb_image
+    // GLTF uses OpenGL UV convention (origin at bottom-left), so flip_y should be false for GLTF
+    // For other formats (OBJ, etc.) flip_y = true is typically needed
+    // The flag is per thread, since streaming threads decode alongside the main thread
+    stbi_set_flip_vertically_on_load_thread(params.flip_y ? 1 : 0);
+
+    int width, height, channels;
+    unsigned char* data = stbi_load(std::string(path).c_str(), &width, &height, &channels, 0);
+
+    if (!data) {
+        HZ_ENGINE_ERROR("Failed to load texture: {}", path);
+        return {};
+    }
+
+    TextureImage image = make_image(data, width, height, channels, params.srgb);
+    image.path = path;
+    return image;
+}
+
+TextureImage Texture::decode_memory(const unsigned char* data, size_t size,
+                                    const TextureParams& params) {
     if (!data || size == 0) {
         HZ_ENGINE_ERROR("Failed to load texture from memory: empty data");
         return {};
     }
 
-    stbi_set_flip_vertically_on_load(params.flip_y ? 1 : 0);
+    stbi_set_flip_vertically_on_load_thread(params.flip_y ? 1 : 0);
 
     int width, height, channels;
     unsigned char* pixels =
@@ -161,30 +279,91 @@ Texture Texture::load_from_memory(const unsigned char* data, size_t size,
         return {};
     }
 
-    // Determine format
-    TextureFormat format;
-    switch (channels) {
-    case 1:
-        format = TextureFormat::R8;
-        break;
-    case 2:
-        format = TextureFormat::RG8;
-        break;
-    case 3:
-        format = params.srgb ? TextureFormat::SRGB8 : TextureFormat::RGB8;
-        break;
-    case 4:
-    default:
-        format = params.srgb ? TextureFormat::SRGBA8 : TextureFormat::RGBA8;
-        break;
+    TextureImage image = make_image(pixels, width, height, channels, params.srgb);
+    image.path = "[embedded]";
+    return image;
+}
+
+// ============================================================================
+// Loading
+// ============================================================================
+
+Texture Texture::load_from_file(std::string_view path, const TextureParams& params) {
+    const TextureImage image = decode_file(path, params);
+    if (!image.is_valid()) {
+        return {};
     }
 
-    Texture tex = create(static_cast<u32>(width), static_cast<u32>(height), format, pixels, params);
-    tex.m_path = "[embedded]";
+    HZ_ENGINE_INFO("Loaded texture: {} ({}x{})", path, image.width, image.height);
+    return create(image, params);
+}
 
-    stbi_image_free(pixels);
+Texture Texture::load_from_memory(const unsigned char* data, size_t size,
+                                  const TextureParams& params) {
+    const TextureImage image = decode_memory(data, size, params);
+    if (!image.is_valid()) {
+        return {};
+    }
 
-    HZ_ENGINE_INFO("Loaded embedded texture ({}x{}, {} channels)", width, height, channels);
+    HZ_ENGINE_INFO("Loaded embedded texture ({}x{})", image.width, image.height);
+    return create(image, params);
+}
+
+Texture Texture::create(const TextureImage& image, const TextureParams& params) {
+    if (!image.is_valid()) {
+        return {};
+    }
+    if (is_block_compressed(image.format)) {
+        return create_compressed(image, params);
+    }
+    Texture tex = create(image.width, image.height, image.format, image.pixels.data(), params);
+    tex.m_path = image.path;
+    return tex;
+}
+
+Texture Texture::create_compressed(const TextureImage& image, const TextureParams& params) {
+    if (!is_format_supported(image.format)) {
+        // Old drivers without S3TC or BPTC: decompress the top level instead
+        const std::vector<u8> rgba =
+            decompress_image(image.format, image.pixels.data(), image.width, image.height);
+        if (rgba.empty()) {
+            HZ_ENGINE_ERROR("Failed to decompress texture: {}", image.path);
+            return {};
+        }
+        HZ_ENGINE_WARN("Compressed format unsupported by the driver, uploading {} as RGBA8",
+                       image.path);
+        const TextureFormat format =
+            is_srgb(image.format) ? TextureFormat::SRGBA8 : TextureFormat::RGBA8;
+        Texture tex = create(image.width, image.height, format, rgba.data(), params);
+        tex.m_path = image.path;
+        return tex;
+    }
+
+    Texture tex;
+    tex.m_width = image.width;
+    tex.m_height = image.height;
+    tex.m_format = image.format;
+    tex.m_path = image.path;
+
+    glGenTextures(1, &tex.m_id);
+    glBindTexture(GL_TEXTURE_2D, tex.m_id);
+    apply_sampler_params(params);
+
+    // Upload the cooked chain as is; a partial chain stays complete through MAX_LEVEL
+    const GLenum internal_format = to_gl_internal_format(image.format);
+    const u8* level_data = image.pixels.data();
+    for (u32 level = 0; level < image.mip_count; ++level) {
+        const u32 width = mip_extent(image.width, level);
+        const u32 height = mip_extent(image.height, level);
+        const usize size = compressed_size(image.format, width, height);
+        glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internal_format,
+                               static_cast<GLsizei>(width), static_cast<GLsizei>(height), 0,
+                               static_cast<GLsizei>(size), level_data);
+        level_data += size;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(image.mip_count - 1));
+
+    glBindTexture(GL_TEXTURE_2D, 0);
     return tex;
 }
 
@@ -198,15 +377,7 @@ Texture Texture::create(u32 width, u32 height, TextureFormat format, const void*
     glGenTextures(1, &tex.m_id);
     glBindTexture(GL_TEXTURE_2D, tex.m_id);
 
-    // Set parameters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-                    static_cast<GLint>(to_gl_filter(params.min_filter, true)));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
-                    static_cast<GLint>(to_gl_filter(params.mag_filter, false)));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
-                    static_cast<GLint>(to_gl_wrap(params.wrap_s)));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
-                    static_cast<GLint>(to_gl_wrap(params.wrap_t)));
+    apply_sampler_params(params);
 
     // Upload data
     glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(to_gl_internal_format(format)),
@@ -11,13 +11,30 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace hz {
 
 /**
  * @brief Texture format
+ *
+ * BC formats are block-compressed (see block_compression.hpp).
  */
-enum class TextureFormat : u8 { R8, RG8, RGB8, RGBA8, SRGB8, SRGBA8 };
+enum class TextureFormat : u8 {
+    R8,
+    RG8,
+    RGB8,
+    RGBA8,
+    SRGB8,
+    SRGBA8,
+    BC1,
+    BC1_SRGB,
+    BC3,
+    BC3_SRGB,
+    BC5,
+    BC7,
+    BC7_SRGB
+};
 
 /**
  * @brief Texture filter mode
@@ -42,6 +59,23 @@ struct TextureParams {
     bool flip_y{false}; // Set to false for GLTF textures (GLTF uses OpenGL UV convention)
 };
 
+/**
+ * @brief Decoded pixels waiting for upload
+ *
+ * Decoding needs no GL context, so it can run on a streaming thread while
+ * Texture::create() uploads on the render thread.
+ */
+struct TextureImage {
+    u32 width{0};
+    u32 height{0};
+    TextureFormat format{TextureFormat::RGBA8};
+    u32 mip_count{1};       // Levels stored in pixels, largest first (BC formats only)
+    std::vector<u8> pixels; // Tightly packed rows, first row at the bottom if flip_y was set
+    std::string path;       // Source file, or "[embedded]"
+
+    [[nodiscard]] bool is_valid() const noexcept { return !pixels.empty(); }
+};
+
 /**
  * @brief OpenGL texture wrapper
  */
@@ -61,6 +95,32 @@ public:
     [[nodiscard]] static Texture load_from_file(std::string_view path,
                                                 const TextureParams& params = {});
 
+    /**
+     * @brief Decode an image file without uploading it (thread-safe, no GL)
+     *
+     * Uses params.flip_y and params.srgb. Reads the cooked .dds next to the
+     * file instead while it is up to date, unless flip_y is set (see
+     * cooked_texture.hpp). Returns an invalid image on failure.
+     */
+    [[nodiscard]] static TextureImage decode_file(std::string_view path,
+                                                  const TextureParams& params = {});
+
+    /**
+     * @brief Decode an encoded image in memory without uploading it (thread-safe, no GL)
+     */
+    [[nodiscard]] static TextureImage decode_memory(const unsigned char* data, size_t size,
+                                                    const TextureParams& params = {});
+
+    /**
+     * @brief Upload a decoded image
+     *
+     * Block-compressed images upload their mip chain as stored. Where the
+     * driver lacks the format, the top level is decompressed and uploaded as
+     * RGBA8.
+     */
+    [[nodiscard]] static Texture create(const TextureImage& image,
+                                        const TextureParams& params = {});
+
     /**
      * @brief Create texture from raw data
      */
@@ -105,6 +165,8 @@ public:
     [[nodiscard]] const std::string& path() const noexcept { return m_path; }
 
 private:
+    static Texture create_compressed(const TextureImage& image, const TextureParams& params);
+
     u32 m_id{0};
     u32 m_width{0};
     u32 m_height{0};
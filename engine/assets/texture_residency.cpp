@@ -0,0 +1,291 @@
+#include "texture_residency.hpp"
+
+#include "block_compression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <utility>
+
+namespace hz {
+
+// ============================================================================
+// Tracking
+// ============================================================================
+
+void TextureResidency::track(u32 id, u32 width, u32 height, TextureFormat format, u32 mip_count,
+                             u32 resident_mip) {
+    if (id >= m_entries.size()) {
+        m_entries.resize(id + 1);
+    }
+    Entry& entry = m_entries[id];
+    if (entry.pending) {
+        --m_pending;
+    }
+
+    mip_count = std::max(mip_count, 1u);
+    entry = Entry{};
+    entry.width = width;
+    entry.height = height;
+    entry.format = format;
+    entry.mip_count = mip_count;
+    entry.tail_mip = tail_mip_for(width, height, mip_count);
+    entry.resident_mip = std::min(resident_mip, mip_count - 1);
+    entry.planned_mip = entry.resident_mip;
+    entry.last_used_frame = m_frame;
+    entry.tracked = true;
+}
+
+void TextureResidency::untrack(u32 id) {
+    if (!is_tracked(id)) {
+        return;
+    }
+    if (m_entries[id].pending) {
+        --m_pending;
+    }
+    m_entries[id] = Entry{};
+}
+
+void TextureResidency::clear() {
+    m_entries.clear();
+    m_pending = 0;
+    m_planned_bytes = 0;
+}
+
+u32 TextureResidency::resident_mip(u32 id) const noexcept {
+    return is_tracked(id) ? m_entries[id].resident_mip : 0;
+}
+
+u32 TextureResidency::tail_mip(u32 id) const noexcept {
+    return is_tracked(id) ? m_entries[id].tail_mip : 0;
+}
+
+u32 TextureResidency::tail_mip_for(u32 width, u32 height, u32 mip_count) noexcept {
+    u32 level = 0;
+    while (level + 1 < mip_count &&
+           std::max(mip_extent(width, level), mip_extent(height, level)) > TAIL_EXTENT) {
+        ++level;
+    }
+    return level;
+}
+
+// ============================================================================
+// Planning
+// ============================================================================
+
+void TextureResidency::request(u32 id, u32 mip) {
+    if (is_tracked(id)) {
+        Entry& entry = m_entries[id];
+        entry.requested_mip = std::min(entry.requested_mip, mip);
+    }
+}
+
+void TextureResidency::request_screen_size(u32 id, f32 screen_pixels) {
+    if (is_tracked(id)) {
+        const Entry& entry = m_entries[id];
+        request(id, mip_for_screen_size(entry.width, entry.height, screen_pixels));
+    }
+}
+
+std::vector<TextureMipChange> TextureResidency::update() {
+    ++m_frame;
+
+    u64 planned_bytes = 0;
+    for (Entry& entry : m_entries) {
+        if (!entry.tracked) {
+            continue;
+        }
+        // Textures that were not requested keep their plan until the budget needs room
+        if (entry.requested_mip != NOT_REQUESTED && !entry.failed) {
+            const u32 wanted = std::min(entry.requested_mip, entry.tail_mip);
+            const bool grow = wanted < entry.resident_mip;
+            const bool shrink = wanted >= entry.resident_mip + OUT_HYSTERESIS;
+            entry.planned_mip = (grow || shrink) ? wanted : entry.resident_mip;
+            entry.last_used_frame = m_frame;
+        }
+        planned_bytes += level_bytes(entry, entry.planned_mip);
+    }
+    fit_budget(planned_bytes);
+    m_planned_bytes = planned_bytes;
+
+    // Shrinks first, since they make room; then the most recently used growth
+    std::vector<u32> candidates;
+    for (u32 id = 0; id < m_entries.size(); ++id) {
+        const Entry& entry = m_entries[id];
+        if (entry.tracked && !entry.pending && !entry.failed &&
+            entry.planned_mip != entry.resident_mip) {
+            candidates.push_back(id);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](u32 a, u32 b) {
+        const Entry& ea = m_entries[a];
+        const Entry& eb = m_entries[b];
+        const bool shrink_a = ea.planned_mip > ea.resident_mip;
+        const bool shrink_b = eb.planned_mip > eb.resident_mip;
+        if (shrink_a != shrink_b) {
+            return shrink_a;
+        }
+        if (ea.last_used_frame != eb.last_used_frame) {
+            return ea.last_used_frame > eb.last_used_frame;
+        }
+        return a < b;
+    });
+
+    std::vector<TextureMipChange> changes;
+    for (const u32 id : candidates) {
+        if (m_pending >= MAX_PENDING) {
+            break;
+        }
+        Entry& entry = m_entries[id];
+        entry.pending = true;
+        ++m_pending;
+        changes.push_back({id, entry.planned_mip});
+    }
+
+    for (Entry& entry : m_entries) {
+        entry.requested_mip = NOT_REQUESTED;
+    }
+    return changes;
+}
+
+void TextureResidency::fit_budget(u64& planned_bytes) {
+    if (m_budget == 0 || planned_bytes <= m_budget) {
+        return;
+    }
+
+    // Evict idle textures to their tail, least recently used first
+    std::vector<u32> idle;
+    for (u32 id = 0; id < m_entries.size(); ++id) {
+        const Entry& entry = m_entries[id];
+        if (entry.tracked && !entry.failed && entry.requested_mip == NOT_REQUESTED &&
+            entry.planned_mip < entry.tail_mip) {
+            idle.push_back(id);
+        }
+    }
+    std::sort(idle.begin(), idle.end(), [this](u32 a, u32 b) {
+        return m_entries[a].last_used_frame < m_entries[b].last_used_frame;
+    });
+    for (const u32 id : idle) {
+        if (planned_bytes <= m_budget) {
+            return;
+        }
+        Entry& entry = m_entries[id];
+        planned_bytes -= level_bytes(entry, entry.planned_mip) - level_bytes(entry, entry.tail_mip);
+        entry.planned_mip = entry.tail_mip;
+        ++m_evictions;
+    }
+
+    // Then take one level at a time from the largest requested textures
+    std::priority_queue<std::pair<u64, u32>> largest;
+    for (u32 id = 0; id < m_entries.size(); ++id) {
+        const Entry& entry = m_entries[id];
+        if (entry.tracked && !entry.failed && entry.planned_mip < entry.tail_mip) {
+            largest.emplace(level_bytes(entry, entry.planned_mip), id);
+        }
+    }
+    while (planned_bytes > m_budget && !largest.empty()) {
+        const u32 id = largest.top().second;
+        largest.pop();
+        Entry& entry = m_entries[id];
+        const u64 bytes = level_bytes(entry, entry.planned_mip + 1);
+        planned_bytes -= level_bytes(entry, entry.planned_mip) - bytes;
+        ++entry.planned_mip;
+        if (entry.planned_mip < entry.tail_mip) {
+            largest.emplace(bytes, id);
+        }
+    }
+}
+
+void TextureResidency::complete(u32 id, u32 mip) {
+    if (!is_tracked(id)) {
+        return;
+    }
+    Entry& entry = m_entries[id];
+    entry.resident_mip = std::min(mip, entry.mip_count - 1);
+    if (entry.pending) {
+        entry.pending = false;
+        --m_pending;
+    }
+}
+
+void TextureResidency::cancel(u32 id) {
+    if (!is_tracked(id) || !m_entries[id].pending) {
+        return;
+    }
+    Entry& entry = m_entries[id];
+    entry.pending = false;
+    entry.planned_mip = entry.resident_mip;
+    --m_pending;
+}
+
+void TextureResidency::fail(u32 id) {
+    if (!is_tracked(id)) {
+        return;
+    }
+    cancel(id);
+    m_entries[id].failed = true;
+}
+
+TextureResidencyStats TextureResidency::stats() const noexcept {
+    TextureResidencyStats stats;
+    stats.budget_bytes = m_budget;
+    stats.planned_bytes = m_planned_bytes;
+    stats.pending_requests = m_pending;
+    stats.evictions = m_evictions;
+    for (const Entry& entry : m_entries) {
+        if (entry.tracked) {
+            stats.resident_bytes += level_bytes(entry, entry.resident_mip);
+            ++stats.tracked_textures;
+        }
+    }
+    return stats;
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+u64 TextureResidency::level_bytes(const Entry& entry, u32 first_mip) const {
+    return chain_bytes(entry.format, entry.width, entry.height, first_mip, entry.mip_count);
+}
+
+u64 TextureResidency::chain_bytes(TextureFormat format, u32 width, u32 height, u32 first_mip,
+                                  u32 mip_count) {
+    u64 texel_bytes = 4;
+    if (format == TextureFormat::R8) {
+        texel_bytes = 1;
+    } else if (format == TextureFormat::RG8) {
+        texel_bytes = 2;
+    }
+
+    u64 bytes = 0;
+    for (u32 level = first_mip; level < mip_count; ++level) {
+        const u32 level_width = mip_extent(width, level);
+        const u32 level_height = mip_extent(height, level);
+        bytes += is_block_compressed(format)
+                     ? compressed_size(format, level_width, level_height)
+                     : static_cast<u64>(level_width) * level_height * texel_bytes;
+    }
+    return bytes;
+}
+
+u32 TextureResidency::mip_for_screen_size(u32 width, u32 height, f32 screen_pixels) {
+    const u32 last_mip = full_mip_count(width, height) - 1;
+    if (!(screen_pixels > 0.0f)) {
+        return last_mip;
+    }
+    const f32 ratio = static_cast<f32>(std::max(width, height)) / screen_pixels;
+    if (ratio <= 1.0f) {
+        return 0;
+    }
+    return std::min(static_cast<u32>(std::floor(std::log2(ratio))), last_mip);
+}
+
+f32 TextureResidency::projected_size(f32 radius, f32 distance, f32 fov_y, f32 viewport_height) {
+    if (distance <= radius) {
+        return viewport_height;
+    }
+    return radius * viewport_height / (distance * std::tan(fov_y * 0.5f));
+}
+
+} // namespace hz
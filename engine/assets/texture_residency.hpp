@@ -0,0 +1,200 @@
+#pragma once
+
+/**
+ * @file texture_residency.hpp
+ * @brief Mip residency planning for streamed textures against a VRAM budget
+ *
+ * TextureResidency decides, once per frame, which mip level each texture
+ * should have resident; it owns no GL objects. AssetRegistry feeds it the
+ * levels the renderer asked for (request()), streams the planned levels in and
+ * out on its AssetStreamer, and reports each finished upload back.
+ *
+ * Every texture keeps its tail (the levels 64 texels and smaller) resident,
+ * so something always binds. Above the tail:
+ * - A requested texture streams toward the requested level. It streams out
+ *   only when the request drops two levels or more, so a camera moving back
+ *   and forth does not reload the same level every few frames.
+ * - When the planned levels exceed the budget, textures that were not
+ *   requested this frame are evicted to their tail, least recently used
+ *   first. If that is not enough, the largest requested textures lose one
+ *   level at a time.
+ *
+ * Planned levels fit the budget unless the tails alone exceed it. The
+ * resident total can exceed it briefly, while a texture that grows finishes
+ * before one that shrinks.
+ */
+
+#include "engine/assets/texture.hpp"
+#include "engine/core/types.hpp"
+
+#include <vector>
+
+namespace hz {
+
+/**
+ * @brief Queryable residency counters
+ */
+struct TextureResidencyStats {
+    u64 budget_bytes{0};   // 0 when unlimited
+    u64 resident_bytes{0}; // Resident levels of tracked textures
+    u64 planned_bytes{0};  // Levels the last update() streams toward
+    u32 tracked_textures{0};
+    u32 pending_requests{0}; // Level changes being read or waiting for upload
+    u64 evictions{0};        // Textures dropped to their tail by the budget
+};
+
+/**
+ * @brief A texture should be re-streamed starting at mip
+ */
+struct TextureMipChange {
+    u32 id;
+    u32 mip;
+};
+
+/**
+ * @brief Per-texture mip planning and VRAM accounting (render thread only)
+ */
+class TextureResidency {
+public:
+    static constexpr u32 TAIL_EXTENT = 64;
+    static constexpr u32 MAX_PENDING = 16;    // Level changes in flight at once
+    static constexpr u32 OUT_HYSTERESIS = 2;  // Levels a request must drop to stream out
+
+    TextureResidency() = default;
+
+    /**
+     * @brief Limit the planned levels to bytes of VRAM; 0 is unlimited
+     */
+    void set_budget(u64 bytes) noexcept { m_budget = bytes; }
+    [[nodiscard]] u64 budget() const noexcept { return m_budget; }
+
+    // ========================================================================
+    // Tracking
+    // ========================================================================
+
+    /**
+     * @brief Start tracking a texture whose levels from resident_mip down are uploaded
+     *
+     * @param width Extent of level 0 of the full chain
+     * @param mip_count Levels in the full chain
+     */
+    void track(u32 id, u32 width, u32 height, TextureFormat format, u32 mip_count,
+               u32 resident_mip);
+    void untrack(u32 id);
+    void clear();
+
+    [[nodiscard]] bool is_tracked(u32 id) const noexcept {
+        return id < m_entries.size() && m_entries[id].tracked;
+    }
+
+    /**
+     * @brief Finest resident level, or 0 for untracked textures
+     */
+    [[nodiscard]] u32 resident_mip(u32 id) const noexcept;
+
+    /**
+     * @brief Coarsest level a texture streams to; it is never evicted below this
+     */
+    [[nodiscard]] u32 tail_mip(u32 id) const noexcept;
+
+    // ========================================================================
+    // Planning
+    // ========================================================================
+
+    /**
+     * @brief Ask for a texture's levels from mip down this frame
+     *
+     * Several requests in a frame keep the finest level.
+     */
+    void request(u32 id, u32 mip);
+
+    /**
+     * @brief Ask for the level that maps about one texel to one pixel at screen_pixels
+     */
+    void request_screen_size(u32 id, f32 screen_pixels);
+
+    /**
+     * @brief Plan this frame's levels and return the changes to start streaming
+     *
+     * Clears the frame's requests. Each returned texture is pending until
+     * complete() or cancel(); no other change is issued for it meanwhile.
+     */
+    [[nodiscard]] std::vector<TextureMipChange> update();
+
+    /**
+     * @brief A change finished uploading; levels from mip down are now resident
+     */
+    void complete(u32 id, u32 mip);
+
+    /**
+     * @brief A change was dropped; the resident levels stay as they were
+     */
+    void cancel(u32 id);
+
+    /**
+     * @brief A change failed; the texture keeps its resident levels until tracked again
+     */
+    void fail(u32 id);
+
+    [[nodiscard]] TextureResidencyStats stats() const noexcept;
+
+    // ========================================================================
+    // Helpers
+    // ========================================================================
+
+    /**
+     * @brief Bytes of levels first_mip to mip_count - 1 of a chain
+     *
+     * Uncompressed RGB formats count as 4 bytes per texel, as drivers store them.
+     */
+    [[nodiscard]] static u64 chain_bytes(TextureFormat format, u32 width, u32 height,
+                                         u32 first_mip, u32 mip_count);
+
+    /**
+     * @brief First level of a chain that is TAIL_EXTENT or smaller, or the last level
+     */
+    [[nodiscard]] static u32 tail_mip_for(u32 width, u32 height, u32 mip_count) noexcept;
+
+    /**
+     * @brief Level whose larger extent is closest to screen_pixels without going under
+     */
+    [[nodiscard]] static u32 mip_for_screen_size(u32 width, u32 height, f32 screen_pixels);
+
+    /**
+     * @brief Projected height in pixels of a sphere, for mip_for_screen_size()
+     *
+     * @param fov_y Vertical field of view in radians
+     */
+    [[nodiscard]] static f32 projected_size(f32 radius, f32 distance, f32 fov_y,
+                                            f32 viewport_height);
+
+private:
+    static constexpr u32 NOT_REQUESTED = ~0u;
+
+    struct Entry {
+        u32 width{0};
+        u32 height{0};
+        TextureFormat format{TextureFormat::RGBA8};
+        u32 mip_count{0};
+        u32 tail_mip{0};
+        u32 resident_mip{0};
+        u32 planned_mip{0};
+        u32 requested_mip{NOT_REQUESTED}; // This frame
+        u64 last_used_frame{0};
+        bool tracked{false};
+        bool pending{false};
+        bool failed{false}; // Stop streaming; a file that failed once is not read every frame
+    };
+
+    [[nodiscard]] u64 level_bytes(const Entry& entry, u32 first_mip) const;
+    void fit_budget(u64& planned_bytes);
+
+    std::vector<Entry> m_entries; // Indexed by id
+    u64 m_budget{0};
+    u64 m_frame{0};
+    u64 m_planned_bytes{0};
+    u64 m_evictions{0};
+    u32 m_pending{0};
+};
+
+} // namespace hz
@@ -0,0 +1,268 @@
+#include "alloc_tracker.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace hz {
+
+// ============================================================================
+// Static Members
+// ============================================================================
+
+thread_local AllocCounters AllocTracker::s_thread;
+thread_local u32 AllocTracker::s_forbid_depth = 0;
+
+std::atomic<u64> AllocTracker::s_heap_allocations{0};
+std::atomic<u64> AllocTracker::s_heap_frees{0};
+std::atomic<u64> AllocTracker::s_heap_bytes{0};
+std::atomic<u64> AllocTracker::s_pmr_allocations{0};
+std::atomic<u64> AllocTracker::s_pmr_bytes{0};
+
+AllocCounters AllocTracker::s_frame_start;
+AllocCounters AllocTracker::s_last_frame;
+
+// ============================================================================
+// AllocTracker Implementation
+// ============================================================================
+
+AllocCounters AllocTracker::total_counters() noexcept {
+    return {s_heap_allocations.load(std::memory_order_relaxed),
+            s_heap_frees.load(std::memory_order_relaxed),
+            s_heap_bytes.load(std::memory_order_relaxed),
+            s_pmr_allocations.load(std::memory_order_relaxed),
+            s_pmr_bytes.load(std::memory_order_relaxed)};
+}
+
+void AllocTracker::end_frame() noexcept {
+    const AllocCounters now = total_counters();
+    s_last_frame = now - s_frame_start;
+    s_frame_start = now;
+}
+
+AllocCounters AllocTracker::last_frame() noexcept {
+    return s_last_frame;
+}
+
+void AllocTracker::record_heap_allocation(usize bytes) noexcept {
+    if (s_forbid_depth != 0) {
+        // No logging here: the logger itself allocates
+        char message[96];
+        std::snprintf(message, sizeof(message),
+                      "Heap allocation of %zu bytes inside a NoAllocScope\n", bytes);
+        std::fputs(message, stderr);
+        std::abort();
+    }
+
+    ++s_thread.heap_allocations;
+    s_thread.heap_bytes += bytes;
+    s_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_heap_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void AllocTracker::record_heap_free() noexcept {
+    ++s_thread.heap_frees;
+    s_heap_frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AllocTracker::record_pmr_allocation(usize bytes) noexcept {
+    ++s_thread.pmr_allocations;
+    s_thread.pmr_bytes += bytes;
+    s_pmr_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_pmr_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// CountingResource Implementation
+// ============================================================================
+
+void* CountingResource::do_allocate(usize bytes, usize alignment) {
+    void* ptr = m_upstream->allocate(bytes, alignment);
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    AllocTracker::record_pmr_allocation(bytes);
+    return ptr;
+}
+
+void CountingResource::do_deallocate(void* p, usize bytes, usize alignment) {
+    m_upstream->deallocate(p, bytes, alignment);
+    m_deallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool CountingResource::do_is_equal(const memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace hz
+
+// ============================================================================
+// Global operator new/delete (HZ_ALLOC_TRACKING)
+// ============================================================================
+
+// These live in the same object file as AllocTracker, so any program that
+// links the tracker (the profiler and memory domains do) gets the hooks too.
+
+#ifdef HZ_ALLOC_TRACKING
+
+namespace {
+
+void* raw_allocate(std::size_t size, std::size_t alignment) noexcept {
+    if (size == 0) {
+        size = 1;
+    }
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return std::malloc(size);
+    }
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    // aligned_alloc requires a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+void raw_free(void* ptr, std::size_t alignment) noexcept {
+#ifdef _WIN32
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        _aligned_free(ptr);
+        return;
+    }
+#endif
+    (void)alignment;
+    std::free(ptr);
+}
+
+void* tracked_allocate(std::size_t size, std::size_t alignment) {
+    for (;;) {
+        if (void* ptr = raw_allocate(size, alignment)) {
+            hz::AllocTracker::record_heap_allocation(size);
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            return nullptr;
+        }
+        handler(); // May throw std::bad_alloc
+    }
+}
+
+void* tracked_allocate_or_throw(std::size_t size, std::size_t alignment) {
+    if (void* ptr = tracked_allocate(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void tracked_free(void* ptr, std::size_t alignment) noexcept {
+    if (ptr) {
+        hz::AllocTracker::record_heap_free();
+        raw_free(ptr, alignment);
+    }
+}
+
+constexpr std::size_t DEFAULT_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    return tracked_allocate_or_throw(size, DEFAULT_ALIGNMENT);
+}
+
+void* operator new[](std::size_t size) {
+    return tracked_allocate_or_throw(size, DEFAULT_ALIGNMENT);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_allocate(size, DEFAULT_ALIGNMENT);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_allocate(size, DEFAULT_ALIGNMENT);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return tracked_allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return tracked_allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_allocate(size, static_cast<std::size_t>(alignment));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+    try {
+        return tracked_allocate(size, static_cast<std::size_t>(alignment));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept {
+    tracked_free(ptr, DEFAULT_ALIGNMENT);
+}
+
+void operator delete[](void* ptr) noexcept {
+    tracked_free(ptr, DEFAULT_ALIGNMENT);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    tracked_free(ptr, DEFAULT_ALIGNMENT);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    tracked_free(ptr, DEFAULT_ALIGNMENT);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    tracked_free(ptr, DEFAULT_ALIGNMENT);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    tracked_free(ptr, DEFAULT_ALIGNMENT);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    tracked_free(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+    tracked_free(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    tracked_free(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    tracked_free(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    tracked_free(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    tracked_free(ptr, static_cast<std::size_t>(alignment));
+}
+
+#endif // HZ_ALLOC_TRACKING
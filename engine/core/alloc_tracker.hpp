@@ -0,0 +1,191 @@
+#pragma once
+
+/**
+ * @file alloc_tracker.hpp
+ * @brief Heap and PMR allocation counters per thread, frame and profiler zone
+ *
+ * Two sources feed the counters:
+ * - Heap: with -DHZ_ALLOC_TRACKING=ON the engine replaces the global
+ *   operator new/delete and counts every call. Without it, heap counts stay 0.
+ * - PMR: TrackedPoolResource (every MemoryContext domain) and CountingResource
+ *   count their allocations in every build. Frame arena bumps are not counted.
+ *
+ * Counters are kept per thread, so AllocCounterScope and profiler zones see
+ * only the calling thread's allocations. Process totals are sampled once per
+ * frame by end_frame(). NoAllocScope turns a heap allocation into an abort,
+ * which makes "zero allocations in steady state" a hard gate in tests.
+ */
+
+#include "types.hpp"
+
+#include <atomic>
+#include <memory_resource>
+
+namespace hz {
+
+/**
+ * @brief Allocation counts (bytes are requested sizes)
+ */
+struct AllocCounters {
+    u64 heap_allocations{0};
+    u64 heap_frees{0};
+    u64 heap_bytes{0};
+    u64 pmr_allocations{0};
+    u64 pmr_bytes{0};
+
+    [[nodiscard]] u64 allocations() const noexcept { return heap_allocations + pmr_allocations; }
+
+    [[nodiscard]] AllocCounters operator-(const AllocCounters& other) const noexcept {
+        return {heap_allocations - other.heap_allocations, heap_frees - other.heap_frees,
+                heap_bytes - other.heap_bytes, pmr_allocations - other.pmr_allocations,
+                pmr_bytes - other.pmr_bytes};
+    }
+};
+
+// ============================================================================
+// Allocation Tracker
+// ============================================================================
+
+class AllocTracker {
+public:
+    /// Whether the global operator new/delete hooks are compiled in
+#ifdef HZ_ALLOC_TRACKING
+    static constexpr bool HEAP_HOOKS = true;
+#else
+    static constexpr bool HEAP_HOOKS = false;
+#endif
+
+    /**
+     * @brief Counters of the calling thread since it started
+     */
+    [[nodiscard]] static AllocCounters thread_counters() noexcept { return s_thread; }
+
+    /**
+     * @brief Counters of all threads since startup
+     */
+    [[nodiscard]] static AllocCounters total_counters() noexcept;
+
+    /**
+     * @brief Close the current frame's sample (call once per frame)
+     */
+    static void end_frame() noexcept;
+
+    /**
+     * @brief All threads' allocations between the last two end_frame() calls
+     */
+    [[nodiscard]] static AllocCounters last_frame() noexcept;
+
+    // ========================================================================
+    // Recording (heap hooks, tracked resources)
+    // ========================================================================
+
+    static void record_heap_allocation(usize bytes) noexcept;
+    static void record_heap_free() noexcept;
+    static void record_pmr_allocation(usize bytes) noexcept;
+
+private:
+    friend class NoAllocScope;
+
+    static thread_local AllocCounters s_thread;
+    static thread_local u32 s_forbid_depth;
+
+    static std::atomic<u64> s_heap_allocations;
+    static std::atomic<u64> s_heap_frees;
+    static std::atomic<u64> s_heap_bytes;
+    static std::atomic<u64> s_pmr_allocations;
+    static std::atomic<u64> s_pmr_bytes;
+
+    static AllocCounters s_frame_start;
+    static AllocCounters s_last_frame;
+};
+
+// ============================================================================
+// Scopes
+// ============================================================================
+
+/**
+ * @brief Counts the calling thread's allocations over its lifetime
+ *
+ * @code
+ * AllocCounterScope allocs;
+ * skeleton.calculate_bone_transforms(clip, t, transforms);
+ * REQUIRE(allocs.counters().heap_allocations == 0);
+ * @endcode
+ */
+class AllocCounterScope {
+public:
+    AllocCounterScope() noexcept : m_start(AllocTracker::thread_counters()) {}
+
+    HZ_NON_COPYABLE(AllocCounterScope);
+    HZ_NON_MOVABLE(AllocCounterScope);
+
+    [[nodiscard]] AllocCounters counters() const noexcept {
+        return AllocTracker::thread_counters() - m_start;
+    }
+
+    [[nodiscard]] u64 allocations() const noexcept { return counters().allocations(); }
+
+private:
+    AllocCounters m_start;
+};
+
+/**
+ * @brief Aborts on any heap allocation by the calling thread while alive
+ *
+ * Prints the size of the offending allocation to stderr before aborting, so
+ * the culprit shows up at the top of the debugger's stack. Only has an effect
+ * with HZ_ALLOC_TRACKING; PMR allocations are allowed.
+ */
+class NoAllocScope {
+public:
+    NoAllocScope() noexcept { ++AllocTracker::s_forbid_depth; }
+    ~NoAllocScope() { --AllocTracker::s_forbid_depth; }
+
+    HZ_NON_COPYABLE(NoAllocScope);
+    HZ_NON_MOVABLE(NoAllocScope);
+};
+
+// ============================================================================
+// Counting Resource
+// ============================================================================
+
+/**
+ * @brief PMR wrapper that counts allocations made through an upstream resource
+ *
+ * Feeds the per-thread counters (and so frames and zones) as PMR allocations,
+ * and keeps its own totals. Deallocations are forwarded unchanged.
+ */
+class CountingResource final : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : m_upstream(upstream) {}
+
+    HZ_NON_COPYABLE(CountingResource);
+    HZ_NON_MOVABLE(CountingResource);
+
+    [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept { return m_upstream; }
+
+    [[nodiscard]] u64 allocations() const noexcept {
+        return m_allocations.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] u64 deallocations() const noexcept {
+        return m_deallocations.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] u64 bytes_allocated() const noexcept {
+        return m_bytes.load(std::memory_order_relaxed);
+    }
+
+protected:
+    void* do_allocate(usize bytes, usize alignment) override;
+    void do_deallocate(void* p, usize bytes, usize alignment) override;
+    [[nodiscard]] bool do_is_equal(const memory_resource& other) const noexcept override;
+
+private:
+    std::pmr::memory_resource* m_upstream;
+    std::atomic<u64> m_allocations{0};
+    std::atomic<u64> m_deallocations{0};
+    std::atomic<u64> m_bytes{0};
+};
+
+} // namespace hz
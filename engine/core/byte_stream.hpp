@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file byte_stream.hpp
+ * @brief Append-only byte writer and bounds-checked reader for binary file formats
+ */
+
+#include "types.hpp"
+
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace hz {
+
+class ByteWriter {
+public:
+    explicit ByteWriter(std::vector<u8>& bytes) : m_bytes(bytes) {}
+
+    void write(const void* data, usize size) {
+        const auto* begin = static_cast<const u8*>(data);
+        m_bytes.insert(m_bytes.end(), begin, begin + size);
+    }
+
+    template <typename T>
+    void write_value(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write(&value, sizeof(T));
+    }
+
+private:
+    std::vector<u8>& m_bytes;
+};
+
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const u8> bytes) : m_bytes(bytes) {}
+
+    /**
+     * @return false, without reading, if fewer than size bytes remain
+     */
+    [[nodiscard]] bool read(void* out, usize size) {
+        if (size > remaining()) {
+            return false;
+        }
+        if (size > 0) {
+            std::memcpy(out, m_bytes.data() + m_position, size);
+        }
+        m_position += size;
+        return true;
+    }
+
+    template <typename T>
+    [[nodiscard]] bool read_value(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return read(&value, sizeof(T));
+    }
+
+    [[nodiscard]] usize remaining() const noexcept { return m_bytes.size() - m_position; }
+
+private:
+    std::span<const u8> m_bytes;
+    usize m_position{0};
+};
+
+} // namespace hz
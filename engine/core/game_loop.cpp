@@ -1,44 +1,70 @@
 #include "game_loop.hpp"
 
+#include "alloc_tracker.hpp"
 #include "engine/platform/platform.hpp"
 #include "log.hpp"
 #include "memory.hpp"
+#include "profiler.hpp"
 
 #include <algorithm>
+#include <thread>
 
 namespace hz {
 
-GameLoop::GameLoop(const GameLoopConfig& config) : m_config(config) {
+GameLoop::GameLoop(const GameLoopConfig& config)
+    : m_config(config)
+    , m_telemetry(config.telemetry) {
     HZ_ENGINE_DEBUG("Game loop created: fixed timestep = {:.4f}s ({:.1f} Hz)",
                     config.fixed_timestep, 1.0 / config.fixed_timestep);
 }
 
 void GameLoop::run() {
-    m_running = true;
-    m_simulation_time = 0.0;
+    m_running.store(true, std::memory_order_release);
+    m_simulation_time.store(0.0, std::memory_order_release);
+    m_tick_count.store(0, std::memory_order_release);
     m_total_time = 0.0;
     m_fps_timer = 0.0;
     m_frame_count = 0;
+    m_telemetry.reset();
 
+    HZ_ENGINE_INFO("Game loop started{}", m_config.pipelined ? " (pipelined)" : "");
+    HZ_PROFILE_THREAD("Main");
+
+    if (m_config.pipelined) {
+        run_pipelined();
+    } else {
+        run_serial();
+    }
+
+    if (!m_config.telemetry_path.empty()) {
+        m_telemetry.write(m_config.telemetry_path);
+    }
+
+    HZ_ENGINE_INFO("Game loop stopped");
+}
+
+void GameLoop::run_serial() {
     Clock clock;
     f64 accumulator = 0.0;
 
-    HZ_ENGINE_INFO("Game loop started");
-
-    while (m_running) {
+    while (is_running()) {
         // Check quit condition
         if (m_should_quit && m_should_quit()) {
-            m_running = false;
+            quit();
             break;
         }
 
         // Calculate frame time
-        f64 frame_time = clock.restart();
-        frame_time = std::min(frame_time, m_config.max_frame_time);
+        const f64 raw_frame_time = clock.restart();
+        if (raw_frame_time > m_config.max_frame_time) {
+            m_telemetry.record_clamp();
+        }
+        const f64 frame_time = std::min(raw_frame_time, m_config.max_frame_time);
         m_total_time += frame_time;
 
         // Input phase
         if (m_on_input) {
+            HZ_PROFILE_SCOPE("Input");
             m_on_input();
         }
 
@@ -47,10 +73,7 @@ void GameLoop::run() {
         m_updates_this_frame = 0;
 
         while (accumulator >= m_config.fixed_timestep) {
-            if (m_on_update) {
-                m_on_update(m_config.fixed_timestep);
-            }
-            m_simulation_time += m_config.fixed_timestep;
+            tick();
             accumulator -= m_config.fixed_timestep;
             ++m_updates_this_frame;
         }
@@ -61,14 +84,115 @@ void GameLoop::run() {
         // Render phase (with interpolation alpha)
         f64 alpha = accumulator / m_config.fixed_timestep;
         if (m_on_render) {
+            HZ_PROFILE_SCOPE("Render");
             m_on_render(alpha);
         }
 
         // Update FPS counter
+        m_telemetry.record_frame(raw_frame_time, m_updates_this_frame);
+        AllocTracker::end_frame();
         update_fps_counter(frame_time);
+        HZ_PROFILE_FRAME();
     }
+}
 
-    HZ_ENGINE_INFO("Game loop stopped");
+void GameLoop::run_pipelined() {
+    const Clock clock;
+    m_tick_reference.store(0.0, std::memory_order_release);
+    m_ticks_since_render.store(0, std::memory_order_release);
+
+    std::thread simulation([this, &clock] { simulation_main(clock); });
+
+    f64 last_time = 0.0;
+    while (is_running()) {
+        if (m_should_quit && m_should_quit()) {
+            quit();
+            break;
+        }
+
+        const f64 now = clock.elapsed();
+        const f64 frame_time = now - last_time;
+        last_time = now;
+        m_total_time = now;
+
+        if (m_on_input) {
+            HZ_PROFILE_SCOPE("Input");
+            m_on_input();
+        }
+
+        // Frame arenas may only be reset between ticks
+        {
+            std::lock_guard lock(m_tick_mutex);
+            MemoryContext::reset_frame();
+        }
+
+        m_updates_this_frame = m_ticks_since_render.exchange(0, std::memory_order_acq_rel);
+
+        // Same alpha as the serial loop: time since the latest tick, in ticks
+        const f64 since_tick = now - m_tick_reference.load(std::memory_order_acquire);
+        const f64 alpha = std::clamp(since_tick / m_config.fixed_timestep, 0.0, 1.0);
+        if (m_on_render) {
+            HZ_PROFILE_SCOPE("Render");
+            m_on_render(alpha);
+        }
+
+        m_telemetry.record_frame(frame_time, m_updates_this_frame);
+        AllocTracker::end_frame();
+        update_fps_counter(frame_time);
+        HZ_PROFILE_FRAME();
+    }
+
+    simulation.join();
+}
+
+void GameLoop::simulation_main(const Clock& clock) {
+    HZ_PROFILE_THREAD("Simulation");
+    const f64 dt = m_config.fixed_timestep;
+    f64 accumulator = 0.0;
+    f64 last_time = clock.elapsed();
+
+    while (is_running()) {
+        const f64 now = clock.elapsed();
+        if (now - last_time > m_config.max_frame_time) {
+            m_telemetry.record_clamp();
+        }
+        accumulator += std::min(now - last_time, m_config.max_frame_time);
+        last_time = now;
+
+        while (accumulator >= dt && is_running()) {
+            tick();
+            accumulator -= dt;
+            m_ticks_since_render.fetch_add(1, std::memory_order_acq_rel);
+        }
+        m_tick_reference.store(now - accumulator, std::memory_order_release);
+
+        // Sleep until the next tick is due
+        std::this_thread::sleep_for(Clock::Duration(dt - accumulator));
+    }
+}
+
+void GameLoop::tick() {
+    HZ_PROFILE_SCOPE("Tick");
+    std::lock_guard lock(m_tick_mutex);
+
+    m_systems.execute(m_config.fixed_timestep);
+    if (!m_systems.empty()) {
+        m_telemetry.record_systems(m_systems);
+    }
+    if (m_on_update) {
+        HZ_PROFILE_SCOPE("Update");
+        m_on_update(m_config.fixed_timestep);
+    }
+
+    const f64 simulation_time =
+        m_simulation_time.load(std::memory_order_relaxed) + m_config.fixed_timestep;
+    m_simulation_time.store(simulation_time, std::memory_order_release);
+    const u64 tick = m_tick_count.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    if (m_on_publish) {
+        HZ_PROFILE_SCOPE("Publish");
+        m_on_publish(tick, simulation_time);
+    }
 }
 
 void GameLoop::update_fps_counter(f64 frame_time) {
@@ -80,6 +204,9 @@ void GameLoop::update_fps_counter(f64 frame_time) {
 
         if (m_config.log_fps) {
             HZ_ENGINE_DEBUG("FPS: {:.1f}", m_fps);
+            m_telemetry.log_report();
+            log_critical_path();
+            log_allocations();
         }
 
         m_frame_count = 0;
@@ -87,4 +214,38 @@ void GameLoop::update_fps_counter(f64 frame_time) {
     }
 }
 
+void GameLoop::log_allocations() const {
+    const AllocCounters frame = AllocTracker::last_frame();
+    if constexpr (AllocTracker::HEAP_HOOKS) {
+        HZ_ENGINE_DEBUG("Allocations last frame: {} heap ({} bytes), {} pmr ({} bytes)",
+                        frame.heap_allocations, frame.heap_bytes, frame.pmr_allocations,
+                        frame.pmr_bytes);
+    } else {
+        HZ_ENGINE_DEBUG("Allocations last frame: {} pmr ({} bytes)", frame.pmr_allocations,
+                        frame.pmr_bytes);
+    }
+}
+
+void GameLoop::log_critical_path() {
+    if (m_systems.empty()) {
+        return;
+    }
+
+    // In pipelined mode the simulation thread rewrites the stats every tick
+    TaskGraphStats stats;
+    std::string path;
+    {
+        std::lock_guard lock(m_tick_mutex);
+        stats = m_systems.stats();
+        for (u32 index : stats.critical_path) {
+            if (!path.empty()) {
+                path += " -> ";
+            }
+            path += m_systems.system_name(index);
+        }
+    }
+    HZ_ENGINE_DEBUG("Update: {:.2f} ms wall, {:.2f} ms serial, critical path {:.2f} ms ({})",
+                    stats.wall_ms, stats.serial_ms, stats.critical_path_ms, path);
+}
+
 } // namespace hz
@@ -8,14 +8,26 @@
  * - Input polling
  * - Fixed timestep simulation (deterministic)
  * - Variable rendering (with interpolation alpha)
+ *
+ * In pipelined mode the fixed-timestep updates run on a dedicated simulation
+ * thread and the calling thread only handles input and rendering. The
+ * simulation hands state to the renderer through the publish callback (e.g.
+ * into a TripleBuffer of snapshots), so neither side waits for the other.
  */
 
+#include "task_graph.hpp"
+#include "telemetry.hpp"
 #include "types.hpp"
 
+#include <atomic>
 #include <functional>
+#include <mutex>
+#include <string>
 
 namespace hz {
 
+class Clock;
+
 // ============================================================================
 // Game Loop Configuration
 // ============================================================================
@@ -25,6 +37,9 @@ struct GameLoopConfig {
     f64 max_frame_time{0.25};       // Cap to avoid spiral of death
     bool log_fps{true};             // Log FPS periodically
     f64 fps_log_interval{5.0};      // Log every 5 seconds
+    bool pipelined{false};          // Run updates on a separate simulation thread
+    TelemetryConfig telemetry;      // Frame-time histograms, logged with the FPS
+    std::string telemetry_path;     // Written when run() returns (.json or .csv); empty = off
 };
 
 // ============================================================================
@@ -35,6 +50,7 @@ using InputCallback = std::function<void()>;
 using UpdateCallback = std::function<void(f64 dt)>;
 using RenderCallback = std::function<void(f64 alpha)>;
 using ShouldQuitCallback = std::function<bool()>;
+using PublishCallback = std::function<void(u64 tick, f64 simulation_time)>;
 
 // ============================================================================
 // Game Loop
@@ -58,12 +74,14 @@ public:
     /**
      * @brief Request the loop to stop
      */
-    void quit() { m_running = false; }
+    void quit() { m_running.store(false, std::memory_order_release); }
 
     /**
      * @brief Check if the loop is running
      */
-    [[nodiscard]] bool is_running() const noexcept { return m_running; }
+    [[nodiscard]] bool is_running() const noexcept {
+        return m_running.load(std::memory_order_acquire);
+    }
 
     // ========================================================================
     // Callback Registration
@@ -74,6 +92,27 @@ public:
     void set_render_callback(RenderCallback cb) { m_on_render = std::move(cb); }
     void set_should_quit_callback(ShouldQuitCallback cb) { m_should_quit = std::move(cb); }
 
+    /**
+     * @brief Called after every fixed update with the completed tick
+     *
+     * Runs on the simulation thread in pipelined mode; publish immutable
+     * render state here.
+     */
+    void set_publish_callback(PublishCallback cb) { m_on_publish = std::move(cb); }
+
+    /**
+     * @brief Register an update system
+     *
+     * Systems run every fixed tick as a dependency graph (see TaskGraph),
+     * before the update callback.
+     */
+    TaskGraph::SystemBuilder add_system(std::string name, SystemFunction fn) {
+        return m_systems.add_system(std::move(name), std::move(fn));
+    }
+
+    [[nodiscard]] TaskGraph& systems() noexcept { return m_systems; }
+    [[nodiscard]] const TaskGraph& systems() const noexcept { return m_systems; }
+
     // ========================================================================
     // Timing Info
     // ========================================================================
@@ -86,7 +125,16 @@ public:
     /**
      * @brief Get the current simulation time
      */
-    [[nodiscard]] f64 simulation_time() const noexcept { return m_simulation_time; }
+    [[nodiscard]] f64 simulation_time() const noexcept {
+        return m_simulation_time.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the number of completed fixed updates
+     */
+    [[nodiscard]] u64 tick_count() const noexcept {
+        return m_tick_count.load(std::memory_order_acquire);
+    }
 
     /**
      * @brief Get the total elapsed time
@@ -100,21 +148,38 @@ public:
 
     /**
      * @brief Get the number of updates per frame (for debugging)
+     *
+     * In pipelined mode, the number of ticks since the previous render.
      */
     [[nodiscard]] u32 updates_per_frame() const noexcept { return m_updates_this_frame; }
 
+    /**
+     * @brief Frame-time, tick and system histograms for the current run
+     */
+    [[nodiscard]] const FrameTelemetry& telemetry() const noexcept { return m_telemetry; }
+
 private:
+    void run_serial();
+    void run_pipelined();
+    void simulation_main(const Clock& clock);
+    void tick();
     void update_fps_counter(f64 frame_time);
+    void log_critical_path();
+    void log_allocations() const;
 
     GameLoopConfig m_config;
-    bool m_running{false};
+    std::atomic<bool> m_running{false};
 
     InputCallback m_on_input;
     UpdateCallback m_on_update;
     RenderCallback m_on_render;
     ShouldQuitCallback m_should_quit;
+    PublishCallback m_on_publish;
+    TaskGraph m_systems;
+    FrameTelemetry m_telemetry;
 
-    f64 m_simulation_time{0.0};
+    std::atomic<f64> m_simulation_time{0.0};
+    std::atomic<u64> m_tick_count{0};
     f64 m_total_time{0.0};
     f64 m_fps{0.0};
     u32 m_updates_this_frame{0};
@@ -122,6 +187,11 @@ private:
     // FPS tracking
     f64 m_fps_timer{0.0};
     u32 m_frame_count{0};
+
+    // Pipelined mode
+    std::mutex m_tick_mutex;                // Held for ticks, frame memory resets and stats reads
+    std::atomic<f64> m_tick_reference{0.0}; // Clock time at which the latest tick has alpha 0
+    std::atomic<u32> m_ticks_since_render{0};
 };
 
 } // namespace hz
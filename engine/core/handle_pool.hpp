@@ -0,0 +1,215 @@
+#pragma once
+
+/**
+ * @file handle_pool.hpp
+ * @brief Dense object pool addressed by generational handles
+ *
+ * Objects live contiguously in a dense array so iteration touches only live
+ * data. A sparse slot table maps handle indices to dense positions and carries
+ * the generation used to reject stale handles. All operations are O(1).
+ */
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace hz {
+
+/**
+ * @brief Fixed-size object pool issuing GenerationalHandle<Tag>
+ *
+ * Erasing swaps the last object into the freed dense position, so pointers
+ * and dense indices are invalidated by erase(); handles are not.
+ *
+ * @tparam T Stored object type (must be move-constructible)
+ * @tparam Tag Phantom type for the issued handles (defaults to T)
+ */
+template <typename T, typename Tag = T>
+class HandlePool {
+public:
+    using HandleType = GenerationalHandle<Tag>;
+    using value_type = T;
+    using iterator = typename std::pmr::vector<T>::iterator;
+    using const_iterator = typename std::pmr::vector<T>::const_iterator;
+
+    /**
+     * @brief Create an empty pool
+     * @param resource Backing memory, e.g. MemoryContext::get(MemoryDomain::Assets)
+     */
+    explicit HandlePool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_dense(resource)
+        , m_dense_to_slot(resource)
+        , m_slots(resource)
+        , m_free_slots(resource) {}
+
+    HZ_NON_COPYABLE(HandlePool);
+    HZ_DEFAULT_MOVABLE(HandlePool);
+
+    /**
+     * @brief Construct a new object in place
+     *
+     * Strong exception guarantee: if allocation or T's constructor throws,
+     * the pool is unchanged.
+     */
+    template <typename... Args>
+    [[nodiscard]] HandleType emplace(Args&&... args) {
+        // Make room first, so nothing after the construction can throw
+        reserve_one(m_dense_to_slot);
+        if (m_free_slots.empty()) {
+            reserve_one(m_slots);
+        }
+        m_dense.emplace_back(std::forward<Args>(args)...);
+
+        u32 slot_index;
+        if (!m_free_slots.empty()) {
+            slot_index = m_free_slots.back();
+            m_free_slots.pop_back();
+        } else {
+            slot_index = static_cast<u32>(m_slots.size());
+            m_slots.push_back({INVALID_DENSE, FIRST_GENERATION});
+        }
+        m_dense_to_slot.push_back(slot_index);
+
+        Slot& slot = m_slots[slot_index];
+        slot.dense_index = static_cast<u32>(m_dense.size() - 1);
+        return {slot_index, slot.generation};
+    }
+
+    /**
+     * @brief Insert an object
+     */
+    [[nodiscard]] HandleType insert(T value) { return emplace(std::move(value)); }
+
+    /**
+     * @brief Destroy the object referenced by a handle
+     * @return false if the handle was stale or invalid
+     */
+    bool erase(HandleType handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        Slot& slot = m_slots[handle.index];
+        const u32 dense_index = slot.dense_index;
+        const u32 last_index = static_cast<u32>(m_dense.size() - 1);
+
+        if (dense_index != last_index) {
+            m_dense[dense_index] = std::move(m_dense[last_index]);
+            m_dense_to_slot[dense_index] = m_dense_to_slot[last_index];
+            m_slots[m_dense_to_slot[dense_index]].dense_index = dense_index;
+        }
+        m_dense.pop_back();
+        m_dense_to_slot.pop_back();
+
+        slot.dense_index = INVALID_DENSE;
+        if (++slot.generation == HandleType::INVALID_GENERATION) {
+            slot.generation = FIRST_GENERATION;
+        }
+        m_free_slots.push_back(handle.index);
+        return true;
+    }
+
+    /**
+     * @brief Check whether a handle refers to a live object
+     */
+    [[nodiscard]] bool contains(HandleType handle) const noexcept {
+        if (handle.index >= m_slots.size()) {
+            return false;
+        }
+        const Slot& slot = m_slots[handle.index];
+        return slot.generation == handle.generation && slot.dense_index != INVALID_DENSE;
+    }
+
+    /**
+     * @brief Resolve a handle, returning nullptr if it is stale
+     */
+    [[nodiscard]] T* get(HandleType handle) noexcept {
+        return contains(handle) ? &m_dense[m_slots[handle.index].dense_index] : nullptr;
+    }
+
+    [[nodiscard]] const T* get(HandleType handle) const noexcept {
+        return contains(handle) ? &m_dense[m_slots[handle.index].dense_index] : nullptr;
+    }
+
+    /**
+     * @brief Get the handle of the object at a dense position
+     */
+    [[nodiscard]] HandleType handle_at(usize dense_index) const noexcept {
+        const u32 slot_index = m_dense_to_slot[dense_index];
+        return {slot_index, m_slots[slot_index].generation};
+    }
+
+    /**
+     * @brief Visit every live object together with its handle
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (usize i = 0; i < m_dense.size(); ++i) {
+            fn(handle_at(i), m_dense[i]);
+        }
+    }
+
+    /**
+     * @brief Destroy all objects; outstanding handles become stale
+     */
+    void clear() {
+        for (u32 slot_index : m_dense_to_slot) {
+            Slot& slot = m_slots[slot_index];
+            slot.dense_index = INVALID_DENSE;
+            if (++slot.generation == HandleType::INVALID_GENERATION) {
+                slot.generation = FIRST_GENERATION;
+            }
+            m_free_slots.push_back(slot_index);
+        }
+        m_dense.clear();
+        m_dense_to_slot.clear();
+    }
+
+    void reserve(usize count) {
+        m_dense.reserve(count);
+        m_dense_to_slot.reserve(count);
+        m_slots.reserve(count);
+        m_free_slots.reserve(count);
+    }
+
+    [[nodiscard]] usize size() const noexcept { return m_dense.size(); }
+    [[nodiscard]] bool empty() const noexcept { return m_dense.empty(); }
+
+    [[nodiscard]] T* data() noexcept { return m_dense.data(); }
+    [[nodiscard]] const T* data() const noexcept { return m_dense.data(); }
+
+    [[nodiscard]] iterator begin() noexcept { return m_dense.begin(); }
+    [[nodiscard]] iterator end() noexcept { return m_dense.end(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return m_dense.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return m_dense.end(); }
+
+private:
+    static constexpr u32 INVALID_DENSE = std::numeric_limits<u32>::max();
+    static constexpr u32 FIRST_GENERATION = 1;
+
+    struct Slot {
+        u32 dense_index;
+        u32 generation;
+    };
+
+    /**
+     * @brief Ensure one push_back cannot reallocate, growing geometrically
+     */
+    template <typename U>
+    static void reserve_one(std::pmr::vector<U>& vector) {
+        if (vector.size() == vector.capacity()) {
+            vector.reserve(std::max<usize>(vector.capacity() * 2, 8));
+        }
+    }
+
+    std::pmr::vector<T> m_dense;
+    std::pmr::vector<u32> m_dense_to_slot;
+    std::pmr::vector<Slot> m_slots;
+    std::pmr::vector<u32> m_free_slots;
+};
+
+} // namespace hz
@@ -0,0 +1,89 @@
+#include "headless_runner.hpp"
+
+#include "engine/platform/platform.hpp"
+#include "log.hpp"
+#include "memory.hpp"
+#include "profiler.hpp"
+
+#include <thread>
+
+namespace hz {
+
+HeadlessRunner::HeadlessRunner(const HeadlessRunnerConfig& config) : m_config(config) {
+    HZ_ENGINE_DEBUG("Headless runner created: fixed timestep = {:.4f}s, time scale = {}",
+                    config.fixed_timestep, config.time_scale);
+}
+
+HeadlessRunnerStats HeadlessRunner::run() {
+    m_running.store(true, std::memory_order_release);
+    m_tick_count.store(0, std::memory_order_release);
+
+    const f64 dt = m_config.fixed_timestep;
+    const Clock clock;
+    const AllocCounters allocations_at_start = AllocTracker::total_counters();
+    f64 last_log_time = 0.0;
+    u64 last_log_ticks = 0;
+
+    HZ_ENGINE_INFO("Headless run started");
+
+    while (is_running()) {
+        if (m_config.max_ticks != 0 && tick_count() >= m_config.max_ticks) {
+            break;
+        }
+        if (m_should_quit && m_should_quit()) {
+            break;
+        }
+
+        // Pace against the virtual clock: tick N is due at N * dt / time_scale
+        if (m_config.time_scale > 0.0) {
+            const f64 due = simulation_time() / m_config.time_scale;
+            const f64 ahead = due - clock.elapsed();
+            if (ahead > 0.0) {
+                std::this_thread::sleep_for(Clock::Duration(ahead));
+            }
+        }
+
+        {
+            HZ_PROFILE_SCOPE("Tick");
+            m_systems.execute(dt);
+            if (m_on_update) {
+                HZ_PROFILE_SCOPE("Update");
+                m_on_update(dt);
+            }
+        }
+        m_tick_count.fetch_add(1, std::memory_order_acq_rel);
+
+        // Every tick is a frame as far as frame memory and profiling are concerned
+        MemoryContext::reset_frame();
+        AllocTracker::end_frame();
+        HZ_PROFILE_FRAME();
+
+        if (m_config.log_stats) {
+            const f64 now = clock.elapsed();
+            if (now - last_log_time >= m_config.stats_log_interval) {
+                const u64 ticks = tick_count();
+                HZ_ENGINE_DEBUG("Headless: {:.0f} ticks/s",
+                                static_cast<f64>(ticks - last_log_ticks) / (now - last_log_time));
+                last_log_time = now;
+                last_log_ticks = ticks;
+            }
+        }
+    }
+    m_running.store(false, std::memory_order_release);
+
+    m_stats.ticks = tick_count();
+    m_stats.simulation_time = simulation_time();
+    m_stats.wall_time = clock.elapsed();
+    m_stats.ticks_per_second =
+        m_stats.wall_time > 0.0 ? static_cast<f64>(m_stats.ticks) / m_stats.wall_time : 0.0;
+    m_stats.speedup = m_stats.wall_time > 0.0 ? m_stats.simulation_time / m_stats.wall_time : 0.0;
+    m_stats.allocations = AllocTracker::total_counters() - allocations_at_start;
+
+    HZ_ENGINE_INFO("Headless run stopped: {} ticks, {:.2f}s simulated in {:.2f}s ({:.0f} ticks/s, "
+                   "{:.1f}x real time)",
+                   m_stats.ticks, m_stats.simulation_time, m_stats.wall_time,
+                   m_stats.ticks_per_second, m_stats.speedup);
+    return m_stats;
+}
+
+} // namespace hz
@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * @file headless_runner.hpp
+ * @brief Fixed-timestep simulation driver with a virtual clock
+ *
+ * Runs the same update systems as GameLoop without a window, renderer or
+ * wall-clock coupling: simulation time advances exactly one fixed step per
+ * tick, and ticks run back to back or paced at a multiple of real time.
+ * Intended for soak tests, bot matches and dedicated servers.
+ */
+
+#include "alloc_tracker.hpp"
+#include "task_graph.hpp"
+#include "types.hpp"
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace hz {
+
+// ============================================================================
+// Headless Runner Configuration
+// ============================================================================
+
+struct HeadlessRunnerConfig {
+    f64 fixed_timestep{1.0 / 60.0}; // 60 Hz simulation
+    f64 time_scale{0.0};            // Simulated seconds per real second; 0 = unthrottled
+    u64 max_ticks{0};               // Stop after this many ticks; 0 = until quit()
+    bool log_stats{true};           // Log ticks/second periodically
+    f64 stats_log_interval{5.0};    // Wall seconds between logs
+};
+
+/**
+ * @brief Throughput of a headless run
+ */
+struct HeadlessRunnerStats {
+    u64 ticks{0};
+    f64 simulation_time{0.0}; // Virtual seconds simulated
+    f64 wall_time{0.0};       // Real seconds elapsed
+    f64 ticks_per_second{0.0};
+    f64 speedup{0.0};          // simulation_time / wall_time
+    AllocCounters allocations; // All threads, over the whole run
+};
+
+// ============================================================================
+// Headless Runner
+// ============================================================================
+
+/**
+ * @brief Steps the fixed-timestep simulation against a virtual clock
+ */
+class HeadlessRunner {
+public:
+    using UpdateCallback = std::function<void(f64 dt)>;
+    using ShouldQuitCallback = std::function<bool()>;
+
+    explicit HeadlessRunner(const HeadlessRunnerConfig& config = {});
+
+    HZ_NON_COPYABLE(HeadlessRunner);
+    HZ_NON_MOVABLE(HeadlessRunner);
+
+    /**
+     * @brief Run until max_ticks, quit() or the should-quit callback
+     * @return Statistics for the run
+     */
+    HeadlessRunnerStats run();
+
+    /**
+     * @brief Request the run to stop after the current tick (thread-safe)
+     */
+    void quit() { m_running.store(false, std::memory_order_release); }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return m_running.load(std::memory_order_acquire);
+    }
+
+    // ========================================================================
+    // Systems & Callbacks
+    // ========================================================================
+
+    /**
+     * @brief Register an update system (see GameLoop::add_system)
+     */
+    TaskGraph::SystemBuilder add_system(std::string name, SystemFunction fn) {
+        return m_systems.add_system(std::move(name), std::move(fn));
+    }
+
+    [[nodiscard]] TaskGraph& systems() noexcept { return m_systems; }
+
+    /**
+     * @brief Called every tick after the systems
+     */
+    void set_update_callback(UpdateCallback cb) { m_on_update = std::move(cb); }
+
+    /**
+     * @brief Polled before every tick
+     */
+    void set_should_quit_callback(ShouldQuitCallback cb) { m_should_quit = std::move(cb); }
+
+    // ========================================================================
+    // Timing Info
+    // ========================================================================
+
+    [[nodiscard]] f64 fixed_timestep() const noexcept { return m_config.fixed_timestep; }
+
+    /**
+     * @brief Virtual simulation time: tick_count() * fixed_timestep()
+     */
+    [[nodiscard]] f64 simulation_time() const noexcept {
+        return static_cast<f64>(tick_count()) * m_config.fixed_timestep;
+    }
+
+    [[nodiscard]] u64 tick_count() const noexcept {
+        return m_tick_count.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Statistics of the last completed run
+     */
+    [[nodiscard]] const HeadlessRunnerStats& stats() const noexcept { return m_stats; }
+
+private:
+    HeadlessRunnerConfig m_config;
+    std::atomic<bool> m_running{false};
+    std::atomic<u64> m_tick_count{0};
+
+    TaskGraph m_systems;
+    UpdateCallback m_on_update;
+    ShouldQuitCallback m_should_quit;
+
+    HeadlessRunnerStats m_stats;
+};
+
+} // namespace hz
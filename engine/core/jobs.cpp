@@ -0,0 +1,206 @@
+#include "jobs.hpp"
+
+#include "log.hpp"
+#include "profiler.hpp"
+
+#include <deque>
+
+namespace hz {
+
+// ============================================================================
+// Internal Types
+// ============================================================================
+
+struct JobSystem::Job {
+    JobFunction fn;
+    JobCounter* counter{nullptr};
+};
+
+struct JobSystem::WorkQueue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+};
+
+// ============================================================================
+// Static Members
+// ============================================================================
+
+std::vector<std::thread> JobSystem::s_workers;
+std::vector<std::unique_ptr<JobSystem::WorkQueue>> JobSystem::s_queues;
+std::mutex JobSystem::s_sleep_mutex;
+std::condition_variable JobSystem::s_wake;
+std::atomic<u32> JobSystem::s_queued_jobs{0};
+std::atomic<bool> JobSystem::s_running{false};
+thread_local u32 JobSystem::s_thread_index = 0;
+bool JobSystem::s_initialized = false;
+
+// ============================================================================
+// JobSystem Implementation
+// ============================================================================
+
+void JobSystem::init(const JobSystemConfig& config) {
+    if (s_initialized) {
+        HZ_ENGINE_WARN("JobSystem already initialized");
+        return;
+    }
+
+    u32 worker_count = config.worker_count;
+    if (worker_count == 0) {
+        const u32 hardware = std::thread::hardware_concurrency();
+        worker_count = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    s_queues.clear();
+    for (u32 i = 0; i <= worker_count; ++i) {
+        s_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    s_running.store(true, std::memory_order_release);
+    s_workers.reserve(worker_count);
+    for (u32 i = 1; i <= worker_count; ++i) {
+        s_workers.emplace_back(worker_main, i);
+    }
+
+    s_initialized = true;
+    HZ_ENGINE_INFO("Job system initialized ({} workers)", worker_count);
+}
+
+void JobSystem::shutdown() {
+    if (!s_initialized) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(s_sleep_mutex);
+        s_running.store(false, std::memory_order_release);
+    }
+    s_wake.notify_all();
+
+    for (auto& worker : s_workers) {
+        worker.join();
+    }
+    s_workers.clear();
+
+    // Anything submitted from the main thread after the workers drained
+    Job job;
+    while (try_pop(job)) {
+        execute(job);
+    }
+    s_queues.clear();
+
+    s_initialized = false;
+    HZ_ENGINE_INFO("Job system shutdown");
+}
+
+void JobSystem::run(JobFunction job, JobCounter* counter) {
+    if (!s_initialized || s_workers.empty()) {
+        job();
+        return;
+    }
+
+    if (counter) {
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    push({std::move(job), counter});
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    while (!counter.is_done()) {
+        Job job;
+        if (s_initialized && try_pop(job)) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::try_run_one() {
+    Job job;
+    if (!s_initialized || !try_pop(job)) {
+        return false;
+    }
+    execute(job);
+    return true;
+}
+
+void JobSystem::worker_main(u32 index) {
+    s_thread_index = index;
+    HZ_PROFILE_THREAD("Worker " + std::to_string(index));
+
+    while (true) {
+        Job job;
+        if (try_pop(job)) {
+            execute(job);
+            continue;
+        }
+
+        std::unique_lock lock(s_sleep_mutex);
+        s_wake.wait(lock, [] {
+            return s_queued_jobs.load(std::memory_order_acquire) > 0 ||
+                   !s_running.load(std::memory_order_acquire);
+        });
+        if (!s_running.load(std::memory_order_acquire) &&
+            s_queued_jobs.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+void JobSystem::push(Job job) {
+    WorkQueue& queue = *s_queues[s_thread_index];
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    s_queued_jobs.fetch_add(1, std::memory_order_release);
+
+    // Taking the sleep mutex orders this push against a worker that has just
+    // checked the predicate and is about to block
+    { std::lock_guard lock(s_sleep_mutex); }
+    s_wake.notify_one();
+}
+
+bool JobSystem::try_pop(Job& out) {
+    if (s_queued_jobs.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    const usize queue_count = s_queues.size();
+    const usize self = s_thread_index;
+
+    // Own queue first, newest job first
+    {
+        WorkQueue& queue = *s_queues[self];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            out = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            s_queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal the oldest job from everyone else, starting with our neighbour
+    for (usize offset = 1; offset < queue_count; ++offset) {
+        WorkQueue& queue = *s_queues[(self + offset) % queue_count];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            out = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            s_queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::execute(Job& job) {
+    job.fn();
+    if (job.counter) {
+        job.counter->m_pending.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+} // namespace hz
@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file jobs.hpp
+ * @brief Engine-wide work-stealing job system
+ *
+ * A fixed set of worker threads, each with its own deque. Owners push and pop
+ * at the back (LIFO, cache-warm); idle workers steal from the front of other
+ * queues. Threads that are not workers (the main thread, tools) submit to a
+ * shared queue and help execute jobs while they wait on a JobCounter, so
+ * fork/join never blocks a thread that could be doing work.
+ */
+
+#include "types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hz {
+
+using JobFunction = std::function<void()>;
+
+/**
+ * @brief Job system configuration
+ */
+struct JobSystemConfig {
+    u32 worker_count{0}; // 0 = one per hardware thread, minus the main thread
+};
+
+/**
+ * @brief Dependency counter for a group of jobs
+ *
+ * Incremented when a job is submitted against it and decremented when that
+ * job finishes. JobSystem::wait() returns once it reaches zero.
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+
+    HZ_NON_COPYABLE(JobCounter);
+    HZ_NON_MOVABLE(JobCounter);
+
+    [[nodiscard]] bool is_done() const noexcept {
+        return m_pending.load(std::memory_order_acquire) == 0;
+    }
+
+    [[nodiscard]] u32 pending() const noexcept { return m_pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<u32> m_pending{0};
+};
+
+/**
+ * @brief Static work-stealing job scheduler
+ *
+ * Before init() (or with zero workers) every job runs inline on the calling
+ * thread, so code written against the job system works unchanged in tests and
+ * single-threaded tools. Jobs must not throw.
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Start the worker threads
+     */
+    static void init(const JobSystemConfig& config = {});
+
+    /**
+     * @brief Finish all queued jobs and join the workers
+     */
+    static void shutdown();
+
+    [[nodiscard]] static bool is_initialized() noexcept { return s_initialized; }
+
+    /**
+     * @brief Number of worker threads (excluding the main thread)
+     */
+    [[nodiscard]] static u32 worker_count() noexcept { return static_cast<u32>(s_workers.size()); }
+
+    /**
+     * @brief Index of the calling thread: 0 for non-workers, 1..worker_count() for workers
+     */
+    [[nodiscard]] static u32 thread_index() noexcept { return s_thread_index; }
+
+    /**
+     * @brief Submit a job
+     * @param job Work to execute
+     * @param counter Optional counter incremented now and decremented on completion
+     */
+    static void run(JobFunction job, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Execute queued jobs until the counter reaches zero
+     */
+    static void wait(JobCounter& counter);
+
+    /**
+     * @brief Execute one queued job on the calling thread
+     * @return false if no job was available
+     */
+    static bool try_run_one();
+
+    /**
+     * @brief Split [0, count) into chunks and run body(begin, end) for each in parallel
+     *
+     * The calling thread executes one chunk itself and returns when all chunks
+     * are done.
+     *
+     * @param grain Items per chunk; 0 picks about four chunks per thread
+     */
+    template <typename Fn>
+    static void parallel_for(usize count, Fn&& body, usize grain = 0) {
+        if (count == 0) {
+            return;
+        }
+        if (grain == 0) {
+            grain = std::max<usize>(1, count / (4 * (static_cast<usize>(worker_count()) + 1)));
+        }
+        if (!s_initialized || s_workers.empty() || count <= grain) {
+            body(usize{0}, count);
+            return;
+        }
+
+        // Jobs capture only a pointer and a chunk index, which keeps them
+        // inside std::function's small-buffer storage
+        struct Context {
+            Fn* body;
+            usize grain;
+            usize count;
+        } context{&body, grain, count};
+
+        const usize chunks = (count + grain - 1) / grain;
+        JobCounter counter;
+        for (usize chunk = 1; chunk < chunks; ++chunk) {
+            run(
+                [ctx = &context, chunk] {
+                    const usize begin = chunk * ctx->grain;
+                    (*ctx->body)(begin, std::min(begin + ctx->grain, ctx->count));
+                },
+                &counter);
+        }
+        body(usize{0}, grain);
+        wait(counter);
+    }
+
+    /**
+     * @brief Call fn(element) for every element of a random-access range in parallel
+     *
+     * Works on containers, spans and single-component EnTT views.
+     */
+    template <typename Range, typename Fn>
+    static void parallel_for_each(Range&& range, Fn&& fn, usize grain = 0) {
+        auto first = std::begin(range);
+        const auto count = static_cast<usize>(std::distance(first, std::end(range)));
+        parallel_for(
+            count,
+            [&](usize begin, usize end) {
+                auto it = std::next(first, static_cast<std::ptrdiff_t>(begin));
+                for (usize i = begin; i < end; ++i, ++it) {
+                    fn(*it);
+                }
+            },
+            grain);
+    }
+
+private:
+    struct Job;
+    struct WorkQueue;
+
+    static void worker_main(u32 index);
+    static void push(Job job);
+    [[nodiscard]] static bool try_pop(Job& out);
+    static void execute(Job& job);
+
+    static std::vector<std::thread> s_workers;
+    static std::vector<std::unique_ptr<WorkQueue>> s_queues; // [0] = shared, [i] = worker i
+    static std::mutex s_sleep_mutex;
+    static std::condition_variable s_wake;
+    static std::atomic<u32> s_queued_jobs;
+    static std::atomic<bool> s_running;
+    static thread_local u32 s_thread_index;
+    static bool s_initialized;
+};
+
+} // namespace hz
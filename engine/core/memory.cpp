@@ -1,8 +1,13 @@
 #include "memory.hpp"
 
+#include "alloc_tracker.hpp"
+#include "engine/platform/virtual_memory.hpp"
 #include "log.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <new>
+#include <utility>
 
 namespace hz {
 
@@ -10,41 +15,214 @@ namespace hz {
 // LinearArena Implementation
 // ============================================================================
 
-LinearArena::LinearArena(usize capacity) : m_buffer(capacity) {}
+namespace {
 
-LinearArena::~LinearArena() = default;
+[[nodiscard]] constexpr usize align_up(usize value, usize alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+[[nodiscard]] std::byte* align_pointer(std::byte* ptr, usize alignment) noexcept {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    const auto aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    return ptr + (aligned - address);
+}
+
+[[nodiscard]] usize commit_granularity() noexcept {
+    return std::max(ARENA_COMMIT_GRANULARITY, vm::page_size());
+}
+
+} // namespace
+
+LinearArena::LinearArena(usize capacity)
+    : m_buffer(capacity), m_base(m_buffer.data()), m_capacity(capacity), m_committed(capacity) {}
+
+LinearArena::LinearArena(const VirtualArenaConfig& config)
+    : m_virtual(true)
+    , m_allow_overflow(config.allow_overflow)
+    , m_decommit_after_frames(config.decommit_after_frames) {
+    const usize granule = commit_granularity();
+    m_capacity = align_up(config.reserve_size, granule);
+    m_min_commit = std::min(align_up(config.initial_commit, granule), m_capacity);
+
+    m_base = static_cast<std::byte*>(vm::reserve(m_capacity));
+    if (!m_base) {
+        HZ_ENGINE_ERROR("LinearArena: failed to reserve {} bytes of address space", m_capacity);
+        throw std::bad_alloc();
+    }
+
+    if (m_min_commit > 0 && !vm::commit(m_base, m_min_commit)) {
+        HZ_ENGINE_ERROR("LinearArena: failed to commit {} bytes", m_min_commit);
+        vm::release(m_base, m_capacity);
+        throw std::bad_alloc();
+    }
+    m_committed = m_min_commit;
+}
+
+LinearArena::~LinearArena() {
+    release();
+}
 
 LinearArena::LinearArena(LinearArena&& other) noexcept
-    : m_buffer(std::move(other.m_buffer)), m_offset(other.m_offset) {
-    other.m_offset = 0;
+    : m_buffer(std::move(other.m_buffer))
+    , m_base(std::exchange(other.m_base, nullptr))
+    , m_capacity(std::exchange(other.m_capacity, 0))
+    , m_committed(std::exchange(other.m_committed, 0))
+    , m_offset(std::exchange(other.m_offset, 0))
+    , m_virtual(std::exchange(other.m_virtual, false))
+    , m_allow_overflow(other.m_allow_overflow)
+    , m_min_commit(other.m_min_commit)
+    , m_decommit_after_frames(other.m_decommit_after_frames)
+    , m_overflow(std::move(other.m_overflow))
+    , m_frame_peak(other.m_frame_peak)
+    , m_window_peak(other.m_window_peak)
+    , m_high_water(other.m_high_water)
+    , m_quiet_frames(other.m_quiet_frames) {
+    HZ_ASSERT(other.m_scope_depth == 0, "Moving a LinearArena with open scopes");
 }
 
 LinearArena& LinearArena::operator=(LinearArena&& other) noexcept {
     if (this != &other) {
+        HZ_ASSERT(m_scope_depth == 0 && other.m_scope_depth == 0,
+                  "Moving a LinearArena with open scopes");
+        release();
         m_buffer = std::move(other.m_buffer);
-        m_offset = other.m_offset;
-        other.m_offset = 0;
+        m_base = std::exchange(other.m_base, nullptr);
+        m_capacity = std::exchange(other.m_capacity, 0);
+        m_committed = std::exchange(other.m_committed, 0);
+        m_offset = std::exchange(other.m_offset, 0);
+        m_virtual = std::exchange(other.m_virtual, false);
+        m_allow_overflow = other.m_allow_overflow;
+        m_min_commit = other.m_min_commit;
+        m_decommit_after_frames = other.m_decommit_after_frames;
+        m_overflow = std::move(other.m_overflow);
+        m_frame_peak = other.m_frame_peak;
+        m_window_peak = other.m_window_peak;
+        m_high_water = other.m_high_water;
+        m_quiet_frames = other.m_quiet_frames;
     }
     return *this;
 }
 
+void LinearArena::release() noexcept {
+    if (m_virtual && m_base) {
+        vm::release(m_base, m_capacity);
+    }
+    m_overflow.clear();
+    m_buffer = {};
+    m_base = nullptr;
+    m_capacity = 0;
+    m_committed = 0;
+    m_offset = 0;
+}
+
 void LinearArena::reset() noexcept {
+    HZ_ASSERT(m_scope_depth == 0, "LinearArena reset with {} open scopes", m_scope_depth);
+    m_overflow.clear();
+    track_frame_end();
     m_offset = 0;
 }
 
+void LinearArena::rewind(usize marker) noexcept {
+    HZ_ASSERT(marker <= m_offset, "LinearArena rewind past current offset ({} > {})", marker,
+              m_offset);
+    while (!m_overflow.empty() && m_overflow.back().base >= marker) {
+        m_overflow.pop_back();
+    }
+    m_offset = marker;
+}
+
 void* LinearArena::do_allocate(usize bytes, usize alignment) {
-    // Align the current offset
-    usize aligned_offset = (m_offset + alignment - 1) & ~(alignment - 1);
+    if (!m_overflow.empty()) {
+        return allocate_overflow(bytes, alignment);
+    }
+
+    const usize aligned_offset =
+        m_base ? static_cast<usize>(align_pointer(m_base + m_offset, alignment) - m_base)
+               : align_up(m_offset, alignment);
 
-    if (aligned_offset + bytes > m_buffer.size()) {
+    if (aligned_offset + bytes > m_capacity) {
+        if (m_allow_overflow) {
+            return allocate_overflow(bytes, alignment);
+        }
         HZ_ENGINE_ERROR("LinearArena out of memory: requested {} bytes, {} available", bytes,
-                        m_buffer.size() - aligned_offset);
+                        aligned_offset < m_capacity ? m_capacity - aligned_offset : 0);
         throw std::bad_alloc();
     }
 
-    std::byte* ptr = m_buffer.data() + aligned_offset;
+    if (m_virtual) {
+        commit_to(aligned_offset + bytes);
+    }
+
     m_offset = aligned_offset + bytes;
-    return ptr;
+    m_frame_peak = std::max(m_frame_peak, m_offset);
+    return m_base + aligned_offset;
+}
+
+void* LinearArena::allocate_overflow(usize bytes, usize alignment) {
+    if (!m_overflow.empty()) {
+        OverflowBlock& block = m_overflow.back();
+        std::byte* cursor = block.data.get() + (m_offset - block.base);
+        std::byte* aligned = align_pointer(cursor, alignment);
+        const auto end = static_cast<usize>(aligned - block.data.get()) + bytes;
+        if (end <= block.size) {
+            m_offset = block.base + end;
+            m_frame_peak = std::max(m_frame_peak, m_offset);
+            return aligned;
+        }
+    } else {
+        HZ_ENGINE_WARN("LinearArena reservation of {} bytes exhausted, chaining overflow blocks",
+                       m_capacity);
+    }
+
+    OverflowBlock block;
+    block.size = std::max(bytes + alignment, std::max(m_min_commit, commit_granularity()));
+    block.data.reset(new std::byte[block.size]);
+    block.base = m_offset;
+
+    std::byte* aligned = align_pointer(block.data.get(), alignment);
+    m_offset = block.base + static_cast<usize>(aligned - block.data.get()) + bytes;
+    m_frame_peak = std::max(m_frame_peak, m_offset);
+    m_overflow.push_back(std::move(block));
+    return aligned;
+}
+
+void LinearArena::commit_to(usize offset) {
+    if (offset <= m_committed) {
+        return;
+    }
+
+    const usize target = std::min(align_up(offset, commit_granularity()), m_capacity);
+    if (!vm::commit(m_base + m_committed, target - m_committed)) {
+        HZ_ENGINE_ERROR("LinearArena: failed to commit {} bytes", target - m_committed);
+        throw std::bad_alloc();
+    }
+    m_committed = target;
+}
+
+void LinearArena::track_frame_end() noexcept {
+    m_high_water = std::max(m_high_water, m_frame_peak);
+
+    if (m_virtual && m_decommit_after_frames != 0) {
+        const usize needed = std::max(
+            align_up(std::min(m_frame_peak, m_capacity), commit_granularity()), m_min_commit);
+
+        if (needed < m_committed) {
+            m_window_peak = std::max(m_window_peak, needed);
+            if (++m_quiet_frames >= m_decommit_after_frames) {
+                vm::decommit(m_base + m_window_peak, m_committed - m_window_peak);
+                HZ_ENGINE_TRACE("LinearArena decommitted {} bytes",
+                                m_committed - m_window_peak);
+                m_committed = m_window_peak;
+                m_quiet_frames = 0;
+                m_window_peak = 0;
+            }
+        } else {
+            m_quiet_frames = 0;
+            m_window_peak = 0;
+        }
+    }
+
+    m_frame_peak = 0;
 }
 
 void LinearArena::do_deallocate(void* /*p*/, usize /*bytes*/, usize /*alignment*/) {
@@ -55,12 +233,144 @@ bool LinearArena::do_is_equal(const memory_resource& other) const noexcept {
     return this == &other;
 }
 
+// ============================================================================
+// TrackedPoolResource Implementation
+// ============================================================================
+
+void TrackedPoolResource::set_budget(const MemoryBudget& budget) noexcept {
+    m_soft_limit.store(budget.soft_limit, std::memory_order_relaxed);
+    m_hard_limit.store(budget.hard_limit, std::memory_order_relaxed);
+}
+
+MemoryBudget TrackedPoolResource::budget() const noexcept {
+    return {m_soft_limit.load(std::memory_order_relaxed),
+            m_hard_limit.load(std::memory_order_relaxed)};
+}
+
+MemoryDomainStats TrackedPoolResource::stats() const noexcept {
+    MemoryDomainStats result;
+    result.live_bytes = m_live_bytes.load(std::memory_order_relaxed);
+    result.peak_bytes = m_peak_bytes.load(std::memory_order_relaxed);
+    result.live_allocations = m_live_allocations.load(std::memory_order_relaxed);
+    result.total_allocations = m_total_allocations.load(std::memory_order_relaxed);
+    result.allocations_last_frame = m_last_frame_allocations.load(std::memory_order_relaxed);
+    result.budget_failures = m_budget_failures.load(std::memory_order_relaxed);
+    result.budget = budget();
+    return result;
+}
+
+void TrackedPoolResource::end_frame() noexcept {
+    m_last_frame_allocations.store(m_frame_allocations.exchange(0, std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+}
+
+void* TrackedPoolResource::do_allocate(usize bytes, usize alignment) {
+    const usize live = m_live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    const usize hard_limit = m_hard_limit.load(std::memory_order_relaxed);
+    if (hard_limit != 0 && live > hard_limit) {
+        m_live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        m_budget_failures.fetch_add(1, std::memory_order_relaxed);
+        HZ_ENGINE_ERROR("{} memory budget exceeded: {} bytes requested, {}/{} bytes live",
+                        memory_domain_name(m_domain), bytes, live - bytes, hard_limit);
+        throw std::bad_alloc();
+    }
+
+    const usize soft_limit = m_soft_limit.load(std::memory_order_relaxed);
+    if (soft_limit != 0 && live > soft_limit &&
+        !m_over_soft_limit.exchange(true, std::memory_order_relaxed)) {
+        HZ_ENGINE_WARN("{} memory over soft budget: {}/{} bytes", memory_domain_name(m_domain),
+                       live, soft_limit);
+    }
+
+    void* ptr = nullptr;
+    try {
+        ptr = m_pool.allocate(bytes, alignment);
+    } catch (...) {
+        m_live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        throw;
+    }
+
+    usize peak = m_peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !m_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+
+    m_live_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_total_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_frame_allocations.fetch_add(1, std::memory_order_relaxed);
+    AllocTracker::record_pmr_allocation(bytes);
+    return ptr;
+}
+
+void TrackedPoolResource::do_deallocate(void* p, usize bytes, usize alignment) {
+    m_pool.deallocate(p, bytes, alignment);
+
+    const usize live = m_live_bytes.fetch_sub(bytes, std::memory_order_relaxed) - bytes;
+    m_live_allocations.fetch_sub(1, std::memory_order_relaxed);
+
+    const usize soft_limit = m_soft_limit.load(std::memory_order_relaxed);
+    if (soft_limit == 0 || live <= soft_limit) {
+        m_over_soft_limit.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool TrackedPoolResource::do_is_equal(const memory_resource& other) const noexcept {
+    return this == &other;
+}
+
 // ============================================================================
 // MemoryContext Implementation
 // ============================================================================
 
-std::unique_ptr<LinearArena> MemoryContext::s_frame_arena;
-std::pmr::synchronized_pool_resource MemoryContext::s_general_pool;
+struct MemoryContext::ThreadArenaSet {
+    static constexpr VirtualArenaConfig CONFIG{.reserve_size = THREAD_FRAME_ARENA_RESERVE,
+                                               .initial_commit = THREAD_FRAME_ARENA_SIZE};
+
+    LinearArena arenas[2]{LinearArena(CONFIG), LinearArena(CONFIG)};
+};
+
+/**
+ * @brief A thread's claim on an arena set, released when the thread exits
+ *
+ * The epoch tells whether the set still exists: shutdown() destroys every set
+ * and bumps the epoch under the registry mutex.
+ */
+struct MemoryContext::ThreadArenaLease {
+    ThreadArenaSet* set{nullptr};
+    u32 epoch{0};
+
+    ThreadArenaLease() = default;
+    ~ThreadArenaLease() {
+        if (!set) {
+            return;
+        }
+        // The set stays registered, so its arenas keep flipping and last
+        // frame's data stays readable after the thread is gone
+        std::lock_guard lock(s_thread_arena_mutex);
+        if (epoch == s_epoch.load(std::memory_order_relaxed)) {
+            s_free_thread_arenas.push_back(set);
+        }
+    }
+
+    HZ_NON_COPYABLE(ThreadArenaLease);
+    HZ_NON_MOVABLE(ThreadArenaLease);
+};
+
+std::unique_ptr<LinearArena> MemoryContext::s_frame_arenas[2];
+std::vector<std::unique_ptr<MemoryContext::ThreadArenaSet>> MemoryContext::s_thread_arenas;
+std::vector<MemoryContext::ThreadArenaSet*> MemoryContext::s_free_thread_arenas;
+std::mutex MemoryContext::s_thread_arena_mutex;
+std::atomic<u64> MemoryContext::s_frame_index{0};
+std::atomic<u32> MemoryContext::s_epoch{0};
+std::thread::id MemoryContext::s_main_thread;
+thread_local MemoryContext::ThreadArenaLease MemoryContext::s_thread_lease;
+TrackedPoolResource MemoryContext::s_domain_resources[MEMORY_DOMAIN_COUNT] = {
+    TrackedPoolResource(MemoryDomain::Frame),     TrackedPoolResource(MemoryDomain::ECS),
+    TrackedPoolResource(MemoryDomain::Renderer),  TrackedPoolResource(MemoryDomain::Assets),
+    TrackedPoolResource(MemoryDomain::Audio),     TrackedPoolResource(MemoryDomain::Physics),
+    TrackedPoolResource(MemoryDomain::Scripting), TrackedPoolResource(MemoryDomain::General),
+};
 bool MemoryContext::s_initialized = false;
 
 void MemoryContext::init() {
@@ -69,11 +379,18 @@ void MemoryContext::init() {
         return;
     }
 
-    s_frame_arena = std::make_unique<LinearArena>(FRAME_ARENA_SIZE);
+    s_frame_arenas[0] = std::make_unique<LinearArena>(VirtualArenaConfig{});
+    s_frame_arenas[1] = std::make_unique<LinearArena>(VirtualArenaConfig{});
+    s_frame_index.store(0, std::memory_order_relaxed);
+    s_epoch.fetch_add(1, std::memory_order_release);
+    s_main_thread = std::this_thread::get_id();
 
     s_initialized = true;
-    HZ_ENGINE_INFO("Memory context initialized: frame arena {} MB",
-                   FRAME_ARENA_SIZE / (1024 * 1024));
+    HZ_ENGINE_INFO("Memory context initialized: frame arena 2x{} MB (reserve {} MB), thread "
+                   "arenas 2x{} MB (reserve {} MB)",
+                   FRAME_ARENA_SIZE / (1024 * 1024), FRAME_ARENA_RESERVE / (1024 * 1024),
+                   THREAD_FRAME_ARENA_SIZE / (1024 * 1024),
+                   THREAD_FRAME_ARENA_RESERVE / (1024 * 1024));
 }
 
 void MemoryContext::shutdown() {
@@ -82,34 +399,175 @@ void MemoryContext::shutdown() {
     }
 
     log_stats();
-    s_frame_arena.reset();
+
+    {
+        std::lock_guard lock(s_thread_arena_mutex);
+        s_free_thread_arenas.clear();
+        s_thread_arenas.clear();
+        s_epoch.fetch_add(1, std::memory_order_release);
+    }
+    s_frame_arenas[0].reset();
+    s_frame_arenas[1].reset();
     s_initialized = false;
 
     HZ_ENGINE_INFO("Memory context shutdown");
 }
 
 void MemoryContext::reset_frame() {
-    if (s_frame_arena) {
-        s_frame_arena->reset();
+    if (!s_initialized) {
+        return;
     }
+
+    for (auto& resource : s_domain_resources) {
+        resource.end_frame();
+    }
+
+    const u64 next = s_frame_index.load(std::memory_order_relaxed) + 1;
+    const usize slot = next & 1;
+
+    s_frame_arenas[slot]->reset();
+
+    std::lock_guard lock(s_thread_arena_mutex);
+    for (auto& set : s_thread_arenas) {
+        set->arenas[slot].reset();
+    }
+
+    s_frame_index.store(next, std::memory_order_release);
 }
 
 std::pmr::memory_resource* MemoryContext::get(MemoryDomain domain) {
     if (domain == MemoryDomain::Frame) {
-        return s_frame_arena.get();
+        return s_initialized ? &thread_frame_arena() : nullptr;
+    }
+    return &s_domain_resources[static_cast<usize>(domain)];
+}
+
+MemoryDomainStats MemoryContext::stats(MemoryDomain domain) {
+    if (domain != MemoryDomain::Frame) {
+        return s_domain_resources[static_cast<usize>(domain)].stats();
+    }
+
+    MemoryDomainStats result;
+    if (!s_initialized) {
+        return result;
+    }
+
+    const usize slot = current_slot();
+    result.live_bytes = s_frame_arenas[slot]->used();
+    result.peak_bytes = std::max(s_frame_arenas[0]->high_water_mark(),
+                                 s_frame_arenas[1]->high_water_mark());
+
+    std::lock_guard lock(s_thread_arena_mutex);
+    for (const auto& set : s_thread_arenas) {
+        result.live_bytes += set->arenas[slot].used();
+        result.peak_bytes =
+            std::max({result.peak_bytes, set->arenas[0].high_water_mark(),
+                      set->arenas[1].high_water_mark()});
+    }
+    return result;
+}
+
+void MemoryContext::set_budget(MemoryDomain domain, const MemoryBudget& budget) {
+    if (domain == MemoryDomain::Frame) {
+        HZ_ENGINE_WARN("Frame memory is bounded by arena reservations; budget ignored");
+        return;
     }
-    return &s_general_pool;
+    s_domain_resources[static_cast<usize>(domain)].set_budget(budget);
 }
 
 LinearArena& MemoryContext::frame_arena() {
-    HZ_ASSERT(s_frame_arena, "Frame arena not initialized");
-    return *s_frame_arena;
+    HZ_ASSERT(s_initialized, "Frame arena not initialized");
+    return *s_frame_arenas[current_slot()];
+}
+
+LinearArena& MemoryContext::previous_frame_arena() {
+    HZ_ASSERT(s_initialized, "Frame arena not initialized");
+    return *s_frame_arenas[current_slot() ^ 1];
+}
+
+LinearArena& MemoryContext::thread_frame_arena() {
+    if (std::this_thread::get_id() == s_main_thread) {
+        return frame_arena();
+    }
+    return thread_arena_set().arenas[current_slot()];
+}
+
+LinearArena& MemoryContext::thread_previous_frame_arena() {
+    if (std::this_thread::get_id() == s_main_thread) {
+        return previous_frame_arena();
+    }
+    return thread_arena_set().arenas[current_slot() ^ 1];
+}
+
+usize MemoryContext::thread_arena_count() {
+    std::lock_guard lock(s_thread_arena_mutex);
+    return s_thread_arenas.size();
+}
+
+MemoryContext::ThreadArenaSet& MemoryContext::thread_arena_set() {
+    HZ_ASSERT(s_initialized, "Frame arena not initialized");
+
+    ThreadArenaLease& lease = s_thread_lease;
+    const u32 epoch = s_epoch.load(std::memory_order_acquire);
+    if (lease.set && lease.epoch == epoch) {
+        return *lease.set;
+    }
+
+    {
+        std::lock_guard lock(s_thread_arena_mutex);
+        if (!s_free_thread_arenas.empty()) {
+            lease.set = s_free_thread_arenas.back();
+            lease.epoch = epoch;
+            s_free_thread_arenas.pop_back();
+            return *lease.set;
+        }
+    }
+
+    // Reserve outside the lock; other threads may be flipping their arenas
+    auto set = std::make_unique<ThreadArenaSet>();
+
+    std::lock_guard lock(s_thread_arena_mutex);
+    s_thread_arenas.reserve(s_thread_arenas.size() + 1);
+    lease.set = s_thread_arenas.emplace_back(std::move(set)).get();
+    lease.epoch = epoch;
+    return *lease.set;
 }
 
 void MemoryContext::log_stats() {
-    if (s_frame_arena) {
-        HZ_ENGINE_DEBUG("Frame arena: {}/{} bytes ({:.1f}% used)", s_frame_arena->used(),
-                        s_frame_arena->capacity(), s_frame_arena->usage_percent() * 100.0f);
+    if (!s_initialized) {
+        return;
+    }
+
+    const LinearArena& arena = frame_arena();
+    HZ_ENGINE_DEBUG("Frame arena: {}/{} bytes ({:.1f}% used), {} committed, high water {}",
+                    arena.used(), arena.capacity(), arena.usage_percent() * 100.0f,
+                    arena.committed(), arena.high_water_mark());
+
+    {
+        std::lock_guard lock(s_thread_arena_mutex);
+        usize thread_used = 0;
+        for (const auto& set : s_thread_arenas) {
+            thread_used += set->arenas[current_slot()].used();
+        }
+        HZ_ENGINE_DEBUG("Thread frame arenas: {} sets ({} free), {} bytes used",
+                        s_thread_arenas.size(), s_free_thread_arenas.size(), thread_used);
+    }
+
+    for (const auto& resource : s_domain_resources) {
+        if (resource.domain() == MemoryDomain::Frame) {
+            continue;
+        }
+        const MemoryDomainStats domain_stats = resource.stats();
+        if (domain_stats.total_allocations == 0) {
+            continue;
+        }
+        HZ_ENGINE_DEBUG("{} domain: {} bytes live ({} allocs), peak {} bytes, {} total allocs, "
+                        "{} last frame, budget {}/{} bytes, {} budget failures",
+                        memory_domain_name(resource.domain()), domain_stats.live_bytes,
+                        domain_stats.live_allocations, domain_stats.peak_bytes,
+                        domain_stats.total_allocations, domain_stats.allocations_last_frame,
+                        domain_stats.budget.soft_limit, domain_stats.budget.hard_limit,
+                        domain_stats.budget_failures);
     }
 }
 
@@ -117,14 +575,40 @@ void MemoryContext::log_stats() {
 // ScopedArenaMarker Implementation
 // ============================================================================
 
-ScopedArenaMarker::ScopedArenaMarker(LinearArena& arena) : m_arena(arena), m_marker(arena.used()) {}
+ScopedArenaMarker::ScopedArenaMarker(LinearArena& arena)
+    : m_arena(arena), m_marker(arena.used()), m_depth(++arena.m_scope_depth) {}
 
 ScopedArenaMarker::~ScopedArenaMarker() {
-    // This is a simplified reset - in practice we'd need to track the marker
-    // For now, we just log if there were allocations
-    if (m_arena.used() > m_marker) {
-        HZ_ENGINE_TRACE("ScopedArenaMarker: freed {} bytes", m_arena.used() - m_marker);
-    }
+    HZ_ASSERT(is_innermost(), "ScopedArenaMarker unwound out of order (depth {}, arena at {})",
+              m_depth, m_arena.m_scope_depth);
+    HZ_ASSERT(m_arena.used() >= m_marker,
+              "ScopedArenaMarker: arena was rewound below this marker ({} < {})", m_arena.used(),
+              m_marker);
+
+    m_arena.rewind(m_marker);
+    --m_arena.m_scope_depth;
+}
+
+// ============================================================================
+// ScratchScope Implementation
+// ============================================================================
+
+ScratchScope::ScratchScope() : m_marker(MemoryContext::thread_frame_arena()) {}
+
+ScratchScope::ScratchScope(LinearArena& arena) : m_marker(arena) {}
+
+void* ScratchScope::do_allocate(usize bytes, usize alignment) {
+    HZ_ASSERT(m_marker.is_innermost(),
+              "ScratchScope: allocating from an outer scope while an inner one is open");
+    return m_marker.arena().allocate(bytes, alignment);
+}
+
+void ScratchScope::do_deallocate(void* /*p*/, usize /*bytes*/, usize /*alignment*/) {
+    // No-op: memory is released when the scope closes
+}
+
+bool ScratchScope::do_is_equal(const memory_resource& other) const noexcept {
+    return this == &other;
 }
 
 } // namespace hz
@@ -6,14 +6,19 @@
  *
  * Provides PMR-based memory allocators for different engine subsystems:
  * - Frame arena: Reset every frame, for temporary allocations
+ * - Thread frame arenas: Per-worker frame arenas, double-buffered with the main one
  * - Persistent pool: Long-lived allocations
  * - Subsystem pools: Isolated pools per subsystem
  */
 
 #include "types.hpp"
 
+#include <atomic>
 #include <memory>
 #include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 namespace hz {
@@ -22,22 +27,49 @@ namespace hz {
 // Memory Constants
 // ============================================================================
 
-inline constexpr usize FRAME_ARENA_SIZE = 16 * 1024 * 1024;  // 16 MB per frame
-inline constexpr usize DEFAULT_POOL_SIZE = 64 * 1024 * 1024; // 64 MB default
+inline constexpr usize FRAME_ARENA_SIZE = 16 * 1024 * 1024;           // 16 MB per frame
+inline constexpr usize FRAME_ARENA_RESERVE = 256 * 1024 * 1024;       // Spike headroom
+inline constexpr usize THREAD_FRAME_ARENA_SIZE = 4 * 1024 * 1024;     // 4 MB per worker per frame
+inline constexpr usize THREAD_FRAME_ARENA_RESERVE = 64 * 1024 * 1024; // Spike headroom
+inline constexpr usize DEFAULT_POOL_SIZE = 64 * 1024 * 1024;          // 64 MB default
+inline constexpr usize ARENA_COMMIT_GRANULARITY = 64 * 1024;          // Commit in 64 KB steps
+inline constexpr u32 ARENA_DECOMMIT_FRAMES = 120;                     // ~2 s at 60 Hz
 
 // ============================================================================
 // Linear Arena Allocator
 // ============================================================================
 
+/**
+ * @brief Configuration for a virtual-memory-backed LinearArena
+ *
+ * The arena reserves reserve_size bytes of address space up front and commits
+ * pages as the offset grows. After decommit_after_frames consecutive resets
+ * that stayed below the committed size, pages above the recent high-water mark
+ * are returned to the OS (never below initial_commit).
+ */
+struct VirtualArenaConfig {
+    usize reserve_size{FRAME_ARENA_RESERVE};
+    usize initial_commit{FRAME_ARENA_SIZE};
+    u32 decommit_after_frames{ARENA_DECOMMIT_FRAMES}; // 0 = never decommit
+    bool allow_overflow{true}; // Chain heap blocks once the reservation is exhausted
+};
+
 /**
  * @brief Fast linear allocator that resets each frame
  *
  * Allocations are bump-pointer only, deallocations are no-ops.
  * The entire arena is reset at once via reset().
+ *
+ * Two storage modes are supported:
+ * - Fixed: a heap buffer of the given capacity; exhausting it throws std::bad_alloc.
+ * - Virtual: a reserved address range committed on demand (see VirtualArenaConfig).
+ *   If the reservation runs out and overflow is allowed, further allocations are
+ *   served from chained heap blocks that are freed on reset or rewind.
  */
 class LinearArena : public std::pmr::memory_resource {
 public:
     explicit LinearArena(usize capacity);
+    explicit LinearArena(const VirtualArenaConfig& config);
     ~LinearArena() override;
 
     HZ_NON_COPYABLE(LinearArena);
@@ -46,25 +78,62 @@ public:
 
     /**
      * @brief Reset the arena, invalidating all allocations
+     *
+     * Also ends the current frame for high-water tracking, which may
+     * decommit unused pages in virtual mode.
      */
     void reset() noexcept;
 
+    /**
+     * @brief Rewind the arena to a previously recorded offset
+     *
+     * Frees every allocation made after the marker was taken.
+     */
+    void rewind(usize marker) noexcept;
+
     /**
      * @brief Get current allocation offset
+     *
+     * Once overflow blocks are in use this is a logical offset that keeps
+     * growing past capacity(); it remains valid as a rewind() marker.
      */
     [[nodiscard]] usize used() const noexcept { return m_offset; }
 
     /**
-     * @brief Get total capacity
+     * @brief Get the number of open ScopedArenaMarkers on this arena
+     */
+    [[nodiscard]] u32 scope_depth() const noexcept { return m_scope_depth; }
+
+    /**
+     * @brief Get total capacity (reserved size in virtual mode)
+     */
+    [[nodiscard]] usize capacity() const noexcept { return m_capacity; }
+
+    /**
+     * @brief Get bytes currently backed by physical memory
      */
-    [[nodiscard]] usize capacity() const noexcept { return m_buffer.size(); }
+    [[nodiscard]] usize committed() const noexcept { return m_committed; }
+
+    /**
+     * @brief Get the highest offset ever reached
+     */
+    [[nodiscard]] usize high_water_mark() const noexcept { return m_high_water; }
+
+    /**
+     * @brief Get the number of chained overflow blocks currently alive
+     */
+    [[nodiscard]] usize overflow_block_count() const noexcept { return m_overflow.size(); }
+
+    /**
+     * @brief Check whether the arena is backed by reserved virtual memory
+     */
+    [[nodiscard]] bool is_virtual() const noexcept { return m_virtual; }
 
     /**
      * @brief Get percentage of arena used
      */
     [[nodiscard]] f32 usage_percent() const noexcept {
-        return !m_buffer.empty() ? static_cast<f32>(m_offset) / static_cast<f32>(m_buffer.size())
-                                 : 0.0f;
+        return m_capacity != 0 ? static_cast<f32>(m_offset) / static_cast<f32>(m_capacity) : 0.0f;
     }
 
 protected:
@@ -73,8 +142,38 @@ protected:
     [[nodiscard]] bool do_is_equal(const memory_resource& other) const noexcept override;
 
 private:
-    std::vector<std::byte> m_buffer;
+    friend class ScopedArenaMarker;
+
+    struct OverflowBlock {
+        std::unique_ptr<std::byte[]> data;
+        usize size{0};
+        usize base{0}; // Logical offset at which this block starts
+    };
+
+    void* allocate_overflow(usize bytes, usize alignment);
+    void commit_to(usize offset);
+    void track_frame_end() noexcept;
+    void release() noexcept;
+
+    std::vector<std::byte> m_buffer; // Fixed mode storage
+    std::byte* m_base{nullptr};
+    usize m_capacity{0};
+    usize m_committed{0};
     usize m_offset{0};
+    u32 m_scope_depth{0};
+
+    // Virtual mode
+    bool m_virtual{false};
+    bool m_allow_overflow{false};
+    usize m_min_commit{0};
+    u32 m_decommit_after_frames{0};
+    std::vector<OverflowBlock> m_overflow;
+
+    // High-water tracking
+    usize m_frame_peak{0};
+    usize m_window_peak{0};
+    usize m_high_water{0};
+    u32 m_quiet_frames{0};
 };
 
 // ============================================================================
@@ -95,12 +194,126 @@ enum class MemoryDomain : u8 {
     General    // General purpose
 };
 
+inline constexpr usize MEMORY_DOMAIN_COUNT = static_cast<usize>(MemoryDomain::General) + 1;
+
+/**
+ * @brief Get a printable name for a memory domain
+ */
+[[nodiscard]] constexpr std::string_view memory_domain_name(MemoryDomain domain) noexcept {
+    switch (domain) {
+    case MemoryDomain::Frame:
+        return "Frame";
+    case MemoryDomain::ECS:
+        return "ECS";
+    case MemoryDomain::Renderer:
+        return "Renderer";
+    case MemoryDomain::Assets:
+        return "Assets";
+    case MemoryDomain::Audio:
+        return "Audio";
+    case MemoryDomain::Physics:
+        return "Physics";
+    case MemoryDomain::Scripting:
+        return "Scripting";
+    case MemoryDomain::General:
+        return "General";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Soft and hard byte limits for a memory domain (0 = unlimited)
+ *
+ * Crossing the soft limit logs a warning once per excursion. An allocation
+ * that would cross the hard limit fails with std::bad_alloc.
+ */
+struct MemoryBudget {
+    usize soft_limit{0};
+    usize hard_limit{0};
+};
+
+/**
+ * @brief Snapshot of a memory domain's usage
+ */
+struct MemoryDomainStats {
+    usize live_bytes{0};
+    usize peak_bytes{0};
+    u64 live_allocations{0};
+    u64 total_allocations{0};
+    u64 allocations_last_frame{0}; // Allocation rate, sampled at reset_frame()
+    u64 budget_failures{0};
+    MemoryBudget budget{};
+};
+
+// ============================================================================
+// Tracked Pool Resource
+// ============================================================================
+
+/**
+ * @brief Thread-safe pool resource that accounts for every allocation
+ *
+ * Each non-frame memory domain owns one of these, so usage can be attributed
+ * to the subsystem that made it and capped per domain.
+ */
+class TrackedPoolResource final : public std::pmr::memory_resource {
+public:
+    explicit TrackedPoolResource(MemoryDomain domain) : m_domain(domain) {}
+    ~TrackedPoolResource() override = default;
+
+    HZ_NON_COPYABLE(TrackedPoolResource);
+    HZ_NON_MOVABLE(TrackedPoolResource);
+
+    [[nodiscard]] MemoryDomain domain() const noexcept { return m_domain; }
+
+    void set_budget(const MemoryBudget& budget) noexcept;
+    [[nodiscard]] MemoryBudget budget() const noexcept;
+
+    [[nodiscard]] MemoryDomainStats stats() const noexcept;
+
+    /**
+     * @brief Close the current frame's allocation-rate sample
+     */
+    void end_frame() noexcept;
+
+protected:
+    void* do_allocate(usize bytes, usize alignment) override;
+    void do_deallocate(void* p, usize bytes, usize alignment) override;
+    [[nodiscard]] bool do_is_equal(const memory_resource& other) const noexcept override;
+
+private:
+    MemoryDomain m_domain;
+    std::pmr::synchronized_pool_resource m_pool;
+
+    std::atomic<usize> m_live_bytes{0};
+    std::atomic<usize> m_peak_bytes{0};
+    std::atomic<u64> m_live_allocations{0};
+    std::atomic<u64> m_total_allocations{0};
+    std::atomic<u64> m_frame_allocations{0};
+    std::atomic<u64> m_last_frame_allocations{0};
+    std::atomic<u64> m_budget_failures{0};
+
+    std::atomic<usize> m_soft_limit{0};
+    std::atomic<usize> m_hard_limit{0};
+    std::atomic<bool> m_over_soft_limit{false};
+};
+
 // ============================================================================
 // Memory Context
 // ============================================================================
 
 /**
  * @brief Global memory context providing allocators for different domains
+ *
+ * Frame memory is double-buffered: every thread owns a pair of arenas and
+ * reset_frame() flips which one is current. Data allocated during frame N is
+ * still readable through the previous-frame arenas during frame N+1, which is
+ * what the render path needs when it consumes simulation output a frame late.
+ *
+ * The thread that calls init() uses the main frame arenas. Any other thread
+ * (Jolt workers, job system workers) gets its own pair, registered lazily on
+ * first use, so frame allocations never need a lock. When a thread exits its
+ * pair goes back to a free list for the next new thread, so short-lived
+ * threads do not each keep a reservation alive until shutdown().
  */
 class MemoryContext {
 public:
@@ -115,28 +328,99 @@ public:
     static void shutdown();
 
     /**
-     * @brief Reset frame-temporary allocations
+     * @brief Flip and reset frame-temporary allocations on every thread
+     *
+     * The arenas that become current are cleared; the ones that were current
+     * become the previous-frame arenas. Must be called while no other thread
+     * is allocating from its frame arena (i.e. between parallel phases).
      */
     static void reset_frame();
 
     /**
      * @brief Get allocator for a specific domain
+     *
+     * MemoryDomain::Frame resolves to the calling thread's frame arena; every
+     * other domain has its own tracked pool, available even before init().
      */
     [[nodiscard]] static std::pmr::memory_resource* get(MemoryDomain domain);
 
     /**
-     * @brief Get the frame arena allocator
+     * @brief Get usage statistics for a domain
+     *
+     * For MemoryDomain::Frame, live bytes cover all threads' current arenas and
+     * the peak is the largest high-water mark of any frame arena.
+     */
+    [[nodiscard]] static MemoryDomainStats stats(MemoryDomain domain);
+
+    /**
+     * @brief Configure soft/hard limits for a non-frame domain
+     */
+    static void set_budget(MemoryDomain domain, const MemoryBudget& budget);
+
+    /**
+     * @brief Get the main thread's frame arena for the current frame
      */
     [[nodiscard]] static LinearArena& frame_arena();
 
+    /**
+     * @brief Get the main thread's frame arena for the previous frame
+     *
+     * Contents stay valid until the next reset_frame().
+     */
+    [[nodiscard]] static LinearArena& previous_frame_arena();
+
+    /**
+     * @brief Get the calling thread's frame arena for the current frame
+     *
+     * Returns frame_arena() on the main thread; other threads get a private
+     * arena registered on first call.
+     */
+    [[nodiscard]] static LinearArena& thread_frame_arena();
+
+    /**
+     * @brief Get the calling thread's frame arena for the previous frame
+     */
+    [[nodiscard]] static LinearArena& thread_previous_frame_arena();
+
+    /**
+     * @brief Number of worker frame arena pairs, including ones free for reuse
+     *
+     * Bounded by the largest number of worker threads alive at once.
+     */
+    [[nodiscard]] static usize thread_arena_count();
+
+    /**
+     * @brief Number of completed frames since init
+     */
+    [[nodiscard]] static u64 frame_index() noexcept {
+        return s_frame_index.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Log memory statistics
      */
     static void log_stats();
 
 private:
-    static std::unique_ptr<LinearArena> s_frame_arena;
-    static std::pmr::synchronized_pool_resource s_general_pool;
+    struct ThreadArenaSet;
+    struct ThreadArenaLease;
+
+    [[nodiscard]] static ThreadArenaSet& thread_arena_set();
+    [[nodiscard]] static usize current_slot() noexcept {
+        return static_cast<usize>(frame_index() & 1);
+    }
+
+    static std::unique_ptr<LinearArena> s_frame_arenas[2];
+    static std::vector<std::unique_ptr<ThreadArenaSet>> s_thread_arenas;
+    static std::vector<ThreadArenaSet*> s_free_thread_arenas; // Owned by s_thread_arenas
+    static std::mutex s_thread_arena_mutex;
+    static std::atomic<u64> s_frame_index;
+    static std::atomic<u32> s_epoch;
+    static std::thread::id s_main_thread;
+
+    // Calling thread's arena set; returned to the free list when the thread exits
+    static thread_local ThreadArenaLease s_thread_lease;
+    static TrackedPoolResource s_domain_resources[MEMORY_DOMAIN_COUNT];
     static bool s_initialized;
 };
 
@@ -148,7 +432,8 @@ private:
  * @brief RAII marker for sub-allocations within an arena
  *
  * Records the arena offset on construction and restores it on destruction,
- * effectively freeing all allocations made within the scope.
+ * effectively freeing all allocations made within the scope. Markers must
+ * unwind in LIFO order; debug builds assert when they do not.
  */
 class ScopedArenaMarker {
 public:
@@ -158,9 +443,68 @@ public:
     HZ_NON_COPYABLE(ScopedArenaMarker);
     HZ_NON_MOVABLE(ScopedArenaMarker);
 
+    [[nodiscard]] LinearArena& arena() const noexcept { return m_arena; }
+    [[nodiscard]] usize marker() const noexcept { return m_marker; }
+    [[nodiscard]] u32 depth() const noexcept { return m_depth; }
+
+    /**
+     * @brief Check whether this is the most recently opened marker on its arena
+     */
+    [[nodiscard]] bool is_innermost() const noexcept { return m_arena.m_scope_depth == m_depth; }
+
 private:
     LinearArena& m_arena;
     usize m_marker;
+    u32 m_depth;
+};
+
+// ============================================================================
+// Scratch Scope
+// ============================================================================
+
+/**
+ * @brief Scoped scratch allocator backed by a frame arena
+ *
+ * Hands out a memory_resource whose allocations are released when the scope
+ * closes, so helpers can build temporary containers without touching the heap:
+ *
+ * @code
+ * ScratchScope scratch;
+ * PmrVector<RaycastHit> hits(scratch.resource());
+ * @endcode
+ *
+ * Containers using the resource must not outlive the scope. Scopes nest; only
+ * the innermost open scope on an arena may allocate.
+ */
+class ScratchScope final : public std::pmr::memory_resource {
+public:
+    /**
+     * @brief Open a scope on the calling thread's frame arena
+     */
+    ScratchScope();
+    explicit ScratchScope(LinearArena& arena);
+    ~ScratchScope() override = default;
+
+    HZ_NON_COPYABLE(ScratchScope);
+    HZ_NON_MOVABLE(ScratchScope);
+
+    [[nodiscard]] std::pmr::memory_resource* resource() noexcept { return this; }
+    [[nodiscard]] LinearArena& arena() const noexcept { return m_marker.arena(); }
+
+    /**
+     * @brief Bytes allocated from the arena since the scope was opened
+     */
+    [[nodiscard]] usize bytes_used() const noexcept {
+        return m_marker.arena().used() - m_marker.marker();
+    }
+
+protected:
+    void* do_allocate(usize bytes, usize alignment) override;
+    void do_deallocate(void* p, usize bytes, usize alignment) override;
+    [[nodiscard]] bool do_is_equal(const memory_resource& other) const noexcept override;
+
+private:
+    ScopedArenaMarker m_marker;
 };
 
 // ============================================================================
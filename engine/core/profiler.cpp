@@ -0,0 +1,234 @@
+#include "profiler.hpp"
+
+#include "log.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <unordered_set>
+
+namespace hz {
+
+namespace {
+
+std::mutex g_intern_mutex;
+std::unordered_set<std::string> g_interned;
+
+void write_json_string(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << ' ';
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+// ============================================================================
+// Internal Types
+// ============================================================================
+
+/**
+ * @brief Single-producer/single-consumer ring of completed zones
+ *
+ * head is only advanced by the owning thread, tail only by the collector.
+ */
+struct Profiler::ThreadRing {
+    std::unique_ptr<ProfileZone[]> zones{std::make_unique<ProfileZone[]>(RING_CAPACITY)};
+    alignas(64) std::atomic<u64> head{0};
+    alignas(64) std::atomic<u64> tail{0};
+    std::atomic<u64> dropped{0};
+    u32 id{0};
+    std::string name; // Guarded by s_registry_mutex
+};
+
+// ============================================================================
+// Static Members
+// ============================================================================
+
+std::atomic<bool> Profiler::s_enabled{true};
+std::mutex Profiler::s_registry_mutex;
+std::vector<std::unique_ptr<Profiler::ThreadRing>> Profiler::s_rings;
+thread_local Profiler::ThreadRing* Profiler::s_thread_ring = nullptr;
+thread_local u32 Profiler::s_depth = 0;
+ProfileFrame Profiler::s_last_frame;
+std::vector<ProfileZone> Profiler::s_capture;
+bool Profiler::s_capturing = false;
+
+// ============================================================================
+// Profiler Implementation
+// ============================================================================
+
+u64 Profiler::now_ns() noexcept {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+}
+
+const char* Profiler::intern(std::string_view name) {
+    std::lock_guard lock(g_intern_mutex);
+    return g_interned.emplace(name).first->c_str();
+}
+
+Profiler::ThreadRing& Profiler::thread_ring() {
+    if (!s_thread_ring) {
+        // Rings outlive their threads so late zones can still be collected
+        std::lock_guard lock(s_registry_mutex);
+        auto ring = std::make_unique<ThreadRing>();
+        ring->id = static_cast<u32>(s_rings.size());
+        ring->name = "Thread " + std::to_string(ring->id);
+        s_thread_ring = ring.get();
+        s_rings.push_back(std::move(ring));
+    }
+    return *s_thread_ring;
+}
+
+void Profiler::set_thread_name(std::string_view name) {
+    ThreadRing& ring = thread_ring();
+    std::lock_guard lock(s_registry_mutex);
+    ring.name = name;
+}
+
+u32 Profiler::begin_zone() noexcept {
+    return s_depth++;
+}
+
+void Profiler::end_zone(const char* name, u64 start_ns, u32 depth, u64 allocations) noexcept {
+    const u64 end_ns = now_ns();
+    s_depth = depth;
+
+    ThreadRing& ring = thread_ring();
+    const u64 head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ring.zones[head & (RING_CAPACITY - 1)] = {name, start_ns, end_ns, ring.id, depth,
+                                              static_cast<u32>(allocations)};
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::end_frame() {
+    const u64 now = now_ns();
+
+    s_last_frame.zones.clear();
+    s_last_frame.start_ns = s_last_frame.end_ns != 0 ? s_last_frame.end_ns : now;
+    s_last_frame.end_ns = now;
+
+    {
+        std::lock_guard lock(s_registry_mutex);
+        for (auto& ring : s_rings) {
+            const u64 head = ring->head.load(std::memory_order_acquire);
+            for (u64 i = ring->tail.load(std::memory_order_relaxed); i < head; ++i) {
+                s_last_frame.zones.push_back(ring->zones[i & (RING_CAPACITY - 1)]);
+            }
+            ring->tail.store(head, std::memory_order_release);
+        }
+    }
+
+    std::sort(s_last_frame.zones.begin(), s_last_frame.zones.end(),
+              [](const ProfileZone& a, const ProfileZone& b) {
+                  return a.thread_id != b.thread_id ? a.thread_id < b.thread_id
+                                                    : a.start_ns < b.start_ns;
+              });
+
+    if (s_capturing) {
+        s_capture.insert(s_capture.end(), s_last_frame.zones.begin(), s_last_frame.zones.end());
+    }
+}
+
+std::vector<ProfileThreadInfo> Profiler::threads() {
+    std::lock_guard lock(s_registry_mutex);
+    std::vector<ProfileThreadInfo> result;
+    result.reserve(s_rings.size());
+    for (const auto& ring : s_rings) {
+        result.push_back({ring->id, ring->name, ring->dropped.load(std::memory_order_relaxed)});
+    }
+    return result;
+}
+
+void Profiler::begin_capture() {
+    s_capture.clear();
+    s_capturing = true;
+}
+
+bool Profiler::write_chrome_trace(const std::filesystem::path& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        HZ_ENGINE_ERROR("Failed to open file for writing: {}", path.string());
+        return false;
+    }
+    write_chrome_trace(file, s_capture);
+    HZ_ENGINE_INFO("Wrote {} profile zones to {}", s_capture.size(), path.string());
+    return file.good();
+}
+
+void Profiler::write_chrome_trace(std::ostream& out, std::span<const ProfileZone> zones) {
+    u64 base_ns = ~u64{0};
+    for (const ProfileZone& zone : zones) {
+        base_ns = std::min(base_ns, zone.start_ns);
+    }
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const ProfileThreadInfo& thread : threads()) {
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << thread.id << ",\"args\":{\"name\":";
+        write_json_string(out, thread.name);
+        out << "}}";
+        first = false;
+    }
+
+    // Complete ("X") events in microseconds, relative to the earliest zone
+    out << std::fixed << std::setprecision(3);
+    for (const ProfileZone& zone : zones) {
+        out << (first ? "" : ",") << "\n{\"name\":";
+        write_json_string(out, zone.name ? zone.name : "");
+        out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.thread_id
+            << ",\"ts\":" << static_cast<f64>(zone.start_ns - base_ns) * 1e-3
+            << ",\"dur\":" << static_cast<f64>(zone.end_ns - zone.start_ns) * 1e-3;
+        if (zone.allocations != 0) {
+            out << ",\"args\":{\"allocations\":" << zone.allocations << "}";
+        }
+        out << "}";
+        first = false;
+    }
+
+    out << "\n]}\n";
+}
+
+void Profiler::reset() {
+    {
+        std::lock_guard lock(s_registry_mutex);
+        for (auto& ring : s_rings) {
+            ring->tail.store(ring->head.load(std::memory_order_acquire),
+                             std::memory_order_release);
+            ring->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+    s_last_frame = {};
+    s_capture.clear();
+    s_capturing = false;
+}
+
+} // namespace hz
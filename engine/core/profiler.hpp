@@ -0,0 +1,232 @@
+#pragma once
+
+/**
+ * @file profiler.hpp
+ * @brief Low-overhead CPU profiler with scoped zones
+ *
+ * HZ_PROFILE_SCOPE("name") records the begin and end timestamps (ns) of the
+ * enclosing scope into a ring buffer owned by the calling thread. Only that
+ * thread writes its ring and only the thread calling Profiler::end_frame()
+ * reads it, so recording never locks or waits; a full ring drops zones.
+ *
+ * Once per frame, end_frame() drains every ring into the last frame (drawn as
+ * a flame view by DebugOverlay) and, while a capture is active, appends the
+ * zones to the capture, which exports as Chrome/Perfetto trace JSON.
+ *
+ * Configure with -DHZ_PROFILER=OFF to compile every HZ_PROFILE_* macro out.
+ */
+
+#include "alloc_tracker.hpp"
+#include "types.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hz {
+
+/**
+ * @brief One completed zone
+ */
+struct ProfileZone {
+    const char* name{nullptr}; // String literal or Profiler::intern()
+    u64 start_ns{0};
+    u64 end_ns{0};
+    u32 thread_id{0};   // Profiler thread id, in order of first zone
+    u32 depth{0};       // Nesting depth on its thread
+    u32 allocations{0}; // Heap + PMR allocations on its thread, children included
+
+    [[nodiscard]] f64 duration_ms() const noexcept {
+        return static_cast<f64>(end_ns - start_ns) * 1e-6;
+    }
+};
+
+/**
+ * @brief A thread that has recorded zones
+ */
+struct ProfileThreadInfo {
+    u32 id{0};
+    std::string name;
+    u64 dropped_zones{0}; // Zones lost to a full ring
+};
+
+/**
+ * @brief Zones collected by one Profiler::end_frame()
+ */
+struct ProfileFrame {
+    u64 start_ns{0}; // Previous end_frame()
+    u64 end_ns{0};
+    std::vector<ProfileZone> zones; // Sorted by thread, then start time
+};
+
+// ============================================================================
+// Profiler
+// ============================================================================
+
+/**
+ * @brief Global zone collector
+ */
+class Profiler {
+public:
+    /// Zones per thread ring (power of two)
+    static constexpr usize RING_CAPACITY = 1u << 14;
+
+    /**
+     * @brief Enable or disable recording at runtime (enabled by default)
+     */
+    static void set_enabled(bool enabled) noexcept {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static bool is_enabled() noexcept {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Name the calling thread in the flame view and trace
+     */
+    static void set_thread_name(std::string_view name);
+
+    /**
+     * @brief Get a stable pointer for a runtime zone name
+     *
+     * Equal names return the same pointer. Interned strings live until exit.
+     */
+    [[nodiscard]] static const char* intern(std::string_view name);
+
+    /**
+     * @brief Monotonic timestamp in nanoseconds
+     */
+    [[nodiscard]] static u64 now_ns() noexcept;
+
+    // ========================================================================
+    // Recording (see ProfileScope)
+    // ========================================================================
+
+    /**
+     * @brief Enter a zone on the calling thread
+     * @return Nesting depth of the new zone
+     */
+    static u32 begin_zone() noexcept;
+
+    /**
+     * @brief Record a zone entered with begin_zone()
+     * @param allocations Allocations made by the thread inside the zone (see AllocTracker)
+     */
+    static void end_zone(const char* name, u64 start_ns, u32 depth, u64 allocations) noexcept;
+
+    // ========================================================================
+    // Collection (one consumer thread)
+    // ========================================================================
+
+    /**
+     * @brief Drain all thread rings into the last frame (and the capture)
+     */
+    static void end_frame();
+
+    [[nodiscard]] static const ProfileFrame& last_frame() noexcept { return s_last_frame; }
+
+    [[nodiscard]] static std::vector<ProfileThreadInfo> threads();
+
+    /**
+     * @brief Start collecting zones for export
+     */
+    static void begin_capture();
+
+    /**
+     * @brief Stop collecting; the capture stays available until the next begin_capture()
+     */
+    static void end_capture() noexcept { s_capturing = false; }
+
+    [[nodiscard]] static bool is_capturing() noexcept { return s_capturing; }
+    [[nodiscard]] static const std::vector<ProfileZone>& capture() noexcept { return s_capture; }
+
+    /**
+     * @brief Write the capture as Chrome trace JSON (chrome://tracing, ui.perfetto.dev)
+     * @return true on success
+     */
+    static bool write_chrome_trace(const std::filesystem::path& path);
+
+    /**
+     * @brief Write zones as Chrome trace JSON
+     */
+    static void write_chrome_trace(std::ostream& out, std::span<const ProfileZone> zones);
+
+    /**
+     * @brief Discard all recorded zones, the last frame and the capture
+     *
+     * Only call while no other thread is recording.
+     */
+    static void reset();
+
+private:
+    struct ThreadRing;
+
+    static ThreadRing& thread_ring();
+
+    static std::atomic<bool> s_enabled;
+    static std::mutex s_registry_mutex;
+    static std::vector<std::unique_ptr<ThreadRing>> s_rings;
+    static thread_local ThreadRing* s_thread_ring;
+    static thread_local u32 s_depth;
+
+    static ProfileFrame s_last_frame;
+    static std::vector<ProfileZone> s_capture;
+    static bool s_capturing;
+};
+
+/**
+ * @brief Records the lifetime of a scope as a zone
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) noexcept : m_name(name) {
+        if (Profiler::is_enabled()) {
+            m_depth = Profiler::begin_zone();
+            m_start_allocations = AllocTracker::thread_counters().allocations();
+            m_start_ns = Profiler::now_ns();
+            m_active = true;
+        }
+    }
+
+    ~ProfileScope() {
+        if (m_active) {
+            Profiler::end_zone(m_name, m_start_ns, m_depth,
+                               AllocTracker::thread_counters().allocations() - m_start_allocations);
+        }
+    }
+
+    HZ_NON_COPYABLE(ProfileScope);
+    HZ_NON_MOVABLE(ProfileScope);
+
+private:
+    const char* m_name;
+    u64 m_start_ns{0};
+    u64 m_start_allocations{0};
+    u32 m_depth{0};
+    bool m_active{false};
+};
+
+} // namespace hz
+
+// ============================================================================
+// Profiling Macros
+// ============================================================================
+
+#ifdef HZ_PROFILER
+#define HZ_PROFILE_SCOPE(name) ::hz::ProfileScope HZ_CONCAT(hz_profile_scope_, __LINE__)(name)
+#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE(__func__)
+#define HZ_PROFILE_THREAD(name) ::hz::Profiler::set_thread_name(name)
+#define HZ_PROFILE_FRAME() ::hz::Profiler::end_frame()
+#else
+#define HZ_PROFILE_SCOPE(name) ((void)0)
+#define HZ_PROFILE_FUNCTION() ((void)0)
+#define HZ_PROFILE_THREAD(name) ((void)0)
+#define HZ_PROFILE_FRAME() ((void)0)
+#endif
@@ -0,0 +1,208 @@
+#include "task_graph.hpp"
+
+#include "log.hpp"
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace hz {
+
+namespace {
+
+[[nodiscard]] u64 now_ns() noexcept {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+}
+
+[[nodiscard]] f64 ns_to_ms(u64 ns) noexcept {
+    return static_cast<f64>(ns) * 1e-6;
+}
+
+[[nodiscard]] bool intersects(const std::vector<std::type_index>& a,
+                              const std::vector<std::type_index>& b) {
+    for (const auto& type : a) {
+        if (std::find(b.begin(), b.end(), type) != b.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// Graph Construction
+// ============================================================================
+
+TaskGraph::SystemBuilder TaskGraph::add_system(std::string name, SystemFunction fn) {
+    System system;
+    system.name = std::move(name);
+    system.profile_name = Profiler::intern(system.name);
+    system.fn = std::move(fn);
+    m_systems.push_back(std::move(system));
+    m_dirty = true;
+    return {*this, static_cast<u32>(m_systems.size() - 1)};
+}
+
+const std::vector<u32>& TaskGraph::dependencies(u32 index) {
+    if (m_dirty) {
+        rebuild();
+    }
+    return m_systems[index].dependencies;
+}
+
+bool TaskGraph::conflicts(const System& a, const System& b) {
+    if (a.exclusive || b.exclusive) {
+        return true;
+    }
+    return intersects(a.writes, b.writes) || intersects(a.writes, b.reads) ||
+           intersects(a.reads, b.writes);
+}
+
+void TaskGraph::rebuild() {
+    for (auto& system : m_systems) {
+        system.dependencies.clear();
+        system.dependents.clear();
+    }
+
+    // Earlier registrations win, so edges only point forward and the graph is acyclic
+    for (u32 later = 0; later < m_systems.size(); ++later) {
+        for (u32 earlier = 0; earlier < later; ++earlier) {
+            if (conflicts(m_systems[earlier], m_systems[later])) {
+                m_systems[later].dependencies.push_back(earlier);
+                m_systems[earlier].dependents.push_back(later);
+            }
+        }
+    }
+
+    m_pending = std::make_unique<std::atomic<u32>[]>(m_systems.size());
+    m_dirty = false;
+
+    HZ_ENGINE_DEBUG("Task graph rebuilt: {} systems", m_systems.size());
+}
+
+// ============================================================================
+// Execution
+// ============================================================================
+
+void TaskGraph::execute(f64 dt) {
+    if (m_systems.empty()) {
+        return;
+    }
+    if (m_dirty) {
+        rebuild();
+    }
+
+    const auto count = static_cast<u32>(m_systems.size());
+    for (u32 i = 0; i < count; ++i) {
+        m_pending[i].store(static_cast<u32>(m_systems[i].dependencies.size()),
+                           std::memory_order_relaxed);
+    }
+    m_completed.store(0, std::memory_order_relaxed);
+    m_main_queue.clear();
+
+    JobCounter counter;
+    m_counter = &counter;
+    m_dt = dt;
+    m_start_ns = now_ns();
+
+    for (u32 i = 0; i < count; ++i) {
+        if (m_systems[i].dependencies.empty()) {
+            schedule(i);
+        }
+    }
+
+    // Run main-thread systems as they become ready and help with the rest
+    while (m_completed.load(std::memory_order_acquire) < count) {
+        u32 index = 0;
+        bool has_main = false;
+        {
+            std::lock_guard lock(m_main_queue_mutex);
+            if (!m_main_queue.empty()) {
+                index = m_main_queue.back();
+                m_main_queue.pop_back();
+                has_main = true;
+            }
+        }
+
+        if (has_main) {
+            run_system(index);
+        } else if (!JobSystem::try_run_one()) {
+            std::this_thread::yield();
+        }
+    }
+    JobSystem::wait(counter);
+    m_counter = nullptr;
+
+    m_stats.wall_ms = ns_to_ms(now_ns() - m_start_ns);
+    compute_critical_path();
+}
+
+void TaskGraph::schedule(u32 index) {
+    if (m_systems[index].main_thread) {
+        std::lock_guard lock(m_main_queue_mutex);
+        m_main_queue.push_back(index);
+        return;
+    }
+    JobSystem::run([this, index] { run_system(index); }, m_counter);
+}
+
+void TaskGraph::run_system(u32 index) {
+    System& system = m_systems[index];
+
+    const u64 begin = now_ns();
+    {
+        HZ_PROFILE_SCOPE(system.profile_name);
+        system.fn(m_dt);
+    }
+    const u64 end = now_ns();
+
+    system.timing.start_ms = ns_to_ms(begin - m_start_ns);
+    system.timing.duration_ms = ns_to_ms(end - begin);
+    system.timing.thread_index = JobSystem::thread_index();
+
+    for (u32 dependent : system.dependents) {
+        if (m_pending[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            schedule(dependent);
+        }
+    }
+    m_completed.fetch_add(1, std::memory_order_release);
+}
+
+void TaskGraph::compute_critical_path() {
+    const usize count = m_systems.size();
+    std::vector<f64> finish(count, 0.0);
+    std::vector<u32> previous(count, static_cast<u32>(count));
+
+    m_stats.serial_ms = 0.0;
+    u32 last = 0;
+    for (u32 i = 0; i < count; ++i) {
+        System& system = m_systems[i];
+        system.timing.on_critical_path = false;
+        m_stats.serial_ms += system.timing.duration_ms;
+
+        f64 ready = 0.0;
+        for (u32 dependency : system.dependencies) {
+            if (finish[dependency] > ready) {
+                ready = finish[dependency];
+                previous[i] = dependency;
+            }
+        }
+        finish[i] = ready + system.timing.duration_ms;
+        if (finish[i] > finish[last]) {
+            last = i;
+        }
+    }
+
+    m_stats.critical_path_ms = finish[last];
+    m_stats.critical_path.clear();
+    for (u32 i = last; i < count; i = previous[i]) {
+        m_stats.critical_path.push_back(i);
+        m_systems[i].timing.on_critical_path = true;
+    }
+    std::reverse(m_stats.critical_path.begin(), m_stats.critical_path.end());
+}
+
+} // namespace hz
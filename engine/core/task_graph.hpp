@@ -0,0 +1,169 @@
+#pragma once
+
+/**
+ * @file task_graph.hpp
+ * @brief Dependency-driven scheduler for per-tick update systems
+ *
+ * Systems declare which component (or resource) types they read and write.
+ * Two systems conflict when one writes a type the other reads or writes;
+ * conflicting systems keep their registration order, everything else may run
+ * in parallel on the JobSystem. Each execution records per-system timings and
+ * the critical path, i.e. the chain of dependent systems that bounds the tick.
+ */
+
+#include "jobs.hpp"
+#include "types.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <vector>
+
+namespace hz {
+
+using SystemFunction = std::function<void(f64 dt)>;
+
+/**
+ * @brief Timing of one system in the last execution
+ */
+struct SystemTiming {
+    f64 start_ms{0.0}; // Relative to the start of execute()
+    f64 duration_ms{0.0};
+    u32 thread_index{0}; // JobSystem::thread_index() of the executing thread
+    bool on_critical_path{false};
+};
+
+/**
+ * @brief Statistics for the last TaskGraph::execute()
+ */
+struct TaskGraphStats {
+    f64 wall_ms{0.0};               // Elapsed time for the whole graph
+    f64 serial_ms{0.0};             // Sum of all system durations
+    f64 critical_path_ms{0.0};      // Longest dependency chain
+    std::vector<u32> critical_path; // System indices, first to last
+};
+
+/**
+ * @brief DAG of update systems built from declared data access
+ *
+ * Systems that run concurrently must only touch component storages that
+ * already exist; structural changes (creating or destroying entities, adding
+ * or removing components) belong in exclusive() systems.
+ */
+class TaskGraph {
+public:
+    /**
+     * @brief Fluent declaration of a system's data access
+     */
+    class SystemBuilder {
+    public:
+        SystemBuilder(TaskGraph& graph, u32 index) : m_graph(&graph), m_index(index) {}
+
+        template <typename... Ts>
+        SystemBuilder& reads() {
+            (m_graph->m_systems[m_index].reads.emplace_back(typeid(Ts)), ...);
+            m_graph->m_dirty = true;
+            return *this;
+        }
+
+        template <typename... Ts>
+        SystemBuilder& writes() {
+            (m_graph->m_systems[m_index].writes.emplace_back(typeid(Ts)), ...);
+            m_graph->m_dirty = true;
+            return *this;
+        }
+
+        /**
+         * @brief Run on the thread calling execute() (e.g. for windowing or GL calls)
+         */
+        SystemBuilder& main_thread() {
+            m_graph->m_systems[m_index].main_thread = true;
+            return *this;
+        }
+
+        /**
+         * @brief Conflict with every other system (structural ECS changes)
+         */
+        SystemBuilder& exclusive() {
+            m_graph->m_systems[m_index].exclusive = true;
+            m_graph->m_dirty = true;
+            return *this;
+        }
+
+        [[nodiscard]] u32 index() const noexcept { return m_index; }
+
+    private:
+        TaskGraph* m_graph;
+        u32 m_index;
+    };
+
+    TaskGraph() = default;
+
+    HZ_NON_COPYABLE(TaskGraph);
+    HZ_NON_MOVABLE(TaskGraph);
+
+    /**
+     * @brief Register a system; registration order is the order for conflicting systems
+     */
+    SystemBuilder add_system(std::string name, SystemFunction fn);
+
+    /**
+     * @brief Run every system once, in parallel where the DAG allows
+     */
+    void execute(f64 dt);
+
+    [[nodiscard]] usize system_count() const noexcept { return m_systems.size(); }
+    [[nodiscard]] bool empty() const noexcept { return m_systems.empty(); }
+    [[nodiscard]] std::string_view system_name(u32 index) const { return m_systems[index].name; }
+
+    /**
+     * @brief Indices of the systems that must finish before a system starts
+     */
+    [[nodiscard]] const std::vector<u32>& dependencies(u32 index);
+
+    [[nodiscard]] const SystemTiming& timing(u32 index) const { return m_systems[index].timing; }
+    [[nodiscard]] const TaskGraphStats& stats() const noexcept { return m_stats; }
+
+private:
+    struct System {
+        std::string name;
+        const char* profile_name{nullptr}; // Interned copy of name
+        SystemFunction fn;
+        std::vector<std::type_index> reads;
+        std::vector<std::type_index> writes;
+        bool main_thread{false};
+        bool exclusive{false};
+
+        // Built by rebuild()
+        std::vector<u32> dependencies;
+        std::vector<u32> dependents;
+
+        SystemTiming timing;
+    };
+
+    void rebuild();
+    [[nodiscard]] static bool conflicts(const System& a, const System& b);
+    void run_system(u32 index);
+    void schedule(u32 index);
+    void compute_critical_path();
+
+    std::vector<System> m_systems;
+    bool m_dirty{false};
+
+    // Per-execution state
+    std::unique_ptr<std::atomic<u32>[]> m_pending;
+    std::atomic<u32> m_completed{0};
+    std::mutex m_main_queue_mutex;
+    std::vector<u32> m_main_queue;
+    JobCounter* m_counter{nullptr};
+    f64 m_dt{0.0};
+    u64 m_start_ns{0};
+
+    TaskGraphStats m_stats;
+};
+
+} // namespace hz
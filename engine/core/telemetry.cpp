@@ -0,0 +1,281 @@
+#include "telemetry.hpp"
+
+#include "log.hpp"
+#include "task_graph.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+
+namespace hz {
+
+namespace {
+
+constexpr f64 NS_TO_MS = 1e-6;
+
+[[nodiscard]] u64 seconds_to_ns(f64 seconds) noexcept {
+    return seconds > 0.0 ? static_cast<u64>(seconds * 1e9) : 0;
+}
+
+void write_csv_row(std::ostream& out, std::string_view name, const PercentileSummary& s) {
+    out << name << ',' << s.count << ',' << s.mean << ',' << s.p50 << ',' << s.p95 << ','
+        << s.p99 << ',' << s.max << '\n';
+}
+
+void write_json_summary(std::ostream& out, const PercentileSummary& s) {
+    out << "{\"count\":" << s.count << ",\"mean\":" << s.mean << ",\"p50\":" << s.p50
+        << ",\"p95\":" << s.p95 << ",\"p99\":" << s.p99 << ",\"max\":" << s.max << '}';
+}
+
+} // namespace
+
+// ============================================================================
+// LatencyHistogram Implementation
+// ============================================================================
+
+u32 LatencyHistogram::bucket_index(u64 value) noexcept {
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<u32>(value);
+    }
+    // Keep the top SUB_BUCKET_BITS bits; the mantissa is in [HALF, FULL)
+    const u32 exponent = static_cast<u32>(std::bit_width(value)) - SUB_BUCKET_BITS;
+    const auto mantissa = static_cast<u32>(value >> exponent);
+    return SUB_BUCKET_COUNT + (exponent - 1) * HALF_SUB_BUCKET_COUNT +
+           (mantissa - HALF_SUB_BUCKET_COUNT);
+}
+
+u64 LatencyHistogram::bucket_upper_bound(u32 index) noexcept {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const u32 exponent = (index - SUB_BUCKET_COUNT) / HALF_SUB_BUCKET_COUNT + 1;
+    const u64 mantissa = (index - SUB_BUCKET_COUNT) % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT;
+    return ((mantissa + 1) << exponent) - 1;
+}
+
+void LatencyHistogram::record(u64 value) noexcept {
+    ++m_buckets[bucket_index(std::min(value, MAX_VALUE))];
+    ++m_count;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept {
+    for (u32 i = 0; i < BUCKET_COUNT; ++i) {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+void LatencyHistogram::reset() noexcept {
+    *this = LatencyHistogram{};
+}
+
+u64 LatencyHistogram::value_at_percentile(f64 percentile) const noexcept {
+    if (m_count == 0) {
+        return 0;
+    }
+
+    const f64 fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+    const u64 target =
+        std::max<u64>(1, static_cast<u64>(std::ceil(fraction * static_cast<f64>(m_count))));
+
+    u64 seen = 0;
+    for (u32 i = 0; i < BUCKET_COUNT; ++i) {
+        seen += m_buckets[i];
+        if (seen >= target) {
+            return std::clamp(bucket_upper_bound(i), min(), m_max);
+        }
+    }
+    return m_max;
+}
+
+PercentileSummary LatencyHistogram::summary(f64 scale) const noexcept {
+    PercentileSummary result;
+    result.count = m_count;
+    result.mean = mean() * scale;
+    result.p50 = static_cast<f64>(value_at_percentile(50.0)) * scale;
+    result.p95 = static_cast<f64>(value_at_percentile(95.0)) * scale;
+    result.p99 = static_cast<f64>(value_at_percentile(99.0)) * scale;
+    result.max = static_cast<f64>(m_max) * scale;
+    return result;
+}
+
+// ============================================================================
+// FrameTelemetry Implementation
+// ============================================================================
+
+FrameTelemetry::FrameTelemetry(const TelemetryConfig& config) : m_config(config) {}
+
+void FrameTelemetry::record_frame(f64 frame_time, u32 updates) {
+    const u32 clamps = m_pending_clamps.exchange(0, std::memory_order_relaxed);
+
+    std::lock_guard lock(m_mutex);
+    m_frame_time.record(seconds_to_ns(frame_time));
+    m_updates.record(updates);
+
+    if (clamps == 0) {
+        m_consecutive_clamped = 0;
+        return;
+    }
+
+    ++m_clamped_frames;
+    if (++m_consecutive_clamped == m_config.spiral_frame_threshold) {
+        ++m_spiral_events;
+        HZ_ENGINE_WARN("Spiral of death: {} consecutive frames exceeded max_frame_time, "
+                       "simulation is running slower than real time",
+                       m_consecutive_clamped);
+    }
+}
+
+void FrameTelemetry::record_systems(const TaskGraph& systems) {
+    const auto count = static_cast<u32>(systems.system_count());
+
+    std::lock_guard lock(m_mutex);
+    if (m_systems.size() != count) {
+        m_systems.resize(count);
+        for (u32 i = 0; i < count; ++i) {
+            if (m_systems[i].name != systems.system_name(i)) {
+                m_systems[i] = Metric(std::string(systems.system_name(i)));
+            }
+        }
+    }
+    for (u32 i = 0; i < count; ++i) {
+        m_systems[i].record(seconds_to_ns(systems.timing(i).duration_ms * 1e-3));
+    }
+}
+
+PercentileSummary FrameTelemetry::frame_times() const {
+    std::lock_guard lock(m_mutex);
+    return m_frame_time.session.summary(NS_TO_MS);
+}
+
+PercentileSummary FrameTelemetry::updates_per_frame() const {
+    std::lock_guard lock(m_mutex);
+    return m_updates.session.summary();
+}
+
+PercentileSummary FrameTelemetry::system_times(std::string_view name) const {
+    std::lock_guard lock(m_mutex);
+    for (const Metric& system : m_systems) {
+        if (system.name == name) {
+            return system.session.summary(NS_TO_MS);
+        }
+    }
+    return {};
+}
+
+u64 FrameTelemetry::frame_count() const {
+    std::lock_guard lock(m_mutex);
+    return m_frame_time.session.count();
+}
+
+u64 FrameTelemetry::clamped_frames() const {
+    std::lock_guard lock(m_mutex);
+    return m_clamped_frames;
+}
+
+u64 FrameTelemetry::spiral_events() const {
+    std::lock_guard lock(m_mutex);
+    return m_spiral_events;
+}
+
+bool FrameTelemetry::in_spiral() const {
+    std::lock_guard lock(m_mutex);
+    return m_consecutive_clamped >= m_config.spiral_frame_threshold;
+}
+
+void FrameTelemetry::log_report() {
+    std::lock_guard lock(m_mutex);
+    if (m_frame_time.window.count() == 0) {
+        return;
+    }
+
+    const PercentileSummary frames = m_frame_time.window.summary(NS_TO_MS);
+    HZ_ENGINE_DEBUG("Frame time: p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms "
+                    "({} frames, {} ticks max)",
+                    frames.p50, frames.p95, frames.p99, frames.max, frames.count,
+                    m_updates.window.max());
+
+    // Only the systems that matter for hitches
+    for (Metric& system : m_systems) {
+        const PercentileSummary times = system.window.summary(NS_TO_MS);
+        if (times.p99 >= 1.0) {
+            HZ_ENGINE_DEBUG("  {}: p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms", system.name,
+                            times.p50, times.p99, times.max);
+        }
+        system.window.reset();
+    }
+
+    m_frame_time.window.reset();
+    m_updates.window.reset();
+}
+
+bool FrameTelemetry::write(const std::filesystem::path& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        HZ_ENGINE_ERROR("Failed to open file for writing: {}", path.string());
+        return false;
+    }
+
+    if (path.extension() == ".json") {
+        write_json(file);
+    } else {
+        write_csv(file);
+    }
+    HZ_ENGINE_INFO("Telemetry written to {}", path.string());
+    return file.good();
+}
+
+void FrameTelemetry::write_csv(std::ostream& out) const {
+    std::lock_guard lock(m_mutex);
+    out << std::fixed << std::setprecision(4);
+    out << "metric,count,mean,p50,p95,p99,max\n";
+    write_csv_row(out, "frame_time_ms", m_frame_time.session.summary(NS_TO_MS));
+    write_csv_row(out, "updates_per_frame", m_updates.session.summary());
+    for (const Metric& system : m_systems) {
+        write_csv_row(out, "system." + system.name + "_ms", system.session.summary(NS_TO_MS));
+    }
+    out << "clamped_frames," << m_clamped_frames << ",,,,,\n";
+    out << "spiral_events," << m_spiral_events << ",,,,,\n";
+}
+
+void FrameTelemetry::write_json(std::ostream& out) const {
+    std::lock_guard lock(m_mutex);
+    out << std::fixed << std::setprecision(4);
+    out << "{\n  \"frame_time_ms\": ";
+    write_json_summary(out, m_frame_time.session.summary(NS_TO_MS));
+    out << ",\n  \"updates_per_frame\": ";
+    write_json_summary(out, m_updates.session.summary());
+    out << ",\n  \"clamped_frames\": " << m_clamped_frames;
+    out << ",\n  \"spiral_events\": " << m_spiral_events;
+    out << ",\n  \"systems_ms\": {";
+    for (usize i = 0; i < m_systems.size(); ++i) {
+        // System names are identifiers chosen in code; no escaping needed
+        out << (i == 0 ? "\n    \"" : ",\n    \"") << m_systems[i].name << "\": ";
+        write_json_summary(out, m_systems[i].session.summary(NS_TO_MS));
+    }
+    out << (m_systems.empty() ? "}\n}\n" : "\n  }\n}\n");
+}
+
+void FrameTelemetry::reset() {
+    std::lock_guard lock(m_mutex);
+    m_frame_time.session.reset();
+    m_frame_time.window.reset();
+    m_updates.session.reset();
+    m_updates.window.reset();
+    m_systems.clear();
+    m_pending_clamps.store(0, std::memory_order_relaxed);
+    m_clamped_frames = 0;
+    m_consecutive_clamped = 0;
+    m_spiral_events = 0;
+}
+
+} // namespace hz
@@ -0,0 +1,214 @@
+#pragma once
+
+/**
+ * @file telemetry.hpp
+ * @brief Frame-time telemetry with percentile histograms
+ *
+ * Averages hide hitches: one 80 ms frame in a second of 8 ms frames barely
+ * moves the mean FPS. FrameTelemetry keeps log-linear (HDR-style) histograms
+ * of frame times, ticks per frame and per-system update times, reports
+ * p50/p95/p99/max, detects the spiral of death (frames whose elapsed time had
+ * to be clamped to max_frame_time) and dumps everything to CSV or JSON.
+ */
+
+#include "types.hpp"
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hz {
+
+class TaskGraph;
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+/**
+ * @brief Summary of a histogram (milliseconds for times)
+ */
+struct PercentileSummary {
+    u64 count{0};
+    f64 mean{0.0};
+    f64 p50{0.0};
+    f64 p95{0.0};
+    f64 p99{0.0};
+    f64 max{0.0};
+};
+
+/**
+ * @brief Fixed-size log-linear histogram of non-negative integer values
+ *
+ * Values below 2^SUB_BUCKET_BITS are counted exactly; larger values share a
+ * bucket with others that have the same top SUB_BUCKET_BITS bits, so any
+ * recorded value is reproduced within 1/64 of itself. Recording is O(1) and
+ * never allocates. Values above MAX_VALUE are clamped (max() stays exact).
+ */
+class LatencyHistogram {
+public:
+    static constexpr u32 SUB_BUCKET_BITS = 7;
+    static constexpr u32 VALUE_BITS = 40; // ~18 minutes in nanoseconds
+    static constexpr u64 MAX_VALUE = (u64{1} << VALUE_BITS) - 1;
+
+    void record(u64 value) noexcept;
+
+    /**
+     * @brief Add every sample of another histogram
+     */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    void reset() noexcept;
+
+    [[nodiscard]] u64 count() const noexcept { return m_count; }
+    [[nodiscard]] u64 min() const noexcept { return m_count ? m_min : 0; }
+    [[nodiscard]] u64 max() const noexcept { return m_max; }
+    [[nodiscard]] f64 mean() const noexcept {
+        return m_count ? static_cast<f64>(m_sum) / static_cast<f64>(m_count) : 0.0;
+    }
+
+    /**
+     * @brief Value that percentile% of the samples are at or below
+     * @param percentile In [0, 100]
+     */
+    [[nodiscard]] u64 value_at_percentile(f64 percentile) const noexcept;
+
+    /**
+     * @brief Summarize, multiplying every value by scale (e.g. 1e-6 for ns to ms)
+     */
+    [[nodiscard]] PercentileSummary summary(f64 scale = 1.0) const noexcept;
+
+private:
+    static constexpr u32 SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static constexpr u32 HALF_SUB_BUCKET_COUNT = SUB_BUCKET_COUNT / 2;
+    static constexpr u32 BUCKET_COUNT =
+        SUB_BUCKET_COUNT + (VALUE_BITS - SUB_BUCKET_BITS) * HALF_SUB_BUCKET_COUNT;
+
+    [[nodiscard]] static u32 bucket_index(u64 value) noexcept;
+    [[nodiscard]] static u64 bucket_upper_bound(u32 index) noexcept;
+
+    std::array<u64, BUCKET_COUNT> m_buckets{};
+    u64 m_count{0};
+    u64 m_sum{0};
+    u64 m_min{~u64{0}};
+    u64 m_max{0};
+};
+
+// ============================================================================
+// Frame Telemetry
+// ============================================================================
+
+struct TelemetryConfig {
+    u32 spiral_frame_threshold{10}; // Consecutive clamped frames before warning
+};
+
+/**
+ * @brief Frame, tick and system timing histograms for a game loop
+ *
+ * Every metric has a session histogram (whole run, used for dumps) and a
+ * window histogram that log_report() prints and clears. Frames and system
+ * timings may be recorded from different threads (pipelined GameLoop).
+ */
+class FrameTelemetry {
+public:
+    explicit FrameTelemetry(const TelemetryConfig& config = {});
+
+    HZ_NON_COPYABLE(FrameTelemetry);
+    HZ_NON_MOVABLE(FrameTelemetry);
+
+    // ========================================================================
+    // Recording
+    // ========================================================================
+
+    /**
+     * @brief Record a rendered frame
+     * @param frame_time Unclamped frame time in seconds
+     * @param updates Fixed updates run since the previous frame
+     */
+    void record_frame(f64 frame_time, u32 updates);
+
+    /**
+     * @brief Note that elapsed time was clamped to max_frame_time (simulation time was dropped)
+     */
+    void record_clamp() noexcept { m_pending_clamps.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Record the last execution time of every system in a graph
+     */
+    void record_systems(const TaskGraph& systems);
+
+    // ========================================================================
+    // Reporting
+    // ========================================================================
+
+    [[nodiscard]] PercentileSummary frame_times() const;
+    [[nodiscard]] PercentileSummary updates_per_frame() const;
+
+    /**
+     * @brief Session summary of one system's update time (zeros if unknown)
+     */
+    [[nodiscard]] PercentileSummary system_times(std::string_view name) const;
+
+    [[nodiscard]] u64 frame_count() const;
+    [[nodiscard]] u64 clamped_frames() const;
+
+    /**
+     * @brief Number of times spiral_frame_threshold consecutive frames were clamped
+     */
+    [[nodiscard]] u64 spiral_events() const;
+
+    /**
+     * @brief Whether the most recent frames are clamped back to back
+     */
+    [[nodiscard]] bool in_spiral() const;
+
+    /**
+     * @brief Log window percentiles and start a new window
+     */
+    void log_report();
+
+    /**
+     * @brief Write session summaries; format chosen by extension (.json, otherwise CSV)
+     * @return true on success
+     */
+    bool write(const std::filesystem::path& path) const;
+
+    void write_csv(std::ostream& out) const;
+    void write_json(std::ostream& out) const;
+
+    void reset();
+
+private:
+    struct Metric {
+        explicit Metric(std::string metric_name = {}) : name(std::move(metric_name)) {}
+
+        std::string name;
+        LatencyHistogram session;
+        LatencyHistogram window;
+
+        void record(u64 value) noexcept {
+            session.record(value);
+            window.record(value);
+        }
+    };
+
+    TelemetryConfig m_config;
+    mutable std::mutex m_mutex;
+
+    Metric m_frame_time{"frame_time"};
+    Metric m_updates{"updates_per_frame"};
+    std::vector<Metric> m_systems; // Indexed like the TaskGraph
+
+    std::atomic<u32> m_pending_clamps{0};
+    u64 m_clamped_frames{0};
+    u32 m_consecutive_clamped{0};
+    u64 m_spiral_events{0};
+};
+
+} // namespace hz
@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file triple_buffer.hpp
+ * @brief Lock-free single-producer/single-consumer triple buffer
+ */
+
+#include "types.hpp"
+
+#include <atomic>
+
+namespace hz {
+
+/**
+ * @brief Hands the latest value from one writer thread to one reader thread
+ *
+ * The writer fills write_buffer() and calls publish(); the reader calls read()
+ * to get the most recently published value. Neither side ever blocks or sees
+ * a partially written value, and a slow reader simply skips stale values.
+ * Buffers are reused, so containers inside T keep their capacity.
+ *
+ * @tparam T Value type (default-constructible)
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    HZ_NON_COPYABLE(TripleBuffer);
+    HZ_NON_MOVABLE(TripleBuffer);
+
+    // ========================================================================
+    // Writer
+    // ========================================================================
+
+    /**
+     * @brief Buffer owned by the writer until the next publish()
+     *
+     * Holds whatever was published two publishes ago (or a default value),
+     * not the latest data.
+     */
+    [[nodiscard]] T& write_buffer() noexcept { return m_buffers[m_write]; }
+
+    /**
+     * @brief Make the write buffer the latest value and take a free buffer
+     */
+    void publish() noexcept {
+        const u8 previous = m_shared.exchange(static_cast<u8>(m_write | FRESH_BIT),
+                                              std::memory_order_acq_rel);
+        m_write = previous & INDEX_MASK;
+    }
+
+    // ========================================================================
+    // Reader
+    // ========================================================================
+
+    /**
+     * @brief Get the latest published value
+     *
+     * Returns the same buffer as the previous call if nothing new was
+     * published. The reference stays valid until the next read().
+     */
+    [[nodiscard]] const T& read() noexcept {
+        if (m_shared.load(std::memory_order_relaxed) & FRESH_BIT) {
+            const u8 previous = m_shared.exchange(m_read, std::memory_order_acq_rel);
+            m_read = previous & INDEX_MASK;
+        }
+        return m_buffers[m_read];
+    }
+
+    /**
+     * @brief Check whether a value was published since the last read()
+     */
+    [[nodiscard]] bool has_fresh() const noexcept {
+        return (m_shared.load(std::memory_order_relaxed) & FRESH_BIT) != 0;
+    }
+
+private:
+    static constexpr u8 INDEX_MASK = 0x3;
+    static constexpr u8 FRESH_BIT = 0x4;
+
+    T m_buffers[3]{};
+    u8 m_write{0};
+    alignas(64) std::atomic<u8> m_shared{1};
+    alignas(64) u8 m_read{2};
+};
+
+} // namespace hz
@@ -3,6 +3,7 @@
 
 #include "engine/core/log.hpp"
 #include "engine/scene/components.hpp"
+#include "engine/scene/parallel.hpp"
 #include "physics_config.hpp"
 
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
@@ -155,21 +156,19 @@ void HitboxSystem::update(entt::registry& registry) {
     if (!m_physics_world)
         return;
 
-    auto view = registry.view<TransformComponent, HitboxComponent>();
-
-    for (auto entity : view) {
-        auto& transform = view.get<TransformComponent>(entity);
-        auto& hitbox_comp = view.get<HitboxComponent>(entity);
-
-        for (auto& hitbox : hitbox_comp.hitboxes) {
-            if (!hitbox.enabled || !hitbox.body_id.is_valid())
-                continue;
-
-            // Calculate world position of hitbox
-            glm::vec3 world_pos = transform.position + hitbox.offset;
-            m_physics_world->set_body_position(hitbox.body_id, world_pos);
-        }
-    }
+    // BodyInterface::SetPosition takes a per-body lock, so chunks can run concurrently
+    parallel_each(registry.view<TransformComponent, HitboxComponent>(),
+                  [this](Entity, const TransformComponent& transform,
+                         HitboxComponent& hitbox_comp) {
+                      for (auto& hitbox : hitbox_comp.hitboxes) {
+                          if (!hitbox.enabled || !hitbox.body_id.is_valid())
+                              continue;
+
+                          // Calculate world position of hitbox
+                          glm::vec3 world_pos = transform.position + hitbox.offset;
+                          m_physics_world->set_body_position(hitbox.body_id, world_pos);
+                      }
+                  });
 }
 
 void HitboxSystem::create_hitbox_bodies(entt::entity entity, HitboxComponent& hitbox_comp,
@@ -12,6 +12,7 @@
 
 #include "engine/core/types.hpp"
 #include "engine/physics/physics_world.hpp"
+#include "engine/scene/reflection.hpp"
 
 #include <string>
 #include <vector>
@@ -69,6 +70,19 @@ struct Hitbox {
     bool enabled{true};
 };
 
+template <>
+struct Reflect<Hitbox> {
+    static constexpr auto fields =
+        std::tuple{field("name", &Hitbox::name),
+                   field("type", &Hitbox::type),
+                   field("shape", &Hitbox::shape),
+                   field("offset", &Hitbox::offset),
+                   field("rotation", &Hitbox::rotation),
+                   field("dimensions", &Hitbox::dimensions),
+                   field("damage_multiplier", &Hitbox::damage_multiplier),
+                   field("enabled", &Hitbox::enabled)};
+};
+
 /**
  * @brief Component containing all hitboxes for an entity
  */
@@ -84,6 +98,13 @@ struct HitboxComponent {
     static HitboxComponent create_humanoid();
 };
 
+template <>
+struct Reflect<HitboxComponent> {
+    static constexpr std::string_view name = "HitboxComponent";
+    static constexpr auto fields = std::tuple{field("hitboxes", &HitboxComponent::hitboxes),
+                                              field("bone_names", &HitboxComponent::bone_names)};
+};
+
 /**
  * @brief Component for entities that can receive damage
  */
@@ -132,6 +153,22 @@ struct HurtboxComponent {
     void add_armor(f32 amount);
 };
 
+template <>
+struct Reflect<HurtboxComponent> {
+    using C = HurtboxComponent;
+
+    static constexpr std::string_view name = "HurtboxComponent";
+    static constexpr auto fields =
+        std::tuple{field("max_health", &C::max_health),
+                   field("current_health", &C::current_health),
+                   field("armor", &C::armor),
+                   field("max_armor", &C::max_armor),
+                   field("armor_effectiveness", &C::armor_effectiveness),
+                   field("invulnerable", &C::invulnerable),
+                   field("invulnerability_timer", &C::invulnerability_timer),
+                   field("is_dead", &C::is_dead)};
+};
+
 /**
  * @brief Damage event for event-driven damage system
  */
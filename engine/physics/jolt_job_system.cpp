@@ -0,0 +1,57 @@
+#include "jolt_job_system.hpp"
+
+#include "engine/core/jobs.hpp"
+#include "engine/core/log.hpp"
+#include "engine/core/profiler.hpp"
+
+namespace hz {
+
+JoltJobSystem::JoltJobSystem(JPH::uint max_jobs, JPH::uint max_barriers)
+    : JobSystemWithBarrier(max_barriers) {
+    m_jobs.Init(max_jobs, max_jobs);
+}
+
+int JoltJobSystem::GetMaxConcurrency() const {
+    return static_cast<int>(JobSystem::worker_count()) + 1;
+}
+
+JoltJobSystem::JobHandle JoltJobSystem::CreateJob(const char* name, JPH::ColorArg color,
+                                                  const JobFunction& function,
+                                                  JPH::uint32 num_dependencies) {
+    JPH::uint32 index;
+    while ((index = m_jobs.ConstructObject(name, color, this, function, num_dependencies)) ==
+           decltype(m_jobs)::cInvalidObjectIndex) {
+        HZ_ASSERT(false, "Jolt job pool exhausted");
+        std::this_thread::yield();
+    }
+
+    // Take a handle before queueing; the job may complete immediately
+    Job* job = &m_jobs.Get(index);
+    JobHandle handle(job);
+    if (num_dependencies == 0) {
+        QueueJob(job);
+    }
+    return handle;
+}
+
+void JoltJobSystem::QueueJob(Job* job) {
+    // Keep the job alive until it has run; released by the executing thread
+    job->AddRef();
+    JobSystem::run([job] {
+        HZ_PROFILE_SCOPE("Jolt job");
+        job->Execute();
+        job->Release();
+    });
+}
+
+void JoltJobSystem::QueueJobs(Job** jobs, JPH::uint num_jobs) {
+    for (JPH::uint i = 0; i < num_jobs; ++i) {
+        QueueJob(jobs[i]);
+    }
+}
+
+void JoltJobSystem::FreeJob(Job* job) {
+    m_jobs.DestructObject(job);
+}
+
+} // namespace hz
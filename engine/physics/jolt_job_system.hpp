@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file jolt_job_system.hpp
+ * @brief Jolt JobSystem adapter that runs physics jobs on the engine JobSystem
+ */
+
+#include "engine/core/types.hpp"
+
+// Jolt Physics - MUST include Jolt.h first!
+#include <Jolt/Jolt.h>
+
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+
+namespace hz {
+
+/**
+ * @brief Feeds Jolt jobs into hz::JobSystem instead of a private thread pool
+ *
+ * Physics then shares workers with the rest of the engine rather than
+ * oversubscribing the CPU. Requires JobSystem::init() to have been called.
+ */
+class JoltJobSystem final : public JPH::JobSystemWithBarrier {
+public:
+    JoltJobSystem(JPH::uint max_jobs, JPH::uint max_barriers);
+    ~JoltJobSystem() override = default;
+
+    HZ_NON_COPYABLE(JoltJobSystem);
+    HZ_NON_MOVABLE(JoltJobSystem);
+
+    [[nodiscard]] int GetMaxConcurrency() const override;
+    JobHandle CreateJob(const char* name, JPH::ColorArg color, const JobFunction& function,
+                        JPH::uint32 num_dependencies = 0) override;
+
+protected:
+    void QueueJob(Job* job) override;
+    void QueueJobs(Job** jobs, JPH::uint num_jobs) override;
+    void FreeJob(Job* job) override;
+
+private:
+    JPH::FixedSizeFreeList<Job> m_jobs;
+};
+
+} // namespace hz
@@ -2,6 +2,7 @@
 #include "physics_interactions.hpp"
 
 #include "engine/core/log.hpp"
+#include "engine/scene/command_buffer.hpp"
 #include "engine/scene/components.hpp"
 #include "physics_config.hpp"
 
@@ -154,9 +155,7 @@ void PhysicsInteractionSystem::destroy_object(entt::registry& registry, entt::en
         m_destruction_callback(entity, position);
     }
 
-    // Mark for destruction (or destroy immediately)
-    // In a real implementation, you might want to defer this
-    registry.destroy(entity);
+    command_buffer(registry).list().destroy(entity);
 }
 
 void PhysicsInteractionSystem::check_destruction_stages(entt::registry& registry,
@@ -182,6 +181,7 @@ void PhysicsInteractionSystem::spawn_debris(entt::registry& registry, const glm:
     if (!m_physics_world)
         return;
 
+    CommandList& commands = command_buffer(registry).list();
     for (int i = 0; i < destructible.debris_count; ++i) {
         // Random direction for debris
         f32 theta = static_cast<f32>(rand()) / RAND_MAX * glm::two_pi<f32>();
@@ -207,8 +207,8 @@ void PhysicsInteractionSystem::spawn_debris(entt::registry& registry, const glm:
         m_physics_world->apply_impulse(debris_body, force);
 
         // Create debris entity
-        entt::entity debris_entity = registry.create();
-        registry.emplace<TransformComponent>(debris_entity, TransformComponent{spawn_pos});
+        PendingEntity debris_entity = commands.create();
+        commands.emplace<TransformComponent>(debris_entity, TransformComponent{spawn_pos});
 
         // Store body ID for cleanup (you'd want a DebrisComponent for this)
     }
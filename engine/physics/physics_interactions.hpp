@@ -13,6 +13,7 @@
 #include "engine/core/types.hpp"
 #include "engine/physics/physics_world.hpp"
 #include "engine/physics/projectile_system.hpp"
+#include "engine/scene/reflection.hpp"
 
 #include <functional>
 #include <string>
@@ -66,6 +67,24 @@ struct PhysicsMaterial {
     std::string destroy_particle;
 };
 
+template <>
+struct Reflect<PhysicsMaterial> {
+    using M = PhysicsMaterial;
+
+    static constexpr auto fields =
+        std::tuple{field("type", &M::type),
+                   field("name", &M::name),
+                   field("penetration_resistance", &M::penetration_resistance),
+                   field("damage_reduction", &M::damage_reduction),
+                   field("thickness", &M::thickness),
+                   field("hardness", &M::hardness),
+                   field("is_destructible", &M::is_destructible),
+                   field("impact_sound", &M::impact_sound),
+                   field("footstep_sound", &M::footstep_sound),
+                   field("impact_particle", &M::impact_particle),
+                   field("destroy_particle", &M::destroy_particle)};
+};
+
 /**
  * @brief Default material definitions
  */
@@ -155,6 +174,15 @@ struct DestructionStage {
     std::string particle;   // Particle effect
 };
 
+template <>
+struct Reflect<DestructionStage> {
+    static constexpr auto fields =
+        std::tuple{field("health_threshold", &DestructionStage::health_threshold),
+                   field("model_path", &DestructionStage::model_path),
+                   field("sound", &DestructionStage::sound),
+                   field("particle", &DestructionStage::particle)};
+};
+
 /**
  * @brief Component for destructible objects
  */
@@ -188,6 +216,23 @@ struct DestructibleComponent {
     bool apply_damage(f32 damage, const glm::vec3& hit_point, const glm::vec3& hit_direction);
 };
 
+template <>
+struct Reflect<DestructibleComponent> {
+    using C = DestructibleComponent;
+
+    static constexpr std::string_view name = "DestructibleComponent";
+    static constexpr auto fields = std::tuple{field("max_health", &C::max_health),
+                                              field("current_health", &C::current_health),
+                                              field("material", &C::material),
+                                              field("stages", &C::stages),
+                                              field("current_stage", &C::current_stage),
+                                              field("spawn_debris", &C::spawn_debris),
+                                              field("debris_model", &C::debris_model),
+                                              field("debris_count", &C::debris_count),
+                                              field("debris_force", &C::debris_force),
+                                              field("is_destroyed", &C::is_destroyed)};
+};
+
 // ============================================================================
 // Interactive Physics Props
 // ============================================================================
@@ -235,6 +280,28 @@ struct PhysicsPropComponent {
     glm::vec3 allowed_movement{1.0f, 1.0f, 1.0f}; // Per-axis movement multiplier
 };
 
+template <>
+struct Reflect<PhysicsPropComponent> {
+    using C = PhysicsPropComponent;
+
+    // Grab state is transient and not saved
+    static constexpr std::string_view name = "PhysicsPropComponent";
+    static constexpr auto fields =
+        std::tuple{field("interaction_type", &C::interaction_type),
+                   field("material", &C::material),
+                   field("mass", &C::mass),
+                   field("friction", &C::friction),
+                   field("restitution", &C::restitution),
+                   field("push_force_multiplier", &C::push_force_multiplier),
+                   field("throw_force", &C::throw_force),
+                   field("grab_distance", &C::grab_distance),
+                   field("deals_collision_damage", &C::deals_collision_damage),
+                   field("min_damage_velocity", &C::min_damage_velocity),
+                   field("damage_per_velocity", &C::damage_per_velocity),
+                   field("lock_rotation", &C::lock_rotation),
+                   field("allowed_movement", &C::allowed_movement)};
+};
+
 /**
  * @brief Component for objects that are currently being held
  */
@@ -327,6 +394,9 @@ public:
 
     /**
      * @brief Destroy an entity and spawn debris
+     *
+     * Both are recorded on the registry's command buffer and happen at the
+     * next flush (Scene::flush_commands()), so this is safe mid-iteration.
      */
     void destroy_object(entt::registry& registry, entt::entity entity);
 
@@ -405,4 +475,10 @@ struct MaterialComponent {
     PhysicsMaterial material;
 };
 
+template <>
+struct Reflect<MaterialComponent> {
+    static constexpr std::string_view name = "MaterialComponent";
+    static constexpr auto fields = std::tuple{field("material", &MaterialComponent::material)};
+};
+
 } // namespace hz
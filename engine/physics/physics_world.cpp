@@ -1,9 +1,17 @@
 // Include physics config first (sets up JPH_DEBUG_RENDERER before Jolt headers)
 #include "physics_world.hpp"
 
+#include "jolt_job_system.hpp"
 #include "physics_config.hpp"
 
+#include "engine/core/jobs.hpp"
+#include "engine/core/memory.hpp"
+#include "engine/core/profiler.hpp"
+
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <thread>
 
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
@@ -18,22 +26,135 @@ namespace hz {
 // Jolt Memory Allocators
 // ============================================================================
 
-void* JoltAlloc(size_t size) {
-    return std::malloc(size);
-}
+namespace {
+
+// Temp allocator reservation; only the pages a step actually touches are committed
+constexpr usize PHYSICS_TEMP_RESERVE = 256 * 1024 * 1024;
+constexpr usize PHYSICS_TEMP_INITIAL_COMMIT = 1024 * 1024;
+
+// Jolt requires 16-byte alignment for plain allocations on 64-bit targets
+constexpr usize JOLT_MIN_ALIGNMENT = 16;
+
+/**
+ * Jolt frees without passing a size, so every block is prefixed with a header
+ * recording what was requested from the tracked resource:
+ * [padding][BlockHeader][user data]
+ */
+struct alignas(JOLT_MIN_ALIGNMENT) BlockHeader {
+    usize size;
+    usize alignment;
+};
 
-void JoltFree(void* ptr) {
-    std::free(ptr);
+[[nodiscard]] constexpr usize header_offset(usize alignment) noexcept {
+    return (sizeof(BlockHeader) + alignment - 1) & ~(alignment - 1);
 }
 
 void* JoltAlignedAlloc(size_t size, size_t alignment) {
-    return std::aligned_alloc(alignment, size);
+    alignment = std::max(alignment, JOLT_MIN_ALIGNMENT);
+    const usize offset = header_offset(alignment);
+    const usize total = offset + size;
+
+    void* raw = nullptr;
+    try {
+        raw = MemoryContext::get(MemoryDomain::Physics)->allocate(total, alignment);
+    } catch (const std::bad_alloc&) {
+        // Jolt cannot recover from a failed allocation
+        HZ_ENGINE_FATAL("Physics allocation of {} bytes failed", size);
+        std::abort();
+    }
+
+    auto* block = static_cast<std::byte*>(raw) + offset;
+    auto* header = reinterpret_cast<BlockHeader*>(block) - 1;
+    header->size = total;
+    header->alignment = alignment;
+    return block;
 }
 
-void JoltAlignedFree(void* ptr) {
-    std::free(ptr);
+void JoltAlignedFree(void* block) {
+    if (block == nullptr) {
+        return;
+    }
+    const auto* header = static_cast<const BlockHeader*>(block) - 1;
+    const usize size = header->size;
+    const usize alignment = header->alignment;
+    MemoryContext::get(MemoryDomain::Physics)
+        ->deallocate(static_cast<std::byte*>(block) - header_offset(alignment), size, alignment);
 }
 
+void* JoltAlloc(size_t size) {
+    return JoltAlignedAlloc(size, JOLT_MIN_ALIGNMENT);
+}
+
+void JoltFree(void* block) {
+    JoltAlignedFree(block);
+}
+
+void* JoltRealloc(void* block, size_t old_size, size_t new_size) {
+    void* result = JoltAlloc(new_size);
+    if (block != nullptr) {
+        std::memcpy(result, block, std::min(old_size, new_size));
+        JoltFree(block);
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// Temp Allocator
+// ============================================================================
+
+/**
+ * @brief Stack allocator for Jolt's per-step scratch memory
+ *
+ * Backed by a virtual LinearArena so small scenes only commit what they use
+ * and large scenes grow instead of overflowing a fixed block. Jolt frees in
+ * strict LIFO order (possibly from different job threads, ordered by job
+ * dependencies), so each free rewinds to the marker of its allocation.
+ */
+class PhysicsWorld::TempAllocatorImpl final : public JPH::TempAllocator {
+public:
+    TempAllocatorImpl()
+        : m_arena(VirtualArenaConfig{.reserve_size = PHYSICS_TEMP_RESERVE,
+                                     .initial_commit = PHYSICS_TEMP_INITIAL_COMMIT})
+        , m_markers(MemoryContext::get(MemoryDomain::Physics)) {
+        m_markers.reserve(64);
+    }
+
+    void* Allocate(JPH::uint size) override {
+        if (size == 0) {
+            return nullptr;
+        }
+        m_markers.push_back(m_arena.used());
+        return m_arena.allocate(size, JPH_RVECTOR_ALIGNMENT);
+    }
+
+    void Free(void* address, [[maybe_unused]] JPH::uint size) override {
+        if (address == nullptr) {
+            return;
+        }
+        HZ_ASSERT(!m_markers.empty(), "Physics temp allocator freed more blocks than allocated");
+        m_arena.rewind(m_markers.back());
+        m_markers.pop_back();
+    }
+
+    /**
+     * @brief Called after each physics step; lets the arena decommit unused pages
+     */
+    void end_step() noexcept {
+        HZ_ASSERT(m_markers.empty(), "Physics temp allocator has {} blocks live after step",
+                  m_markers.size());
+        m_markers.clear();
+        m_arena.reset();
+    }
+
+    [[nodiscard]] const LinearArena& arena() const noexcept { return m_arena; }
+
+private:
+    LinearArena m_arena;
+    std::pmr::vector<usize> m_markers;
+};
+
 // ============================================================================
 // Broad Phase Layer Interface
 // ============================================================================
@@ -124,8 +245,12 @@ bool PhysicsWorld::init() {
     if (m_initialized)
         return true;
 
-    // Register Jolt allocators
-    JPH::RegisterDefaultAllocator();
+    // Route Jolt's heap through the tracked physics domain
+    JPH::Allocate = JoltAlloc;
+    JPH::Reallocate = JoltRealloc;
+    JPH::Free = JoltFree;
+    JPH::AlignedAllocate = JoltAlignedAlloc;
+    JPH::AlignedFree = JoltAlignedFree;
 
     // Create factory
     m_factory = std::make_unique<JPH::Factory>();
@@ -134,13 +259,21 @@ bool PhysicsWorld::init() {
     // Register all types
     JPH::RegisterTypes();
 
-    // Create temp allocator (10 MB)
-    m_temp_allocator = std::make_unique<JPH::TempAllocatorImpl>(10 * 1024 * 1024);
-
-    // Create job system with 1 thread per core (max 8)
-    auto num_threads = std::min(static_cast<unsigned int>(std::thread::hardware_concurrency()), 8u);
-    m_job_system = std::make_unique<JPH::JobSystemThreadPool>(
-        JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, static_cast<int>(num_threads) - 1);
+    // Create temp allocator (grows on demand)
+    m_temp_allocator = std::make_unique<TempAllocatorImpl>();
+
+    // Share the engine's workers when available; otherwise fall back to a
+    // private pool with 1 thread per core (max 8)
+    unsigned int num_threads;
+    if (JobSystem::is_initialized()) {
+        num_threads = JobSystem::worker_count() + 1;
+        m_job_system =
+            std::make_unique<JoltJobSystem>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+    } else {
+        num_threads = std::min(static_cast<unsigned int>(std::thread::hardware_concurrency()), 8u);
+        m_job_system = std::make_unique<JPH::JobSystemThreadPool>(
+            JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, static_cast<int>(num_threads) - 1);
+    }
 
     // Create layer interfaces
     m_broad_phase_layer_interface = std::make_unique<BPLayerInterfaceImpl>();
@@ -178,6 +311,7 @@ void PhysicsWorld::shutdown() {
     m_broad_phase_layer_interface.reset();
 
     // Destroy factory
+    JPH::UnregisterTypes();
     m_factory.reset();
     JPH::Factory::sInstance = nullptr;
 
@@ -189,12 +323,28 @@ void PhysicsWorld::update(f32 delta_time) {
     if (!m_initialized)
         return;
 
+    HZ_PROFILE_SCOPE("PhysicsWorld::update");
+
     // Physics runs at fixed 60 Hz
     constexpr f32 physics_dt = 1.0f / 60.0f;
     constexpr int collision_steps = 1;
 
     m_physics_system->Update(std::min(delta_time, physics_dt), collision_steps,
                              m_temp_allocator.get(), m_job_system.get());
+    m_temp_allocator->end_step();
+}
+
+PhysicsMemoryStats PhysicsWorld::memory_stats() const {
+    const MemoryDomainStats heap = MemoryContext::stats(MemoryDomain::Physics);
+
+    PhysicsMemoryStats stats;
+    stats.heap_live_bytes = heap.live_bytes;
+    stats.heap_peak_bytes = heap.peak_bytes;
+    if (m_temp_allocator) {
+        stats.temp_high_water = m_temp_allocator->arena().high_water_mark();
+        stats.temp_committed = m_temp_allocator->arena().committed();
+    }
+    return stats;
 }
 
 PhysicsBodyID PhysicsWorld::create_static_box(const glm::vec3& position,
@@ -69,8 +69,21 @@ struct RaycastHit {
     bool hit{false};
 };
 
+/**
+ * @brief Physics memory usage snapshot
+ */
+struct PhysicsMemoryStats {
+    usize heap_live_bytes{0}; // Jolt heap, tracked by MemoryDomain::Physics
+    usize heap_peak_bytes{0};
+    usize temp_high_water{0}; // Peak per-step scratch usage
+    usize temp_committed{0};  // Scratch pages currently committed
+};
+
 /**
  * @brief Physics world - manages Jolt simulation
+ *
+ * All Jolt heap allocations are routed through MemoryContext's Physics domain,
+ * so MemoryContext::set_budget(MemoryDomain::Physics, ...) caps them.
  */
 class PhysicsWorld {
 public:
@@ -102,10 +115,13 @@ public:
     [[nodiscard]] RaycastHit raycast(const glm::vec3& origin, const glm::vec3& direction,
                                      f32 max_distance = 1000.0f) const;
     [[nodiscard]] JPH::PhysicsSystem* jolt_system() { return m_physics_system.get(); }
+    [[nodiscard]] PhysicsMemoryStats memory_stats() const;
 
 private:
-    std::unique_ptr<JPH::TempAllocatorImpl> m_temp_allocator;
-    std::unique_ptr<JPH::JobSystemThreadPool> m_job_system;
+    class TempAllocatorImpl;
+
+    std::unique_ptr<TempAllocatorImpl> m_temp_allocator;
+    std::unique_ptr<JPH::JobSystem> m_job_system;
     std::unique_ptr<JPH::PhysicsSystem> m_physics_system;
     std::unique_ptr<JPH::Factory> m_factory;
 
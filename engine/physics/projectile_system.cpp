@@ -2,6 +2,7 @@
 #include "projectile_system.hpp"
 
 #include "engine/core/log.hpp"
+#include "engine/scene/command_buffer.hpp"
 #include "engine/scene/components.hpp"
 #include "physics_config.hpp"
 
@@ -280,19 +281,12 @@ void ProjectileSystem::process_explosion(entt::registry& registry, const glm::ve
 }
 
 void ProjectileSystem::cleanup_destroyed_projectiles(entt::registry& registry) {
-    auto view = registry.view<ProjectileComponent>();
-
-    std::vector<entt::entity> to_destroy;
-    for (auto entity : view) {
-        auto& proj = view.get<ProjectileComponent>(entity);
+    CommandList& commands = command_buffer(registry).list();
+    for (auto [entity, proj] : registry.view<ProjectileComponent>().each()) {
         if (proj.pending_destroy) {
-            to_destroy.push_back(entity);
+            commands.destroy(entity);
         }
     }
-
-    for (auto entity : to_destroy) {
-        registry.destroy(entity);
-    }
 }
 
 } // namespace hz
@@ -141,6 +141,10 @@ public:
 
     /**
      * @brief Update all projectiles
+     *
+     * Spent projectiles are destroyed through the registry's command buffer,
+     * so they disappear at the next flush (Scene::flush_commands()).
+     *
      * @param registry ECS registry
      * @param delta_time Time since last frame
      */
@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only memory-mapped file
+ *
+ * The OS pages the file in as it is touched, so a loader can read large
+ * files in place instead of copying them into a buffer first.
+ */
+
+#include "engine/core/types.hpp"
+
+#include <filesystem>
+#include <span>
+
+namespace hz {
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    HZ_NON_COPYABLE(MappedFile);
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a whole file read-only (closes any file mapped before)
+     * @return false if the file cannot be opened or is empty
+     */
+    [[nodiscard]] bool open(const std::filesystem::path& path);
+
+    /**
+     * @brief Unmap the file; spans into it become invalid
+     */
+    void close() noexcept;
+
+    [[nodiscard]] bool is_open() const noexcept { return m_data != nullptr; }
+    [[nodiscard]] const u8* data() const noexcept { return m_data; }
+    [[nodiscard]] usize size() const noexcept { return m_size; }
+    [[nodiscard]] std::span<const u8> bytes() const noexcept { return {m_data, m_size}; }
+
+private:
+    const u8* m_data{nullptr};
+    usize m_size{0};
+};
+
+} // namespace hz
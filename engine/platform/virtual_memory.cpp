@@ -0,0 +1,71 @@
+#include "virtual_memory.hpp"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace hz::vm {
+
+#if defined(_WIN32)
+
+usize page_size() noexcept {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<usize>(info.dwPageSize);
+}
+
+void* reserve(usize size) noexcept {
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool commit(void* address, usize size) noexcept {
+    return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void decommit(void* address, usize size) noexcept {
+    VirtualFree(address, size, MEM_DECOMMIT);
+}
+
+void release(void* address, usize /*size*/) noexcept {
+    VirtualFree(address, 0, MEM_RELEASE);
+}
+
+#else
+
+usize page_size() noexcept {
+    static const usize s_page_size = static_cast<usize>(sysconf(_SC_PAGESIZE));
+    return s_page_size;
+}
+
+void* reserve(usize size) noexcept {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    void* address = mmap(nullptr, size, PROT_NONE, flags, -1, 0);
+    return address == MAP_FAILED ? nullptr : address;
+}
+
+bool commit(void* address, usize size) noexcept {
+    return mprotect(address, size, PROT_READ | PROT_WRITE) == 0;
+}
+
+void decommit(void* address, usize size) noexcept {
+    // Drop the physical pages first, then make the range inaccessible again
+    madvise(address, size, MADV_DONTNEED);
+    mprotect(address, size, PROT_NONE);
+}
+
+void release(void* address, usize size) noexcept {
+    munmap(address, size);
+}
+
+#endif
+
+} // namespace hz::vm
@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * @file virtual_memory.hpp
+ * @brief Thin wrapper over OS virtual memory reservation and commit
+ *
+ * Used by growable arenas to reserve a large address range up front and
+ * back it with physical pages only as it is touched.
+ */
+
+#include "engine/core/types.hpp"
+
+namespace hz::vm {
+
+/**
+ * @brief Size of an OS page in bytes
+ */
+[[nodiscard]] usize page_size() noexcept;
+
+/**
+ * @brief Reserve address space without committing physical memory
+ * @return Base address, or nullptr on failure
+ */
+[[nodiscard]] void* reserve(usize size) noexcept;
+
+/**
+ * @brief Make a page-aligned range of reserved memory readable and writable
+ */
+[[nodiscard]] bool commit(void* address, usize size) noexcept;
+
+/**
+ * @brief Return a page-aligned committed range to the OS, keeping the reservation
+ */
+void decommit(void* address, usize size) noexcept;
+
+/**
+ * @brief Release an entire reservation made with reserve()
+ */
+void release(void* address, usize size) noexcept;
+
+} // namespace hz::vm
@@ -433,6 +433,8 @@ bool DeferredRenderer::init(u32 width, u32 height) {
     m_width = width;
     m_height = height;
 
+    m_gpu_timer = std::make_unique<gl::GpuTimer>(GPU_PASS_COUNT);
+
     // Create G-Buffer
     m_gbuffer.create(width, height);
 
@@ -626,6 +628,7 @@ void DeferredRenderer::shutdown() {
         glDeleteVertexArrays(1, &m_quad_vao);
         glDeleteBuffers(1, &m_quad_vbo);
     }
+    m_gpu_timer.reset();
 
     m_initialized = false;
     HZ_ENGINE_INFO("Deferred Renderer shutdown");
@@ -652,6 +655,7 @@ void DeferredRenderer::resize(u32 width, u32 height) {
 }
 
 void DeferredRenderer::begin_geometry_pass(const Camera& camera) {
+    begin_gpu_pass(GPU_PASS_GEOMETRY);
     m_gbuffer.bind();
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glEnable(GL_DEPTH_TEST);
@@ -663,9 +667,11 @@ void DeferredRenderer::begin_geometry_pass(const Camera& camera) {
 
 void DeferredRenderer::end_geometry_pass() {
     m_gbuffer.unbind();
+    end_gpu_pass(GPU_PASS_GEOMETRY);
 }
 
 void DeferredRenderer::render_shadows(const glm::vec3& light_direction) {
+    begin_gpu_pass(GPU_PASS_SHADOW);
     glEnable(GL_DEPTH_TEST);
     glCullFace(GL_FRONT); // Peter panning fix
 
@@ -676,11 +682,13 @@ void DeferredRenderer::render_shadows(const glm::vec3& light_direction) {
 
     glCullFace(GL_BACK);
     m_csm.unbind();
+    end_gpu_pass(GPU_PASS_SHADOW);
 }
 
 void DeferredRenderer::begin_shadow_pass(const glm::mat4& light_space_matrix) {
     m_light_space_matrix = light_space_matrix;
 
+    begin_gpu_pass(GPU_PASS_SHADOW);
     glBindFramebuffer(GL_FRAMEBUFFER, m_csm.fbo);
     glViewport(0, 0, static_cast<GLsizei>(m_csm.config.resolution),
                static_cast<GLsizei>(m_csm.config.resolution));
@@ -700,6 +708,7 @@ void DeferredRenderer::end_shadow_pass() {
     glCullFace(GL_BACK);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glViewport(0, 0, static_cast<GLsizei>(m_width), static_cast<GLsizei>(m_height));
+    end_gpu_pass(GPU_PASS_SHADOW);
 }
 
 void DeferredRenderer::execute_lighting_pass(const Camera& camera,
@@ -708,6 +717,7 @@ void DeferredRenderer::execute_lighting_pass(const Camera& camera,
                                              const glm::vec3& sun_direction,
                                              const glm::vec3& sun_color, u32 irradiance_map,
                                              u32 prefilter_map, u32 brdf_lut, u32 environment_map) {
+    begin_gpu_pass(GPU_PASS_LIGHTING);
     glBindFramebuffer(GL_FRAMEBUFFER, m_lighting_fbo);
     glDrawBuffer(GL_COLOR_ATTACHMENT0);
     glViewport(0, 0, static_cast<GLsizei>(m_width), static_cast<GLsizei>(m_height));
@@ -797,12 +807,14 @@ void DeferredRenderer::execute_lighting_pass(const Camera& camera,
     render_fullscreen_quad();
 
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    end_gpu_pass(GPU_PASS_LIGHTING);
 }
 
 void DeferredRenderer::execute_ssr_pass(const Camera& camera) {
     if (!m_ssr.config.enabled)
         return;
 
+    begin_gpu_pass(GPU_PASS_SSR);
     m_ssr.bind();
     glClear(GL_COLOR_BUFFER_BIT);
     glDisable(GL_DEPTH_TEST);
@@ -813,12 +825,14 @@ void DeferredRenderer::execute_ssr_pass(const Camera& camera) {
 
     render_fullscreen_quad();
     m_ssr.unbind();
+    end_gpu_pass(GPU_PASS_SSR);
 }
 
 void DeferredRenderer::execute_taa_pass() {
     if (!m_taa.config.enabled)
         return;
 
+    begin_gpu_pass(GPU_PASS_TAA);
     m_taa.bind();
     glDrawBuffer(GL_COLOR_ATTACHMENT0);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -850,6 +864,7 @@ void DeferredRenderer::execute_taa_pass() {
     render_fullscreen_quad();
     m_taa.unbind();
     m_taa.swap_history();
+    end_gpu_pass(GPU_PASS_TAA);
 }
 
 void DeferredRenderer::execute_post_process(const Camera& camera, f32 exposure, f32 bloom_threshold,
@@ -858,6 +873,7 @@ void DeferredRenderer::execute_post_process(const Camera& camera, f32 exposure,
 }
 
 void DeferredRenderer::render_to_screen() {
+    begin_gpu_pass(GPU_PASS_COMPOSITE);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glViewport(0, 0, static_cast<GLsizei>(m_width), static_cast<GLsizei>(m_height));
     glClear(GL_COLOR_BUFFER_BIT);
@@ -877,6 +893,10 @@ void DeferredRenderer::render_to_screen() {
     }
 
     render_fullscreen_quad();
+    end_gpu_pass(GPU_PASS_COMPOSITE);
+
+    // Last pass of the frame
+    update_gpu_stats();
 }
 
 void DeferredRenderer::update_frustum(const Camera& camera) {
@@ -940,6 +960,37 @@ void DeferredRenderer::reset_stats() {
     m_stats = RenderStats{};
 }
 
+void DeferredRenderer::begin_gpu_pass(GpuPass pass) {
+    if (m_gpu_timer) {
+        m_gpu_timer->begin(pass);
+    }
+}
+
+void DeferredRenderer::end_gpu_pass(GpuPass pass) {
+    if (m_gpu_timer) {
+        m_gpu_timer->end(pass);
+    }
+}
+
+void DeferredRenderer::update_gpu_stats() {
+    if (!m_gpu_timer) {
+        return;
+    }
+    m_gpu_timer->end_frame();
+
+    // Passes skipped this frame (SSR or TAA disabled) count as 0
+    const gl::GpuTimer& timer = *m_gpu_timer;
+    const auto pass_ms = [&timer](GpuPass pass) {
+        return timer.is_active(pass) ? timer.elapsed_ms(pass) : 0.0f;
+    };
+    m_stats.shadow_pass_ms = pass_ms(GPU_PASS_SHADOW);
+    m_stats.geometry_pass_ms = pass_ms(GPU_PASS_GEOMETRY);
+    m_stats.lighting_pass_ms = pass_ms(GPU_PASS_LIGHTING) + pass_ms(GPU_PASS_SSR);
+    m_stats.post_process_ms = pass_ms(GPU_PASS_TAA) + pass_ms(GPU_PASS_COMPOSITE);
+    m_stats.total_frame_ms = m_stats.shadow_pass_ms + m_stats.geometry_pass_ms +
+                             m_stats.lighting_pass_ms + m_stats.post_process_ms;
+}
+
 u32 DeferredRenderer::get_final_output() const {
     return m_taa.config.enabled ? m_taa.current_texture : m_lighting_texture;
 }
@@ -24,6 +24,7 @@
 #include "engine/core/types.hpp"
 #include "engine/renderer/camera.hpp"
 #include "engine/renderer/opengl/framebuffer.hpp"
+#include "engine/renderer/opengl/gpu_timer.hpp"
 #include "engine/renderer/opengl/shader.hpp"
 
 #include <array>
@@ -239,11 +240,13 @@ struct RenderStats {
     u32 visible_objects{0};
     u32 culled_objects{0};
     u32 active_lights{0};
+
+    // GPU times from timer queries, a few frames old; 0 when unsupported
     f32 geometry_pass_ms{0.0f};
-    f32 lighting_pass_ms{0.0f};
+    f32 lighting_pass_ms{0.0f}; // Lighting + SSR
     f32 shadow_pass_ms{0.0f};
-    f32 post_process_ms{0.0f};
-    f32 total_frame_ms{0.0f};
+    f32 post_process_ms{0.0f}; // TAA + composite
+    f32 total_frame_ms{0.0f};  // Sum of the timed passes
 };
 
 /**
@@ -403,10 +406,25 @@ public:
     [[nodiscard]] bool is_visible(const glm::vec3& min, const glm::vec3& max) const;
 
 private:
+    // Passes timed on the GPU
+    enum GpuPass : u32 {
+        GPU_PASS_SHADOW,
+        GPU_PASS_GEOMETRY,
+        GPU_PASS_LIGHTING,
+        GPU_PASS_SSR,
+        GPU_PASS_TAA,
+        GPU_PASS_COMPOSITE,
+        GPU_PASS_COUNT
+    };
+
     void create_shaders();
     void create_fullscreen_quad();
     void render_fullscreen_quad() const;
 
+    void begin_gpu_pass(GpuPass pass);
+    void end_gpu_pass(GpuPass pass);
+    void update_gpu_stats();
+
     // Dimensions
     u32 m_width{0};
     u32 m_height{0};
@@ -449,6 +467,7 @@ private:
 
     // Stats
     RenderStats m_stats;
+    std::unique_ptr<gl::GpuTimer> m_gpu_timer;
 
     bool m_initialized{false};
 };
@@ -6,13 +6,16 @@
 
 namespace hz {
 
-Mesh::Mesh(std::vector<Vertex> vertices, std::vector<u32> indices) {
+Mesh::Mesh(std::vector<Vertex> vertices, std::vector<u32> indices)
+    : Mesh(std::span<const Vertex>(vertices), std::span<const u32>(indices)) {}
+
+Mesh::Mesh(std::span<const Vertex> vertices, std::span<const u32> indices) {
     m_index_count = static_cast<u32>(indices.size());
 
     m_vao.bind();
 
-    m_vbo.set_data(std::span<const Vertex>(vertices));
-    m_ebo.set_data(std::span<const u32>(indices));
+    m_vbo.set_data(vertices);
+    m_ebo.set_data(indices);
 
     // Position attribute (location 0)
     gl::set_vertex_attrib({.index = 0,
@@ -8,6 +8,7 @@
 #include "engine/core/types.hpp"
 #include "opengl/buffer.hpp"
 
+#include <span>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -61,6 +62,11 @@ struct Vertex {
 class Mesh {
 public:
     Mesh(std::vector<Vertex> vertices, std::vector<u32> indices);
+
+    /**
+     * @brief Upload vertices and indices that live elsewhere, e.g. in a mapped file
+     */
+    Mesh(std::span<const Vertex> vertices, std::span<const u32> indices);
     ~Mesh() = default;
 
     HZ_NON_COPYABLE(Mesh);
@@ -0,0 +1,129 @@
+#include "gpu_timer.hpp"
+
+#include "engine/core/log.hpp"
+
+namespace hz::gl {
+
+GpuTimer::GpuTimer(u32 pass_count) : m_passes(pass_count), m_supported(detect_support()) {
+    if (!m_supported) {
+        return;
+    }
+
+    for (Pass& pass : m_passes) {
+        glGenQueries(static_cast<GLsizei>(FRAME_LATENCY), pass.queries.data());
+    }
+}
+
+GpuTimer::~GpuTimer() noexcept {
+    if (!m_supported) {
+        return;
+    }
+
+    if (m_open_pass < m_passes.size()) {
+        glEndQuery(GL_TIME_ELAPSED);
+    }
+    for (Pass& pass : m_passes) {
+        glDeleteQueries(static_cast<GLsizei>(FRAME_LATENCY), pass.queries.data());
+    }
+}
+
+bool GpuTimer::is_software_renderer(std::string_view renderer) {
+    constexpr std::string_view SOFTWARE_RENDERERS[] = {"llvmpipe", "softpipe", "swrast",
+                                                       "Software Rasterizer", "SwiftShader"};
+    for (std::string_view name : SOFTWARE_RENDERERS) {
+        if (renderer.find(name) != std::string_view::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GpuTimer::detect_support() {
+    if (!glGetString || !glGenQueries || !glDeleteQueries || !glBeginQuery || !glEndQuery ||
+        !glGetQueryiv || !glGetQueryObjectiv || !glGetQueryObjectui64v) {
+        return false;
+    }
+    if (GLVersion.major < 3 || (GLVersion.major == 3 && GLVersion.minor < 3)) {
+        HZ_ENGINE_INFO("GPU timers disabled: OpenGL {}.{} has no timer queries", GLVersion.major,
+                       GLVersion.minor);
+        return false;
+    }
+
+    const auto* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    if (renderer && is_software_renderer(renderer)) {
+        HZ_ENGINE_INFO("GPU timers disabled: software renderer ({})", renderer);
+        return false;
+    }
+
+    GLint counter_bits = 0;
+    glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &counter_bits);
+    if (counter_bits == 0) {
+        HZ_ENGINE_INFO("GPU timers disabled: timer queries have no counter bits");
+        return false;
+    }
+    return true;
+}
+
+void GpuTimer::begin(u32 pass) {
+    Pass& p = m_passes[pass];
+    p.begun_frame = m_frame;
+    if (!m_supported || m_open_pass < m_passes.size()) {
+        return;
+    }
+
+    const u32 slot = m_frame % FRAME_LATENCY;
+    if (p.pending[slot]) {
+        // GPU is FRAME_LATENCY frames behind; skip rather than stall
+        return;
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, p.queries[slot]);
+    m_open_pass = pass;
+}
+
+void GpuTimer::end(u32 pass) {
+    if (m_open_pass != pass) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    m_passes[pass].pending[m_frame % FRAME_LATENCY] = true;
+    m_open_pass = ~0u;
+}
+
+void GpuTimer::end_frame() {
+    // Oldest slot first so elapsed_ms ends up holding the newest result
+    for (Pass& pass : m_passes) {
+        const bool active = pass.begun_frame == m_frame;
+        if (!active) {
+            pass.elapsed_ms = 0.0f;
+        }
+        if (!m_supported) {
+            continue;
+        }
+
+        for (u32 age = FRAME_LATENCY; age > 0; --age) {
+            const u32 slot = (m_frame + FRAME_LATENCY + 1 - age) % FRAME_LATENCY;
+            if (!pass.pending[slot]) {
+                continue;
+            }
+
+            GLint available = 0;
+            glGetQueryObjectiv(pass.queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                continue;
+            }
+
+            GLuint64 elapsed_ns = 0;
+            glGetQueryObjectui64v(pass.queries[slot], GL_QUERY_RESULT, &elapsed_ns);
+            if (active) {
+                pass.elapsed_ms = static_cast<f32>(static_cast<f64>(elapsed_ns) * 1e-6);
+            }
+            pass.pending[slot] = false;
+        }
+    }
+
+    ++m_frame;
+}
+
+} // namespace hz::gl
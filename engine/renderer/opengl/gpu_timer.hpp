@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file gpu_timer.hpp
+ * @brief Non-blocking GPU pass timing with GL_TIME_ELAPSED queries
+ */
+
+#include "engine/core/types.hpp"
+#include "gl_context.hpp"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+namespace hz::gl {
+
+/**
+ * @brief Ring of timer queries per pass, read back a few frames late
+ *
+ * Each pass owns FRAME_LATENCY queries. begin()/end() record into the
+ * current frame's query and end_frame() collects every query whose result is
+ * already available, so the CPU never waits on the GPU. If the GPU falls more
+ * than FRAME_LATENCY frames behind, the pass is simply not timed that frame.
+ *
+ * A pass that is not begun in a frame (SSR or TAA switched off, say) reads 0
+ * and is inactive from that frame's end_frame() on, instead of repeating its
+ * last result. Timer queries cannot nest: only one pass may be open at a time.
+ *
+ * Without timer query support (no context, GL < 3.3, zero counter bits) or on
+ * a software rasterizer, every call is a no-op and elapsed_ms() returns 0.
+ */
+class GpuTimer {
+public:
+    static constexpr u32 FRAME_LATENCY = 4;
+
+    /**
+     * @brief Create queries for pass_count passes (requires a current context)
+     */
+    explicit GpuTimer(u32 pass_count);
+    ~GpuTimer() noexcept;
+
+    HZ_NON_COPYABLE(GpuTimer);
+    HZ_NON_MOVABLE(GpuTimer);
+
+    void begin(u32 pass);
+    void end(u32 pass);
+
+    /**
+     * @brief Collect finished queries and advance to the next frame
+     */
+    void end_frame();
+
+    /**
+     * @brief Most recent GPU time of a pass in milliseconds (0 until available)
+     */
+    [[nodiscard]] f32 elapsed_ms(u32 pass) const { return m_passes[pass].elapsed_ms; }
+
+    /**
+     * @brief True if the pass was begun in the frame most recently ended
+     */
+    [[nodiscard]] bool is_active(u32 pass) const {
+        return m_frame > 0 && m_passes[pass].begun_frame == m_frame - 1;
+    }
+
+    [[nodiscard]] bool is_supported() const noexcept { return m_supported; }
+    [[nodiscard]] u32 pass_count() const noexcept { return static_cast<u32>(m_passes.size()); }
+
+    /**
+     * @brief Check a GL_RENDERER string for a software rasterizer (llvmpipe, softpipe, ...)
+     */
+    [[nodiscard]] static bool is_software_renderer(std::string_view renderer);
+
+private:
+    struct Pass {
+        std::array<GLuint, FRAME_LATENCY> queries{};
+        std::array<bool, FRAME_LATENCY> pending{};
+        f32 elapsed_ms{0.0f};
+        u32 begun_frame{~0u};
+    };
+
+    [[nodiscard]] static bool detect_support();
+
+    std::vector<Pass> m_passes;
+    u32 m_frame{0};
+    u32 m_open_pass{~0u};
+    bool m_supported{false};
+};
+
+} // namespace hz::gl
@@ -83,6 +83,12 @@ void ParticleEmitter::create_quad_mesh() {
         glDeleteBuffers(1, &m_instance_vbo);
     }
 
+    // No GL loaded (headless runs, benchmarks): simulate without GPU buffers
+    if (!glGenVertexArrays) {
+        m_vao = m_quad_vbo = m_instance_vbo = 0;
+        return;
+    }
+
     // Quad vertices (position + texcoord)
     float quad_vertices[] = {
         // Position        // TexCoord
@@ -199,7 +205,7 @@ void ParticleEmitter::update(float dt) {
     }
     
     // Upload instance data to GPU
-    if (m_active_count > 0) {
+    if (m_active_count > 0 && m_instance_vbo) {
         upload_instance_data();
     }
 }
@@ -14,8 +14,26 @@
 #include "engine/renderer/opengl/shader.hpp"
 #include "engine/scene/components.hpp"
 
+#include <initializer_list>
+
 namespace hz {
 
+/**
+ * @brief Bind a material's texture if it is resident
+ *
+ * Streamed textures that are still loading are not bound; the shader then
+ * uses the material's constant value in their place.
+ *
+ * @return true if the texture was bound
+ */
+inline bool bind_material_texture(TextureHandle handle, u32 unit, AssetRegistry& registry) {
+    if (!handle.is_valid() || registry.texture_state(handle) != AssetState::Resident) {
+        return false;
+    }
+    registry.get_texture(handle)->bind(unit);
+    return true;
+}
+
 /**
  * @brief Apply a material's properties to a PBR shader
  *
@@ -35,49 +53,35 @@ inline void apply_material(gl::Shader& shader, const Material& material, AssetRe
     shader.set_float("u_uv_scale", material.uv_scale);
 
     // Bind textures and set usage flags
-    if (material.has_albedo_tex()) {
-        if (auto* tex = registry.get_texture(material.albedo_tex)) {
-            tex->bind(0);
-            shader.set_bool("u_use_textures", true);
-        }
-    } else {
-        shader.set_bool("u_use_textures", false);
-    }
-
-    if (material.has_normal_tex()) {
-        if (auto* tex = registry.get_texture(material.normal_tex)) {
-            tex->bind(1);
-            shader.set_bool("u_use_normal_map", true);
-        }
-    } else {
-        shader.set_bool("u_use_normal_map", false);
-    }
-
-    if (material.has_metallic_tex()) {
-        if (auto* tex = registry.get_texture(material.metallic_tex)) {
-            tex->bind(2);
-            shader.set_bool("u_use_metallic_map", true);
-        }
-    } else {
-        shader.set_bool("u_use_metallic_map", false);
-    }
-
-    if (material.has_roughness_tex()) {
-        if (auto* tex = registry.get_texture(material.roughness_tex)) {
-            tex->bind(3);
-            shader.set_bool("u_use_roughness_map", true);
-        }
-    } else {
-        shader.set_bool("u_use_roughness_map", false);
-    }
+    shader.set_bool("u_use_textures", bind_material_texture(material.albedo_tex, 0, registry));
+    shader.set_bool("u_use_normal_map", bind_material_texture(material.normal_tex, 1, registry));
+    shader.set_bool("u_use_metallic_map",
+                    bind_material_texture(material.metallic_tex, 2, registry));
+    shader.set_bool("u_use_roughness_map",
+                    bind_material_texture(material.roughness_tex, 3, registry));
+    shader.set_bool("u_use_ao_map", bind_material_texture(material.ao_tex, 4, registry));
+}
 
-    if (material.has_ao_tex()) {
-        if (auto* tex = registry.get_texture(material.ao_tex)) {
-            tex->bind(4);
-            shader.set_bool("u_use_ao_map", true);
+/**
+ * @brief Request the mip levels a material's textures need this frame
+ *
+ * Call for each drawn object before AssetRegistry::update_streaming(). Only
+ * residency-managed textures are affected.
+ *
+ * @param screen_pixels Size the object covers on screen, e.g. from
+ *        TextureResidency::projected_size() of its bounding sphere
+ */
+inline void request_material_textures(const Material& material, f32 screen_pixels,
+                                      AssetRegistry& registry) {
+    // A texture tiled uv_scale times covers 1 / uv_scale of the object
+    const f32 texture_pixels =
+        material.uv_scale > 0.0f ? screen_pixels / material.uv_scale : screen_pixels;
+    for (const TextureHandle handle : {material.albedo_tex, material.normal_tex,
+                                       material.metallic_tex, material.roughness_tex,
+                                       material.ao_tex}) {
+        if (handle.is_valid()) {
+            registry.request_texture_size(handle, texture_pixels);
         }
-    } else {
-        shader.set_bool("u_use_ao_map", false);
     }
 }
 
@@ -0,0 +1,117 @@
+#include "command_buffer.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace hz {
+
+// ============================================================================
+// CommandList Implementation
+// ============================================================================
+
+CommandList::CommandList(u32 index)
+    : m_index(index)
+    , m_arena(VirtualArenaConfig{.reserve_size = COMMAND_ARENA_RESERVE, .initial_commit = 0}) {}
+
+void CommandList::release_payloads() noexcept {
+    for (const CommandRecord& record : m_records) {
+        if (record.payload && record.ops->destroy) {
+            record.ops->destroy(record.payload);
+        }
+    }
+    m_records.clear();
+    m_created = 0;
+    m_arena.reset();
+}
+
+// ============================================================================
+// CommandBuffer Implementation
+// ============================================================================
+
+void CommandBuffer::reserve_lists(usize count) {
+    while (m_lists.size() < count) {
+        m_lists.push_back(CommandList(static_cast<u32>(m_lists.size())));
+    }
+}
+
+usize CommandBuffer::size() const noexcept {
+    usize total = 0;
+    for (const CommandList& list : m_lists) {
+        total += list.size();
+    }
+    return total;
+}
+
+bool CommandBuffer::empty() const noexcept {
+    for (const CommandList& list : m_lists) {
+        if (!list.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CommandBuffer::flush(entt::registry& registry) {
+    // Create every pending entity first so commands can refer to any of them
+    m_created.resize(m_lists.size());
+    for (usize i = 0; i < m_lists.size(); ++i) {
+        m_created[i].resize(m_lists[i].m_created);
+        registry.create(m_created[i].begin(), m_created[i].end());
+    }
+
+    // Group by component type with destroys last. Sequence keeps recording
+    // order within a group without stable_sort's temporary buffer.
+    m_keys.clear();
+    u32 sequence = 0;
+    for (const CommandList& list : m_lists) {
+        for (const CommandRecord& record : list.m_records) {
+            m_keys.push_back({record.ops, sequence++, &record});
+        }
+    }
+    std::sort(m_keys.begin(), m_keys.end(), [](const SortKey& a, const SortKey& b) {
+        if ((a.ops == nullptr) != (b.ops == nullptr)) {
+            return b.ops == nullptr;
+        }
+        if (a.ops != b.ops) {
+            return std::less<>{}(a.ops, b.ops);
+        }
+        return a.sequence < b.sequence;
+    });
+    m_sorted.resize(m_keys.size());
+    std::transform(m_keys.begin(), m_keys.end(), m_sorted.begin(),
+                   [](const SortKey& key) { return key.record; });
+
+    usize begin = 0;
+    while (begin < m_sorted.size() && m_sorted[begin]->ops) {
+        const ComponentCommandOps* ops = m_sorted[begin]->ops;
+        usize end = begin + 1;
+        while (end < m_sorted.size() && m_sorted[end]->ops == ops) {
+            ++end;
+        }
+        ops->apply(registry, std::span(m_sorted).subspan(begin, end - begin), m_created);
+        begin = end;
+    }
+
+    for (usize i = begin; i < m_sorted.size(); ++i) {
+        const Entity entity = m_sorted[i]->resolve(m_created);
+        if (registry.valid(entity)) {
+            registry.destroy(entity);
+        }
+    }
+
+    clear();
+}
+
+void CommandBuffer::clear() {
+    for (CommandList& list : m_lists) {
+        list.release_payloads();
+    }
+    m_keys.clear();
+    m_sorted.clear();
+}
+
+CommandBuffer& command_buffer(entt::registry& registry) {
+    return registry.ctx().emplace<CommandBuffer>();
+}
+
+} // namespace hz
@@ -0,0 +1,274 @@
+#pragma once
+
+/**
+ * @file command_buffer.hpp
+ * @brief Deferred structural changes (create/destroy/emplace/remove) for a registry
+ *
+ * Systems that iterate a view must not create or destroy entities or add and
+ * remove components of the iterated types, and parallel systems may not touch
+ * the registry's structure at all. Instead they record commands into a
+ * CommandList, and the owner of the CommandBuffer applies every list at a sync
+ * point with flush().
+ *
+ * Every Scene owns one buffer, stored in its registry's context so that
+ * systems which only see an entt::registry can reach it via command_buffer().
+ */
+
+#include "engine/core/memory.hpp"
+#include "scene.hpp"
+
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hz {
+
+inline constexpr usize COMMAND_ARENA_RESERVE = 64 * 1024 * 1024; // Address space per list
+
+/**
+ * @brief Entity created by a command list; resolved to a real entity at flush
+ */
+struct PendingEntity {
+    u32 list{0};
+    u32 index{0};
+};
+
+/**
+ * @brief Entity argument of a recorded command: existing or pending
+ *
+ * Implicit on purpose, so commands accept either kind directly.
+ */
+struct EntityRef {
+    EntityRef(Entity existing) : entity(existing) {}
+    EntityRef(PendingEntity created) : pending(created), is_pending(true) {}
+
+    Entity entity{entt::null};
+    PendingEntity pending{};
+    bool is_pending{false};
+};
+
+/// Entities created at flush, indexed by [list][PendingEntity::index]
+using CreatedEntities = std::vector<std::vector<Entity>>;
+
+enum class CommandKind : u8 { Emplace, Remove, Destroy };
+
+struct ComponentCommandOps;
+
+/**
+ * @brief One recorded command; emplaced values live in the list's arena
+ */
+struct CommandRecord {
+    const ComponentCommandOps* ops{nullptr}; // Component type, nullptr for Destroy
+    void* payload{nullptr};                  // Emplaced value
+    EntityRef target;
+    CommandKind kind{CommandKind::Destroy};
+
+    [[nodiscard]] Entity resolve(const CreatedEntities& created) const {
+        return target.is_pending ? created[target.pending.list][target.pending.index]
+                                 : target.entity;
+    }
+};
+
+/**
+ * @brief Type-erased per-component functions, one static instance per type
+ */
+struct ComponentCommandOps {
+    /// Applies a run of Emplace/Remove records that all target this type
+    void (*apply)(entt::registry& registry, std::span<const CommandRecord* const> records,
+                  const CreatedEntities& created);
+    /// Destroys a payload after it was applied or dropped (nullptr if trivial)
+    void (*destroy)(void* payload) noexcept;
+};
+
+namespace detail {
+
+template <typename T>
+struct ComponentCommands {
+    static void apply(entt::registry& registry, std::span<const CommandRecord* const> records,
+                      const CreatedEntities& created) {
+        auto& storage = registry.storage<T>(); // Looked up once per batch
+        for (const CommandRecord* record : records) {
+            const Entity entity = record->resolve(created);
+            if (!registry.valid(entity)) {
+                continue;
+            }
+            if (record->kind == CommandKind::Remove) {
+                storage.remove(entity);
+            } else if constexpr (std::is_empty_v<T>) {
+                if (!storage.contains(entity)) {
+                    storage.emplace(entity);
+                }
+            } else {
+                T& value = *static_cast<T*>(record->payload);
+                if (storage.contains(entity)) {
+                    storage.patch(entity, [&value](T& current) { current = std::move(value); });
+                } else {
+                    storage.emplace(entity, std::move(value));
+                }
+            }
+        }
+    }
+
+    static void destroy(void* payload) noexcept { static_cast<T*>(payload)->~T(); }
+
+    static constexpr ComponentCommandOps OPS{
+        &apply, std::is_trivially_destructible_v<T> ? nullptr : &destroy};
+};
+
+} // namespace detail
+
+// ============================================================================
+// Command List
+// ============================================================================
+
+/**
+ * @brief Single-threaded recorder of structural commands
+ *
+ * Each thread (or parallel_each chunk) records into its own list, so
+ * recording takes no locks. Emplaced values are constructed in the list's
+ * arena, which is reset after every flush.
+ */
+class CommandList {
+public:
+    ~CommandList() { release_payloads(); }
+
+    HZ_NON_COPYABLE(CommandList);
+    CommandList(CommandList&&) noexcept = default;
+    CommandList& operator=(CommandList&&) = delete;
+
+    /**
+     * @brief Create an entity at flush time
+     */
+    [[nodiscard]] PendingEntity create() { return {m_index, m_created++}; }
+
+    /**
+     * @brief Destroy an entity at flush time (ignored if it is already gone)
+     */
+    void destroy(Entity entity) {
+        m_records.push_back({nullptr, nullptr, entity, CommandKind::Destroy});
+    }
+
+    /**
+     * @brief Add or replace a component at flush time
+     */
+    template <typename T, typename... Args>
+    void emplace(EntityRef target, Args&&... args) {
+        void* payload = m_arena.allocate(sizeof(T), alignof(T));
+        if constexpr (std::is_aggregate_v<T>) {
+            ::new (payload) T{std::forward<Args>(args)...};
+        } else {
+            ::new (payload) T(std::forward<Args>(args)...);
+        }
+        m_records.push_back(
+            {&detail::ComponentCommands<T>::OPS, payload, target, CommandKind::Emplace});
+    }
+
+    /**
+     * @brief Remove a component at flush time (no-op if absent)
+     */
+    template <typename T>
+    void remove(EntityRef target) {
+        m_records.push_back(
+            {&detail::ComponentCommands<T>::OPS, nullptr, target, CommandKind::Remove});
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_records.empty() && m_created == 0; }
+    [[nodiscard]] usize size() const noexcept { return m_records.size(); }
+
+    /**
+     * @brief Arena bytes used by emplaced values since the last flush
+     */
+    [[nodiscard]] usize payload_bytes() const noexcept { return m_arena.used(); }
+
+private:
+    friend class CommandBuffer;
+
+    explicit CommandList(u32 index);
+
+    void release_payloads() noexcept;
+
+    u32 m_index;
+    u32 m_created{0};
+    std::vector<CommandRecord> m_records; // Capacity is kept between flushes
+    LinearArena m_arena;
+};
+
+// ============================================================================
+// Command Buffer
+// ============================================================================
+
+/**
+ * @brief A set of command lists applied together
+ *
+ * flush() creates pending entities, then applies commands grouped by
+ * component type so each pool is looked up once and touched in one batch,
+ * and destroys entities last. Commands on the same component type keep their
+ * order: list by list, then in recording order. parallel_each records chunk i
+ * into list i, so the result does not depend on which worker ran which chunk.
+ */
+class CommandBuffer {
+public:
+    CommandBuffer() = default;
+
+    HZ_NON_COPYABLE(CommandBuffer);
+    HZ_DEFAULT_MOVABLE(CommandBuffer);
+
+    /**
+     * @brief Ensure at least count lists exist (not thread-safe)
+     */
+    void reserve_lists(usize count);
+
+    /**
+     * @brief Get a list; list(0) is the one for single-threaded recording
+     *
+     * Grows the buffer if needed, so threads must only ask for lists that
+     * reserve_lists() already created.
+     */
+    [[nodiscard]] CommandList& list(usize index = 0) {
+        reserve_lists(index + 1);
+        return m_lists[index];
+    }
+
+    [[nodiscard]] usize list_count() const noexcept { return m_lists.size(); }
+
+    /**
+     * @brief Number of recorded commands across all lists
+     */
+    [[nodiscard]] usize size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief Apply and clear every list (call with no view iteration in progress)
+     */
+    void flush(entt::registry& registry);
+
+    /**
+     * @brief Drop every recorded command without applying it
+     */
+    void clear();
+
+private:
+    struct SortKey {
+        const ComponentCommandOps* ops;
+        u32 sequence;
+        const CommandRecord* record;
+    };
+
+    std::vector<CommandList> m_lists;
+
+    // Scratch reused between flushes
+    CreatedEntities m_created;
+    std::vector<SortKey> m_keys;
+    std::vector<const CommandRecord*> m_sorted;
+};
+
+/**
+ * @brief The command buffer stored in a registry's context (created on first use)
+ *
+ * Creating it is not thread-safe; Scene creates its buffer up front.
+ */
+[[nodiscard]] CommandBuffer& command_buffer(entt::registry& registry);
+
+} // namespace hz
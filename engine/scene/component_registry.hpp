@@ -0,0 +1,28 @@
+#pragma once
+
+/**
+ * @file component_registry.hpp
+ * @brief Components that scenes save and load
+ *
+ * SceneSerializer generates JSON and binary serialization for every type in
+ * SerializedComponents from its Reflect<T> descriptor. To make a component
+ * persistent, reflect it next to its definition and add it here. Components
+ * that only hold runtime state (projectiles in flight, grabs, character
+ * controllers, animation playback) are left out.
+ */
+
+#include "engine/physics/hitbox_system.hpp"
+#include "engine/physics/physics_interactions.hpp"
+#include "engine/scene/components.hpp"
+#include "engine/scene/reflection.hpp"
+#include "engine/scene/world_transform.hpp"
+
+namespace hz {
+
+using SerializedComponents =
+    TypeList<TagComponent, TransformComponent, HierarchyComponent, MeshComponent, LightComponent,
+             CameraComponent, RigidBodyComponent, BoxColliderComponent, CapsuleColliderComponent,
+             LifetimeComponent, IKTargetComponent, HitboxComponent, HurtboxComponent,
+             DestructibleComponent, PhysicsPropComponent, MaterialComponent>;
+
+} // namespace hz
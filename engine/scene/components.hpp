@@ -2,11 +2,12 @@
 
 #include "engine/assets/asset_handle.hpp"
 #include "engine/core/types.hpp"
+#include "engine/scene/reflection.hpp"
 
+#include <memory>
 #include <string>
 
 #include <glm/glm.hpp>
-#include <nlohmann/json.hpp>
 
 namespace hz {
 
@@ -15,12 +16,12 @@ namespace hz {
 // ==========================================
 struct TagComponent {
     std::string tag{"Entity"};
+};
 
-    // Serialization
-    friend void to_json(nlohmann::json& j, const TagComponent& c) {
-        j = nlohmann::json{{"tag", c.tag}};
-    }
-    friend void from_json(const nlohmann::json& j, TagComponent& c) { j.at("tag").get_to(c.tag); }
+template <>
+struct Reflect<TagComponent> {
+    static constexpr std::string_view name = "TagComponent";
+    static constexpr auto fields = std::tuple{field("tag", &TagComponent::tag)};
 };
 
 // ==========================================
@@ -32,21 +33,14 @@ struct TransformComponent {
     glm::vec3 scale{1.0f};
 
     [[nodiscard]] glm::mat4 get_transform() const;
+};
 
-    // Helper for glm::vec3 serialization
-    static nlohmann::json vec3_to_json(const glm::vec3& v) { return {v.x, v.y, v.z}; }
-    static glm::vec3 vec3_from_json(const nlohmann::json& j) { return {j[0], j[1], j[2]}; }
-
-    friend void to_json(nlohmann::json& j, const TransformComponent& c) {
-        j = nlohmann::json{{"position", vec3_to_json(c.position)},
-                           {"rotation", vec3_to_json(c.rotation)},
-                           {"scale", vec3_to_json(c.scale)}};
-    }
-    friend void from_json(const nlohmann::json& j, TransformComponent& c) {
-        c.position = vec3_from_json(j.at("position"));
-        c.rotation = vec3_from_json(j.at("rotation"));
-        c.scale = vec3_from_json(j.at("scale"));
-    }
+template <>
+struct Reflect<TransformComponent> {
+    static constexpr std::string_view name = "TransformComponent";
+    static constexpr auto fields = std::tuple{field("position", &TransformComponent::position),
+                                              field("rotation", &TransformComponent::rotation),
+                                              field("scale", &TransformComponent::scale)};
 };
 
 // ==========================================
@@ -91,52 +85,33 @@ struct MeshComponent {
     glm::vec3 albedo_color{1.0f};
     float metallic{0.0f};
     float roughness{0.5f};
+};
 
-    // ==========================================================================
-    // Serialization
-    // ==========================================================================
-    friend void to_json(nlohmann::json& j, const MeshComponent& c) {
-        j = nlohmann::json{{"mesh_type", static_cast<int>(c.mesh_type)},
-                           {"primitive_name", c.primitive_name},
-                           {"model_index", c.model.index},
-                           {"model_generation", c.model.generation},
-                           {"material_index", c.material.index},
-                           {"material_generation", c.material.generation},
-                           // Legacy fields
-                           {"mesh_path", c.mesh_path},
-                           {"albedo_path", c.albedo_path},
-                           {"normal_path", c.normal_path},
-                           {"metallic_path", c.metallic_path},
-                           {"roughness_path", c.roughness_path},
-                           {"ao_path", c.ao_path},
-                           {"albedo_color", TransformComponent::vec3_to_json(c.albedo_color)},
-                           {"metallic", c.metallic},
-                           {"roughness", c.roughness}};
-    }
-
-    friend void from_json(const nlohmann::json& j, MeshComponent& c) {
-        // New fields
-        c.mesh_type = static_cast<MeshType>(j.value("mesh_type", 0));
-        c.primitive_name = j.value("primitive_name", "cube");
-        c.model.index = j.value("model_index", 0u);
-        c.model.generation = j.value("model_generation", 0u);
-        c.material.index = j.value("material_index", 0u);
-        c.material.generation = j.value("material_generation", 0u);
-
+template <>
+struct Reflect<MeshComponent> {
+    using M = MeshComponent;
+
+    static constexpr std::string_view name = "MeshComponent";
+    static constexpr auto fields = std::tuple{
+        field("mesh_type", &M::mesh_type),
+        field("primitive_name", &M::primitive_name),
+        field("model_index", &M::model, &ModelHandle::index),
+        field("model_generation", &M::model, &ModelHandle::generation),
+        field("material_index", &M::material, &MaterialHandle::index),
+        field("material_generation", &M::material, &MaterialHandle::generation),
         // Legacy fields
-        c.mesh_path = j.value("mesh_path", "cube");
-        c.albedo_path = j.value("albedo_path", "");
-        c.normal_path = j.value("normal_path", "");
-        c.metallic_path = j.value("metallic_path", "");
-        c.roughness_path = j.value("roughness_path", "");
-        c.ao_path = j.value("ao_path", "");
-
-        if (j.contains("albedo_color"))
-            c.albedo_color = TransformComponent::vec3_from_json(j["albedo_color"]);
-        c.metallic = j.value("metallic", 0.0f);
-        c.roughness = j.value("roughness", 0.5f);
-
-        // Migration: if mesh_path is set but primitive_name isn't, use mesh_path
+        field("mesh_path", &M::mesh_path),
+        field("albedo_path", &M::albedo_path),
+        field("normal_path", &M::normal_path),
+        field("metallic_path", &M::metallic_path),
+        field("roughness_path", &M::roughness_path),
+        field("ao_path", &M::ao_path),
+        field("albedo_color", &M::albedo_color),
+        field("metallic", &M::metallic),
+        field("roughness", &M::roughness)};
+
+    // Migration: if mesh_path is set but primitive_name isn't, use mesh_path
+    static void after_load(MeshComponent& c) {
         if (c.primitive_name == "cube" && c.mesh_path != "cube") {
             c.primitive_name = c.mesh_path;
         }
@@ -153,21 +128,15 @@ struct LightComponent {
     glm::vec3 color{1.0f};
     float intensity{1.0f};
     float range{10.0f}; // For point lights
+};
 
-    // Serialization
-    friend void to_json(nlohmann::json& j, const LightComponent& c) {
-        j = nlohmann::json{{"type", static_cast<int>(c.type)},
-                           {"color", TransformComponent::vec3_to_json(c.color)},
-                           {"intensity", c.intensity},
-                           {"range", c.range}};
-    }
-    friend void from_json(const nlohmann::json& j, LightComponent& c) {
-        c.type = static_cast<LightType>(j.value("type", 1));
-        if (j.contains("color"))
-            c.color = TransformComponent::vec3_from_json(j["color"]);
-        c.intensity = j.value("intensity", 1.0f);
-        c.range = j.value("range", 10.0f);
-    }
+template <>
+struct Reflect<LightComponent> {
+    static constexpr std::string_view name = "LightComponent";
+    static constexpr auto fields = std::tuple{field("type", &LightComponent::type),
+                                              field("color", &LightComponent::color),
+                                              field("intensity", &LightComponent::intensity),
+                                              field("range", &LightComponent::range)};
 };
 
 // ==========================================
@@ -178,20 +147,15 @@ struct CameraComponent {
     float near_plane{0.1f};
     float far_plane{1000.0f};
     bool primary{true};
+};
 
-    // Serialization
-    friend void to_json(nlohmann::json& j, const CameraComponent& c) {
-        j = nlohmann::json{{"fov", c.fov},
-                           {"near_plane", c.near_plane},
-                           {"far_plane", c.far_plane},
-                           {"primary", c.primary}};
-    }
-    friend void from_json(const nlohmann::json& j, CameraComponent& c) {
-        c.fov = j.value("fov", 45.0f);
-        c.near_plane = j.value("near_plane", 0.1f);
-        c.far_plane = j.value("far_plane", 1000.0f);
-        c.primary = j.value("primary", true);
-    }
+template <>
+struct Reflect<CameraComponent> {
+    static constexpr std::string_view name = "CameraComponent";
+    static constexpr auto fields = std::tuple{field("fov", &CameraComponent::fov),
+                                              field("near_plane", &CameraComponent::near_plane),
+                                              field("far_plane", &CameraComponent::far_plane),
+                                              field("primary", &CameraComponent::primary)};
 };
 
 // ==========================================
@@ -229,58 +193,56 @@ struct RigidBodyComponent {
     void set_body_id(T* body_id) {
         runtime_body.reset(body_id);
     }
+};
 
-    // Serialization
-    friend void to_json(nlohmann::json& j, const RigidBodyComponent& c) {
-        j = nlohmann::json{{"type", static_cast<int>(c.type)},
-                           {"mass", c.mass},
-                           {"fixed_rotation", c.fixed_rotation}};
-    }
-    friend void from_json(const nlohmann::json& j, RigidBodyComponent& c) {
-        c.type = static_cast<BodyType>(j.value("type", 0));
-        c.mass = j.value("mass", 1.0f);
-        c.fixed_rotation = j.value("fixed_rotation", false);
-    }
+template <>
+struct Reflect<RigidBodyComponent> {
+    static constexpr std::string_view name = "RigidBodyComponent";
+    static constexpr auto fields =
+        std::tuple{field("type", &RigidBodyComponent::type),
+                   field("mass", &RigidBodyComponent::mass),
+                   field("fixed_rotation", &RigidBodyComponent::fixed_rotation)};
 };
 
 struct BoxColliderComponent {
     glm::vec3 half_extents{0.5f};
     glm::vec3 offset{0.0f};
+};
 
-    friend void to_json(nlohmann::json& j, const BoxColliderComponent& c) {
-        j = nlohmann::json{{"half_extents", TransformComponent::vec3_to_json(c.half_extents)},
-                           {"offset", TransformComponent::vec3_to_json(c.offset)}};
-    }
-    friend void from_json(const nlohmann::json& j, BoxColliderComponent& c) {
-        if (j.contains("half_extents"))
-            c.half_extents = TransformComponent::vec3_from_json(j["half_extents"]);
-        if (j.contains("offset"))
-            c.offset = TransformComponent::vec3_from_json(j["offset"]);
-    }
+template <>
+struct Reflect<BoxColliderComponent> {
+    static constexpr std::string_view name = "BoxColliderComponent";
+    static constexpr auto fields =
+        std::tuple{field("half_extents", &BoxColliderComponent::half_extents),
+                   field("offset", &BoxColliderComponent::offset)};
 };
 
 struct CapsuleColliderComponent {
     float radius{0.5f};
     float half_height{0.5f}; // Cylinder half-height. Total height = 2*half_height + 2*radius
     glm::vec3 offset{0.0f};
+};
 
-    friend void to_json(nlohmann::json& j, const CapsuleColliderComponent& c) {
-        j = nlohmann::json{{"radius", c.radius},
-                           {"half_height", c.half_height},
-                           {"offset", TransformComponent::vec3_to_json(c.offset)}};
-    }
-    friend void from_json(const nlohmann::json& j, CapsuleColliderComponent& c) {
-        c.radius = j.value("radius", 0.5f);
-        c.half_height = j.value("half_height", 0.5f);
-        if (j.contains("offset"))
-            c.offset = TransformComponent::vec3_from_json(j["offset"]);
-    }
+template <>
+struct Reflect<CapsuleColliderComponent> {
+    static constexpr std::string_view name = "CapsuleColliderComponent";
+    static constexpr auto fields =
+        std::tuple{field("radius", &CapsuleColliderComponent::radius),
+                   field("half_height", &CapsuleColliderComponent::half_height),
+                   field("offset", &CapsuleColliderComponent::offset)};
 };
 
 struct LifetimeComponent {
     float time_remaining{1.0f};
 };
 
+template <>
+struct Reflect<LifetimeComponent> {
+    static constexpr std::string_view name = "LifetimeComponent";
+    static constexpr auto fields =
+        std::tuple{field("time_remaining", &LifetimeComponent::time_remaining)};
+};
+
 // ==========================================
 // IK Component
 // ==========================================
@@ -303,4 +265,18 @@ struct IKTargetComponent {
     bool enabled{true};
 };
 
+template <>
+struct Reflect<IKTargetComponent> {
+    using C = IKTargetComponent;
+
+    static constexpr std::string_view name = "IKTargetComponent";
+    static constexpr auto fields = std::tuple{field("root_bone_id", &C::root_bone_id),
+                                              field("mid_bone_id", &C::mid_bone_id),
+                                              field("end_bone_id", &C::end_bone_id),
+                                              field("target_position", &C::target_position),
+                                              field("pole_vector", &C::pole_vector),
+                                              field("weight", &C::weight),
+                                              field("enabled", &C::enabled)};
+};
+
 } // namespace hz
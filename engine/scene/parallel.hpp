@@ -0,0 +1,107 @@
+#pragma once
+
+/**
+ * @file parallel.hpp
+ * @brief Run a callback over an EnTT view on the job system
+ *
+ * The view's leading storage (its smallest pool) is split into index ranges
+ * and each range runs as a job; entities the view filters out are skipped.
+ * Callbacks may read and write the components they are given and anything
+ * else that is not shared between entities. They must not change the
+ * registry's structure; the CommandBuffer overload hands every chunk its own
+ * CommandList for that, applied in chunk order by the caller's flush().
+ *
+ * @code
+ * parallel_each(registry.view<LifetimeComponent>(), commands,
+ *               [dt](CommandList& cmd, Entity entity, LifetimeComponent& lifetime) {
+ *                   lifetime.time_remaining -= dt;
+ *                   if (lifetime.time_remaining <= 0.0f) {
+ *                       cmd.destroy(entity);
+ *                   }
+ *               });
+ * commands.flush(registry);
+ * @endcode
+ */
+
+#include "command_buffer.hpp"
+#include "engine/core/jobs.hpp"
+#include "scene.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+namespace hz {
+
+namespace detail {
+
+/**
+ * @brief Items per chunk when the caller passes 0 (same rule as JobSystem::parallel_for)
+ */
+[[nodiscard]] inline usize parallel_grain(usize count, usize grain) noexcept {
+    if (grain != 0) {
+        return grain;
+    }
+    return std::max<usize>(1, count / (4 * (static_cast<usize>(JobSystem::worker_count()) + 1)));
+}
+
+template <typename View, typename Fn>
+void each_in_range(View& view, usize begin, usize end, Fn& fn) {
+    const auto* storage = view.handle();
+    const Entity* entities = storage->data();
+    for (usize i = begin; i < end; ++i) {
+        const Entity entity = entities[i];
+        if (view.contains(entity)) {
+            std::apply([&](auto&... components) { fn(entity, components...); },
+                       view.get(entity));
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Call fn(entity, components&...) for every entity of a view, in parallel
+ *
+ * Same arguments as view.each(). Runs inline before JobSystem::init().
+ *
+ * @param grain Entities per chunk; 0 picks about four chunks per thread
+ */
+template <typename View, typename Fn>
+void parallel_each(View view, Fn&& fn, usize grain = 0) {
+    if (!view.handle()) {
+        return;
+    }
+    const usize count = view.handle()->size();
+    JobSystem::parallel_for(
+        count, [&](usize begin, usize end) { detail::each_in_range(view, begin, end, fn); },
+        detail::parallel_grain(count, grain));
+}
+
+/**
+ * @brief Call fn(CommandList&, entity, components&...) in parallel, deferring structural changes
+ *
+ * Chunk i records into commands.list(i). Nothing is applied until the caller
+ * flushes the buffer, after every chunk has finished.
+ */
+template <typename View, typename Fn>
+void parallel_each(View view, CommandBuffer& commands, Fn&& fn, usize grain = 0) {
+    if (!view.handle()) {
+        return;
+    }
+    const usize count = view.handle()->size();
+    grain = detail::parallel_grain(count, grain);
+    commands.reserve_lists((count + grain - 1) / grain);
+
+    JobSystem::parallel_for(
+        count,
+        [&](usize begin, usize end) {
+            CommandList& list = commands.list(begin / grain);
+            auto with_list = [&](Entity entity, auto&... components) {
+                fn(list, entity, components...);
+            };
+            detail::each_in_range(view, begin, end, with_list);
+        },
+        grain);
+}
+
+} // namespace hz
@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file reflection.hpp
+ * @brief Compile-time field descriptors for serialized types
+ *
+ * A type is reflected by specializing Reflect<T> next to its definition:
+ *
+ * @code
+ * template <>
+ * struct Reflect<BoxColliderComponent> {
+ *     static constexpr std::string_view name = "BoxColliderComponent";
+ *     static constexpr auto fields =
+ *         std::tuple{field("half_extents", &BoxColliderComponent::half_extents),
+ *                    field("offset", &BoxColliderComponent::offset)};
+ * };
+ * @endcode
+ *
+ * Members that are not listed are runtime state and are not saved. A field
+ * can follow a path of members (&MeshComponent::model, &ModelHandle::index) to
+ * flatten a nested value. Structs that only appear inside components need
+ * fields but no name. An optional static after_load(T&) runs on every loaded
+ * value, for migrations.
+ */
+
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace hz {
+
+template <typename T>
+struct Reflect;
+
+/**
+ * @brief A named member (or path of members) of a reflected type
+ */
+template <typename... Members>
+struct Field {
+    std::string_view name;
+    std::tuple<Members...> path;
+
+    template <typename Object>
+    [[nodiscard]] constexpr decltype(auto) get(Object& object) const {
+        return std::apply([&object](auto... members) -> decltype(auto) {
+            return (object .* ... .* members);
+        }, path);
+    }
+};
+
+template <typename... Members>
+[[nodiscard]] constexpr Field<Members...> field(std::string_view name, Members... path) {
+    return {name, {path...}};
+}
+
+template <typename T>
+concept Reflected = requires { Reflect<T>::fields; };
+
+template <typename T>
+concept ReflectedComponent = Reflected<T> && requires { Reflect<T>::name; };
+
+/**
+ * @brief Type of a field of Object, without references or cv-qualifiers
+ */
+template <typename Object, typename FieldType>
+using field_value_t = std::remove_cvref_t<decltype(
+    std::declval<const std::remove_cvref_t<FieldType>&>().get(std::declval<Object&>()))>;
+
+/**
+ * @brief Call fn(field) for every field of T, in declaration order
+ */
+template <Reflected T, typename Fn>
+constexpr void for_each_field(Fn&& fn) {
+    std::apply([&fn](const auto&... fields) { (fn(fields), ...); }, Reflect<T>::fields);
+}
+
+template <typename... Ts>
+struct TypeList {};
+
+/**
+ * @brief Call fn(std::type_identity<T>{}) for every T in the list, in order
+ */
+template <typename... Ts, typename Fn>
+constexpr void for_each_type(TypeList<Ts...> /*types*/, Fn&& fn) {
+    (fn(std::type_identity<Ts>{}), ...);
+}
+
+} // namespace hz
@@ -1,7 +1,35 @@
 #include "scene.hpp"
 
+#include "command_buffer.hpp"
+#include "world_transform.hpp"
+
 namespace hz {
 
-// Implementation details can go here if needed
+Scene::Scene() {
+    // Created up front: context lookups are not thread-safe on first use
+    (void)command_buffer(m_registry);
+    (void)hz::world_transforms(m_registry);
+}
+
+void Scene::clear() {
+    command_buffer(m_registry).clear();
+    m_registry.clear();
+}
+
+CommandBuffer& Scene::commands() {
+    return command_buffer(m_registry);
+}
+
+void Scene::flush_commands() {
+    command_buffer(m_registry).flush(m_registry);
+}
+
+const WorldTransformCache& Scene::world_transforms() const {
+    return m_registry.ctx().get<WorldTransformCache>();
+}
+
+void Scene::update_world_transforms() {
+    hz::world_transforms(m_registry).update(m_registry);
+}
 
 } // namespace hz
@@ -11,12 +11,15 @@ namespace hz {
  */
 using Entity = entt::entity;
 
+class CommandBuffer;
+class WorldTransformCache;
+
 /**
  * @brief Represents a game scene containing entities and components
  */
 class Scene {
 public:
-    Scene() = default;
+    Scene();
     ~Scene() = default;
 
     /**
@@ -38,7 +41,7 @@ public:
     /**
      * @brief Clear the scene
      */
-    void clear() { m_registry.clear(); }
+    void clear();
 
     /**
      * @brief Get active entity count
@@ -56,6 +59,28 @@ public:
      */
     bool is_valid(Entity entity) const { return m_registry.valid(entity); }
 
+    /**
+     * @brief Deferred structural changes, applied by flush_commands()
+     *
+     * Lives in the registry's context, so command_buffer(registry()) is the same buffer.
+     */
+    CommandBuffer& commands();
+
+    /**
+     * @brief Apply every recorded command (the frame's structural sync point)
+     */
+    void flush_commands();
+
+    /**
+     * @brief World matrices of every transform, as of the last update_world_transforms()
+     */
+    const WorldTransformCache& world_transforms() const;
+
+    /**
+     * @brief Recompute world matrices of changed transforms (once per frame, before rendering)
+     */
+    void update_world_transforms();
+
 private:
     entt::registry m_registry;
 };
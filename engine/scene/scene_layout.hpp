@@ -0,0 +1,181 @@
+#pragma once
+
+/**
+ * @file scene_layout.hpp
+ * @brief How binary scenes store a reflected component, and the hash that guards it
+ *
+ * A component is stored Raw (its bytes, copied straight from the mapped file)
+ * only when its reflected fields are exactly its bytes: distinct direct
+ * members, no bools, no gaps and no padding. Anything else is Packed field by
+ * field, so unreflected runtime state and padding never reach the file.
+ */
+
+#include "engine/core/types.hpp"
+#include "engine/scene/reflection.hpp"
+#include "engine/scene/scene.hpp"
+#include "engine/scene/scene_serializer.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace hz {
+
+namespace detail {
+
+// ============================================================================
+// Field Traits
+// ============================================================================
+
+template <typename T>
+struct is_vector : std::false_type {};
+template <typename T, typename Allocator>
+struct is_vector<std::vector<T, Allocator>> : std::true_type {};
+
+template <typename T>
+struct is_glm_vec : std::false_type {};
+template <glm::length_t L, typename T, glm::qualifier Q>
+struct is_glm_vec<glm::vec<L, T, Q>> : std::true_type {};
+
+/// Fixed-size values stored by their bytes
+template <typename T>
+constexpr bool is_plain_v = !std::is_same_v<T, Entity> &&
+                            (std::is_arithmetic_v<T> || std::is_enum_v<T> || is_glm_vec<T>::value);
+
+/**
+ * @brief True if the reflected fields of T cover every byte of T exactly once
+ *
+ * Each field must be a distinct direct member of a plain, non-bool type, and
+ * their sizes must add up to sizeof(T), which leaves no room for padding or
+ * unreflected members.
+ */
+template <typename T>
+constexpr bool fields_tile_object() {
+    if constexpr (!std::is_trivially_copyable_v<T> || !std::is_default_constructible_v<T> ||
+                  std::is_union_v<T>) {
+        return false;
+    } else {
+        bool tiles = true;
+        usize size = 0;
+        for_each_field<T>([&](const auto& field) {
+            using Value = field_value_t<T, decltype(field)>;
+            tiles = tiles && std::tuple_size_v<decltype(field.path)> == 1 &&
+                    is_plain_v<Value> && !std::is_same_v<Value, bool>;
+            size += sizeof(Value);
+            for_each_field<T>([&](const auto& other) {
+                if constexpr (std::is_same_v<decltype(field.path), decltype(other.path)>) {
+                    tiles = tiles && (&field == &other || field.path != other.path);
+                }
+            });
+        });
+        return tiles && size == sizeof(T);
+    }
+}
+
+// ============================================================================
+// Layout Hash
+// ============================================================================
+
+constexpr u32 fnv1a(std::string_view text, u32 hash = 2166136261u) {
+    for (const char c : text) {
+        hash = (hash ^ static_cast<u8>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+constexpr u32 fnv1a_value(u64 value, u32 hash) {
+    for (u32 i = 0; i < 8; ++i) {
+        hash = (hash ^ static_cast<u8>(value >> (i * 8))) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hash of field names, kinds and sizes; changes whenever the stored layout does
+ */
+template <typename T>
+constexpr u32 layout_hash(u32 hash) {
+    if constexpr (std::is_same_v<T, Entity>) {
+        return fnv1a("entity", hash);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return fnv1a("string", hash);
+    } else if constexpr (is_vector<T>::value) {
+        return layout_hash<typename T::value_type>(fnv1a("vector", hash));
+    } else if constexpr (Reflected<T>) {
+        hash = fnv1a("{", hash);
+        for_each_field<T>([&hash](const auto& field) {
+            hash = fnv1a(field.name, hash);
+            hash = layout_hash<field_value_t<T, decltype(field)>>(hash);
+        });
+        return fnv1a("}", hash);
+    } else {
+        static_assert(is_plain_v<T>, "Reflected field type cannot be serialized");
+        const std::string_view kind = std::is_floating_point_v<T> ? "f"
+                                      : std::is_enum_v<T>         ? "e"
+                                      : is_glm_vec<T>::value      ? "v"
+                                                                  : "i";
+        return fnv1a_value(sizeof(T), fnv1a(kind, hash));
+    }
+}
+
+/**
+ * @brief Byte offsets of the reflected fields of T, in field order, folded into hash
+ *
+ * Member pointers have no constant offset, so they are measured on a
+ * value-initialized object.
+ */
+template <typename T>
+u32 offset_hash(u32 hash) {
+    const T object{};
+    const auto* base = reinterpret_cast<const std::byte*>(std::addressof(object));
+    for_each_field<T>([&](const auto& field) {
+        const auto* member = reinterpret_cast<const std::byte*>(std::addressof(field.get(object)));
+        hash = fnv1a_value(static_cast<u64>(member - base), hash);
+    });
+    return hash;
+}
+
+} // namespace detail
+
+// ============================================================================
+// Component Identity
+// ============================================================================
+
+/// Stored whole and inserted straight from the mapped file
+template <typename T>
+constexpr bool is_raw_component_v = detail::fields_tile_object<T>();
+
+template <ReflectedComponent T>
+constexpr u32 component_id() {
+    return detail::fnv1a(Reflect<T>::name);
+}
+
+template <ReflectedComponent T>
+constexpr SceneChunkEncoding component_encoding() {
+    return is_raw_component_v<T> ? SceneChunkEncoding::Raw : SceneChunkEncoding::Packed;
+}
+
+/**
+ * @brief Hash stored with each chunk; a chunk is only loaded if it still matches
+ *
+ * Raw layouts also hash the size and the offset of every field, since their
+ * bytes are reinterpreted in place.
+ */
+template <ReflectedComponent T>
+u32 component_layout() {
+    if constexpr (is_raw_component_v<T>) {
+        static const u32 s_layout = detail::fnv1a_value(
+            sizeof(T), detail::offset_hash<T>(detail::layout_hash<T>(detail::fnv1a("raw"))));
+        return s_layout;
+    } else {
+        return detail::layout_hash<T>(detail::fnv1a("packed"));
+    }
+}
+
+} // namespace hz
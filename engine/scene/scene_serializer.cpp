@@ -1,55 +1,501 @@
 #include "scene_serializer.hpp"
 
-#include "components.hpp"
+#include "component_registry.hpp"
+#include "scene_layout.hpp"
+#include "engine/core/byte_stream.hpp"
 #include "engine/core/log.hpp"
+#include "engine/platform/mapped_file.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
-// Explicitly use the macros if they are not in namespace
-// (They usually are #define HZ_LOG_ERROR ...)
-
 namespace hz {
 
-SceneSerializer::SceneSerializer(Scene& scene) : m_scene(scene) {}
+namespace {
 
-void SceneSerializer::serialize(const std::filesystem::path& path) {
-    nlohmann::json root;
-    root["entities"] = nlohmann::json::array();
+static_assert(std::endian::native == std::endian::little, "Binary scenes are stored little-endian");
+static_assert(sizeof(SceneFileHeader) == 16 && sizeof(SceneChunk) == 40);
+
+constexpr usize BLOCK_ALIGNMENT = 16;
+constexpr u32 NULL_INDEX = ~0u; // Stored entity reference to entt::null
+
+// ============================================================================
+// Field Traits
+// ============================================================================
+
+using detail::is_glm_vec;
+using detail::is_plain_v;
+using detail::is_vector;
+
+template <typename T>
+constexpr bool has_entity_refs() {
+    if constexpr (std::is_same_v<T, Entity>) {
+        return true;
+    } else if constexpr (is_vector<T>::value) {
+        return has_entity_refs<typename T::value_type>();
+    } else if constexpr (Reflected<T>) {
+        bool found = false;
+        for_each_field<T>([&found](const auto& field) {
+            found = found || has_entity_refs<field_value_t<T, decltype(field)>>();
+        });
+        return found;
+    } else {
+        return false;
+    }
+}
+
+template <typename T>
+void after_load(T& value) {
+    if constexpr (requires { Reflect<T>::after_load(value); }) {
+        Reflect<T>::after_load(value);
+    }
+}
+
+/**
+ * @brief File index of every live entity, in storage order
+ */
+class EntityIndices {
+public:
+    explicit EntityIndices(entt::registry& registry) : m_registry(registry) {
+        registry.view<Entity>().each([this](Entity entity) {
+            const u32 slot = entt::to_entity(entity);
+            if (slot >= m_index_of.size()) {
+                m_index_of.resize(slot + 1, NULL_INDEX);
+            }
+            m_index_of[slot] = m_count++;
+        });
+    }
+
+    [[nodiscard]] u32 count() const noexcept { return m_count; }
+
+    /**
+     * @brief Index of an entity; references to destroyed entities are saved as null
+     */
+    [[nodiscard]] u32 operator()(Entity entity) const {
+        return m_registry.valid(entity) ? m_index_of[entt::to_entity(entity)] : NULL_INDEX;
+    }
+
+private:
+    const entt::registry& m_registry;
+    std::vector<u32> m_index_of; // Indexed by entt::to_entity()
+    u32 m_count{0};
+};
+
+// ============================================================================
+// JSON Codec
+// ============================================================================
+
+template <typename T>
+void write_json(nlohmann::json& json, const T& value, const EntityIndices& indices) {
+    if constexpr (std::is_same_v<T, Entity>) {
+        const u32 index = indices(value);
+        json = index == NULL_INDEX ? nlohmann::json(nullptr) : nlohmann::json(index);
+    } else if constexpr (std::is_enum_v<T>) {
+        json = static_cast<std::underlying_type_t<T>>(value);
+    } else if constexpr (is_glm_vec<T>::value) {
+        json = nlohmann::json::array();
+        for (glm::length_t i = 0; i < T::length(); ++i) {
+            json.push_back(value[i]);
+        }
+    } else if constexpr (is_vector<T>::value) {
+        json = nlohmann::json::array();
+        for (const auto& element : value) {
+            write_json(json.emplace_back(), element, indices);
+        }
+    } else if constexpr (Reflected<T>) {
+        json = nlohmann::json::object();
+        for_each_field<T>([&](const auto& field) {
+            write_json(json[field.name], field.get(value), indices);
+        });
+    } else {
+        json = value;
+    }
+}
+
+/// Missing fields keep their defaults, so older files still load
+template <typename T>
+void read_json(const nlohmann::json& json, T& value, std::span<const Entity> entities) {
+    if constexpr (std::is_same_v<T, Entity>) {
+        const u32 index = json.is_null() ? NULL_INDEX : json.get<u32>();
+        if (index < entities.size()) {
+            value = entities[index];
+        } else {
+            value = entt::null;
+        }
+    } else if constexpr (std::is_enum_v<T>) {
+        value = static_cast<T>(json.get<std::underlying_type_t<T>>());
+    } else if constexpr (is_glm_vec<T>::value) {
+        for (glm::length_t i = 0; i < T::length(); ++i) {
+            value[i] = json.at(static_cast<usize>(i)).get<typename T::value_type>();
+        }
+    } else if constexpr (is_vector<T>::value) {
+        value.clear();
+        value.reserve(json.size());
+        for (const auto& element : json) {
+            read_json(element, value.emplace_back(), entities);
+        }
+    } else if constexpr (Reflected<T>) {
+        for_each_field<T>([&](const auto& field) {
+            if (const auto it = json.find(field.name); it != json.end()) {
+                read_json(*it, field.get(value), entities);
+            }
+        });
+        after_load(value);
+    } else {
+        json.get_to(value);
+    }
+}
+
+using JsonLoader = void (*)(const nlohmann::json& json, entt::registry& registry, Entity entity,
+                            std::span<const Entity> entities);
+
+template <ReflectedComponent T>
+void load_json_component(const nlohmann::json& json, entt::registry& registry, Entity entity,
+                         std::span<const Entity> entities) {
+    T component{};
+    read_json(json, component, entities);
+    registry.emplace_or_replace<T>(entity, std::move(component));
+}
+
+const std::unordered_map<std::string_view, JsonLoader>& json_loaders() {
+    static const auto s_loaders = [] {
+        std::unordered_map<std::string_view, JsonLoader> loaders;
+        for_each_type(SerializedComponents{}, [&loaders]<typename T>(std::type_identity<T>) {
+            loaders.emplace(Reflect<T>::name, &load_json_component<T>);
+        });
+        return loaders;
+    }();
+    return s_loaders;
+}
+
+// ============================================================================
+// Binary Codec
+// ============================================================================
+
+template <typename T>
+void write_binary(ByteWriter& out, const T& value, const EntityIndices& indices) {
+    if constexpr (std::is_same_v<T, Entity>) {
+        out.write_value(indices(value));
+    } else if constexpr (std::is_same_v<T, bool>) {
+        out.write_value(static_cast<u8>(value));
+    } else if constexpr (is_plain_v<T>) {
+        out.write_value(value);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        out.write_value(static_cast<u32>(value.size()));
+        out.write(value.data(), value.size());
+    } else if constexpr (is_vector<T>::value) {
+        out.write_value(static_cast<u32>(value.size()));
+        for (const auto& element : value) {
+            write_binary(out, element, indices);
+        }
+    } else {
+        for_each_field<T>([&](const auto& field) { write_binary(out, field.get(value), indices); });
+    }
+}
 
-    auto view = m_scene.registry().view<hz::Entity>();
-    view.each([&](auto entity) {
-        nlohmann::json entity_json;
-        entity_json["id"] = static_cast<uint32_t>(entity); // For debugging
+/// Entity references are read as file indices; remap_entities() resolves them
+template <typename T>
+[[nodiscard]] bool read_binary(ByteReader& in, T& value, u32 entity_count) {
+    if constexpr (std::is_same_v<T, Entity>) {
+        u32 index = 0;
+        if (!in.read_value(index) || (index != NULL_INDEX && index >= entity_count)) {
+            return false;
+        }
+        value = static_cast<Entity>(index);
+        return true;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        u8 byte = 0;
+        if (!in.read_value(byte)) {
+            return false;
+        }
+        value = byte != 0;
+        return true;
+    } else if constexpr (is_plain_v<T>) {
+        return in.read_value(value);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        u32 size = 0;
+        if (!in.read_value(size) || size > in.remaining()) {
+            return false;
+        }
+        value.resize(size);
+        return in.read(value.data(), size);
+    } else if constexpr (is_vector<T>::value) {
+        u32 count = 0;
+        if (!in.read_value(count) || count > in.remaining()) { // Elements take at least a byte
+            return false;
+        }
+        value.resize(count);
+        for (auto& element : value) {
+            if (!read_binary(in, element, entity_count)) {
+                return false;
+            }
+        }
+        return true;
+    } else {
+        bool ok = true;
+        for_each_field<T>([&](const auto& field) {
+            ok = ok && read_binary(in, field.get(value), entity_count);
+        });
+        if (ok) {
+            after_load(value);
+        }
+        return ok;
+    }
+}
 
-        // Serialize Components (manual mapping for now)
-        // Check Tag
-        if (auto* tc = m_scene.registry().try_get<TagComponent>(entity)) {
-            entity_json["TagComponent"] = *tc;
+template <typename T>
+void remap_entities(T& value, std::span<const Entity> entities) {
+    if constexpr (std::is_same_v<T, Entity>) {
+        const auto index = static_cast<u32>(value);
+        if (index == NULL_INDEX) {
+            value = entt::null;
+        } else {
+            value = entities[index];
         }
+    } else if constexpr (is_vector<T>::value) {
+        for (auto& element : value) {
+            remap_entities(element, entities);
+        }
+    } else if constexpr (Reflected<T>) {
+        for_each_field<T>([&](const auto& field) { remap_entities(field.get(value), entities); });
+    }
+}
+
+// ============================================================================
+// Binary Chunks
+// ============================================================================
+
+usize align_up(usize value) {
+    return (value + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+}
+
+/**
+ * @brief A chunk collected from the registry, before its offsets are known
+ */
+struct ChunkData {
+    SceneChunk info{};
+    std::vector<u32> entities;
+    std::vector<u8> data;
+};
+
+template <ReflectedComponent T>
+void collect_chunk(entt::registry& registry, const EntityIndices& indices,
+                   std::vector<ChunkData>& chunks) {
+    auto& storage = registry.storage<T>();
+    if (storage.empty()) {
+        return;
+    }
+
+    ChunkData& chunk = chunks.emplace_back();
+    chunk.info.component = component_id<T>();
+    chunk.info.layout = component_layout<T>();
+    chunk.info.count = static_cast<u32>(storage.size());
+    chunk.info.encoding = component_encoding<T>();
+    chunk.entities.reserve(storage.size());
+    if constexpr (is_raw_component_v<T>) {
+        chunk.data.reserve(storage.size() * sizeof(T));
+    }
+
+    ByteWriter out(chunk.data);
+    for (auto [entity, component] : storage.each()) {
+        chunk.entities.push_back(indices(entity));
+        if constexpr (is_raw_component_v<T>) {
+            static_assert(alignof(T) <= BLOCK_ALIGNMENT);
+            out.write_value(component);
+        } else {
+            write_binary(out, component, indices);
+        }
+    }
+}
+
+/**
+ * @brief Bounds-checked access to a mapped binary scene
+ */
+class SceneFileView {
+public:
+    explicit SceneFileView(std::span<const u8> bytes) : m_bytes(bytes) {}
+
+    /**
+     * @brief Check the header, chunk table and entity indices; returns an error or nullptr
+     */
+    const char* validate() {
+        if (m_bytes.size() < sizeof(SceneFileHeader)) {
+            return "file is too small";
+        }
+        std::memcpy(&m_header, m_bytes.data(), sizeof(m_header));
+        if (std::memcmp(m_header.magic, SCENE_BINARY_MAGIC, sizeof(SCENE_BINARY_MAGIC)) != 0) {
+            return "not a binary scene";
+        }
+        if (m_header.version != SCENE_BINARY_VERSION) {
+            return "unsupported version";
+        }
+        if (!in_bounds(sizeof(SceneFileHeader), u64{m_header.chunk_count} * sizeof(SceneChunk))) {
+            return "file is truncated";
+        }
+
+        std::vector<u32> components;
+        std::vector<u8> seen(m_header.entity_count);
+        for (const SceneChunk& chunk : chunks()) {
+            if (std::find(components.begin(), components.end(), chunk.component) !=
+                components.end()) {
+                return "duplicate chunk";
+            }
+            components.push_back(chunk.component);
+
+            if (chunk.entity_offset % BLOCK_ALIGNMENT != 0 ||
+                chunk.data_offset % BLOCK_ALIGNMENT != 0 ||
+                !in_bounds(chunk.entity_offset, u64{chunk.count} * sizeof(u32)) ||
+                !in_bounds(chunk.data_offset, chunk.data_size)) {
+                return "chunk out of bounds";
+            }
+
+            // Each entity at most once per chunk, or insertion would assert
+            std::fill(seen.begin(), seen.end(), u8{0});
+            for (const u32 index : entities(chunk)) {
+                if (index >= m_header.entity_count || seen[index]) {
+                    return "bad entity index";
+                }
+                seen[index] = 1;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] const SceneFileHeader& header() const noexcept { return m_header; }
+
+    [[nodiscard]] std::span<const SceneChunk> chunks() const noexcept {
+        return {reinterpret_cast<const SceneChunk*>(m_bytes.data() + sizeof(SceneFileHeader)),
+                m_header.chunk_count};
+    }
+
+    [[nodiscard]] std::span<const u32> entities(const SceneChunk& chunk) const noexcept {
+        return {reinterpret_cast<const u32*>(m_bytes.data() + chunk.entity_offset), chunk.count};
+    }
+
+    [[nodiscard]] std::span<const u8> data(const SceneChunk& chunk) const noexcept {
+        return m_bytes.subspan(static_cast<usize>(chunk.data_offset),
+                               static_cast<usize>(chunk.data_size));
+    }
+
+private:
+    [[nodiscard]] bool in_bounds(u64 offset, u64 size) const noexcept {
+        return offset <= m_bytes.size() && size <= m_bytes.size() - offset;
+    }
+
+    std::span<const u8> m_bytes;
+    SceneFileHeader m_header{};
+};
+
+template <typename... Ts>
+std::tuple<std::vector<Ts>...> make_staging(TypeList<Ts...>);
+
+/// Decoded packed components, held until the file is known to be good
+using StagedComponents = decltype(make_staging(SerializedComponents{}));
 
-        if (auto* trc = m_scene.registry().try_get<TransformComponent>(entity)) {
-            entity_json["TransformComponent"] = *trc;
+/**
+ * @brief Check a chunk against the component and decode it if packed; returns an error or nullptr
+ */
+template <ReflectedComponent T>
+const char* stage_chunk(const SceneFileView& view, const SceneChunk& chunk,
+                        std::vector<T>& staged) {
+    if (chunk.layout != component_layout<T>() || chunk.encoding != component_encoding<T>()) {
+        return "component layout changed since the file was written";
+    }
+    if constexpr (is_raw_component_v<T>) {
+        return chunk.data_size == u64{chunk.count} * sizeof(T) ? nullptr : "chunk size mismatch";
+    } else {
+        ByteReader in(view.data(chunk));
+        staged.resize(chunk.count);
+        for (T& value : staged) {
+            if (!read_binary(in, value, view.header().entity_count)) {
+                return "chunk data is truncated";
+            }
         }
+        return nullptr;
+    }
+}
 
-        if (auto* mc = m_scene.registry().try_get<MeshComponent>(entity)) {
-            entity_json["MeshComponent"] = *mc;
+template <ReflectedComponent T>
+void insert_chunk(entt::registry& registry, const SceneFileView& view, const SceneChunk& chunk,
+                  std::span<const Entity> targets, std::span<const Entity> entities,
+                  std::vector<T>& staged) {
+    auto& storage = registry.storage<T>();
+    storage.reserve(storage.size() + targets.size());
+    if constexpr (is_raw_component_v<T>) {
+        const auto* values = reinterpret_cast<const T*>(view.data(chunk).data());
+        storage.insert(targets.begin(), targets.end(), values);
+    } else {
+        if constexpr (has_entity_refs<T>()) {
+            for (T& value : staged) {
+                remap_entities(value, entities);
+            }
         }
+        storage.insert(targets.begin(), targets.end(), std::make_move_iterator(staged.begin()));
+        staged = std::vector<T>{};
+    }
+}
 
-        if (auto* lc = m_scene.registry().try_get<LightComponent>(entity)) {
-            entity_json["LightComponent"] = *lc;
+/**
+ * @brief Call fn(std::type_identity<T>{}) for the serialized component stored in a chunk
+ * @return false if the chunk holds no registered component
+ */
+template <typename Fn>
+bool visit_component(u32 component, Fn&& fn) {
+    bool found = false;
+    for_each_type(SerializedComponents{}, [&]<typename T>(std::type_identity<T> type) {
+        if (!found && component == component_id<T>()) {
+            found = true;
+            fn(type);
         }
+    });
+    return found;
+}
+
+} // namespace
+
+SceneSerializer::SceneSerializer(Scene& scene) : m_scene(scene) {}
 
-        root["entities"].push_back(entity_json);
+// ============================================================================
+// JSON Serialization
+// ============================================================================
+
+bool SceneSerializer::serialize(const std::filesystem::path& path) {
+    entt::registry& registry = m_scene.registry();
+    const EntityIndices indices(registry);
+
+    std::vector<nlohmann::json> entities(indices.count());
+    for (u32 i = 0; i < indices.count(); ++i) {
+        entities[i]["id"] = i; // Entity references point here
+    }
+
+    // One pass per storage instead of probing every type on every entity
+    for_each_type(SerializedComponents{}, [&]<typename T>(std::type_identity<T>) {
+        for (auto [entity, component] : registry.storage<T>().each()) {
+            write_json(entities[indices(entity)][Reflect<T>::name], component, indices);
+        }
     });
 
+    nlohmann::json root;
+    root["entities"] = std::move(entities);
+
     std::ofstream file(path);
     if (!file.is_open()) {
         HZ_ERROR("Failed to open file for writing: {}", path.string());
-        return;
+        return false;
     }
     file << root.dump(4);
+    return true;
 }
 
 bool SceneSerializer::deserialize(const std::filesystem::path& path) {
@@ -67,35 +513,170 @@ bool SceneSerializer::deserialize(const std::filesystem::path& path) {
         return false;
     }
 
-    m_scene.clear();
+    const auto entities_json = root.find("entities");
+    if (entities_json == root.end() || !entities_json->is_array()) {
+        HZ_ERROR("Scene file has no entity array: {}", path.string());
+        return false;
+    }
 
-    auto entities = root["entities"];
-    for (auto& entity_json : entities) {
-        auto entity = m_scene.create_entity();
+    m_scene.clear();
+    entt::registry& registry = m_scene.registry();
+    std::vector<Entity> entities(entities_json->size());
+    registry.create(entities.begin(), entities.end());
 
-        if (entity_json.contains("TagComponent")) {
-            auto& tc = m_scene.registry().emplace<TagComponent>(entity);
-            entity_json["TagComponent"].get_to(tc);
+    const auto& loaders = json_loaders();
+    std::vector<std::string> unknown;
+    try {
+        for (usize i = 0; i < entities.size(); ++i) {
+            for (const auto& item : (*entities_json)[i].items()) {
+                if (const auto loader = loaders.find(item.key()); loader != loaders.end()) {
+                    loader->second(item.value(), registry, entities[i], entities);
+                } else if (item.key() != "id" &&
+                           std::find(unknown.begin(), unknown.end(), item.key()) == unknown.end()) {
+                    unknown.push_back(item.key());
+                }
+            }
         }
+    } catch (const nlohmann::json::exception& e) {
+        HZ_ERROR("Invalid scene {}: {}", path.string(), e.what());
+        m_scene.clear();
+        return false;
+    }
 
-        if (entity_json.contains("TransformComponent")) {
-            auto& trc = m_scene.registry().emplace<TransformComponent>(entity);
-            entity_json["TransformComponent"].get_to(trc);
-        }
+    for (const std::string& name : unknown) {
+        HZ_LOG_WARN("Skipped unknown component {} in {}", name, path.string());
+    }
+    HZ_LOG_INFO("Deserialized scene from: {}", path.string());
+    return true;
+}
+
+// ============================================================================
+// Binary Serialization
+// ============================================================================
+
+bool SceneSerializer::serialize_binary(const std::filesystem::path& path) {
+    entt::registry& registry = m_scene.registry();
+    const EntityIndices indices(registry);
+
+    std::vector<ChunkData> chunks;
+    for_each_type(SerializedComponents{}, [&]<typename T>(std::type_identity<T>) {
+        collect_chunk<T>(registry, indices, chunks);
+    });
+
+    // Layout: header, chunk table, then each chunk's entity and data blocks
+    SceneFileHeader header{};
+    std::memcpy(header.magic, SCENE_BINARY_MAGIC, sizeof(SCENE_BINARY_MAGIC));
+    header.version = SCENE_BINARY_VERSION;
+    header.entity_count = indices.count();
+    header.chunk_count = static_cast<u32>(chunks.size());
+
+    usize offset = align_up(sizeof(SceneFileHeader) + chunks.size() * sizeof(SceneChunk));
+    for (ChunkData& chunk : chunks) {
+        chunk.info.entity_offset = offset;
+        offset = align_up(offset + chunk.entities.size() * sizeof(u32));
+        chunk.info.data_offset = offset;
+        chunk.info.data_size = chunk.data.size();
+        offset = align_up(offset + chunk.data.size());
+    }
 
-        if (entity_json.contains("MeshComponent")) {
-            auto& mc = m_scene.registry().emplace<MeshComponent>(entity);
-            entity_json["MeshComponent"].get_to(mc);
+    std::vector<u8> bytes(offset);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    for (usize i = 0; i < chunks.size(); ++i) {
+        const ChunkData& chunk = chunks[i];
+        std::memcpy(bytes.data() + sizeof(header) + i * sizeof(SceneChunk), &chunk.info,
+                    sizeof(SceneChunk));
+        std::memcpy(bytes.data() + chunk.info.entity_offset, chunk.entities.data(),
+                    chunk.entities.size() * sizeof(u32));
+        if (!chunk.data.empty()) {
+            std::memcpy(bytes.data() + chunk.info.data_offset, chunk.data.data(),
+                        chunk.data.size());
         }
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        HZ_ERROR("Failed to open file for writing: {}", path.string());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        HZ_ERROR("Failed to write binary scene: {}", path.string());
+        return false;
+    }
+    return true;
+}
 
-        if (entity_json.contains("LightComponent")) {
-            auto& lc = m_scene.registry().emplace<LightComponent>(entity);
-            entity_json["LightComponent"].get_to(lc);
+bool SceneSerializer::deserialize_binary(const std::filesystem::path& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        HZ_ERROR("Failed to open file for reading: {}", path.string());
+        return false;
+    }
+
+    SceneFileView view(file.bytes());
+    if (const char* error = view.validate()) {
+        HZ_ERROR("Invalid binary scene {}: {}", path.string(), error);
+        return false;
+    }
+
+    // Check and decode every chunk before the scene is touched
+    StagedComponents staged;
+    for (const SceneChunk& chunk : view.chunks()) {
+        const char* error = nullptr;
+        const bool known =
+            visit_component(chunk.component, [&]<typename T>(std::type_identity<T>) {
+                error = stage_chunk<T>(view, chunk, std::get<std::vector<T>>(staged));
+            });
+        if (!known) {
+            HZ_LOG_WARN("Skipped unknown component {:08x} in {}", chunk.component,
+                        path.string());
+        } else if (error) {
+            HZ_ERROR("Invalid binary scene {}: {}", path.string(), error);
+            return false;
         }
     }
 
-    HZ_LOG_INFO("Deserialized scene from: {}", path.string());
+    m_scene.clear();
+    entt::registry& registry = m_scene.registry();
+
+    std::vector<Entity> entities(view.header().entity_count);
+    registry.create(entities.begin(), entities.end());
+
+    std::vector<Entity> targets;
+    for (const SceneChunk& chunk : view.chunks()) {
+        const std::span<const u32> indices = view.entities(chunk);
+        targets.resize(indices.size());
+        std::transform(indices.begin(), indices.end(), targets.begin(),
+                       [&](u32 index) { return entities[index]; });
+
+        visit_component(chunk.component, [&]<typename T>(std::type_identity<T>) {
+            insert_chunk<T>(registry, view, chunk, targets, entities,
+                            std::get<std::vector<T>>(staged));
+        });
+    }
+
+    HZ_LOG_INFO("Deserialized binary scene ({} entities) from: {}", entities.size(),
+                path.string());
     return true;
 }
 
+// ============================================================================
+// Conversion
+// ============================================================================
+
+bool SceneSerializer::convert_json_to_binary(const std::filesystem::path& json_path,
+                                             const std::filesystem::path& binary_path) {
+    Scene scene;
+    SceneSerializer serializer(scene);
+    return serializer.deserialize(json_path) && serializer.serialize_binary(binary_path);
+}
+
+bool SceneSerializer::convert_binary_to_json(const std::filesystem::path& binary_path,
+                                             const std::filesystem::path& json_path) {
+    Scene scene;
+    SceneSerializer serializer(scene);
+    return serializer.deserialize_binary(binary_path) && serializer.serialize(json_path);
+}
+
 } // namespace hz
@@ -1,5 +1,21 @@
 #pragma once
 
+/**
+ * @file scene_serializer.hpp
+ * @brief Scene save/load as JSON (interchange, debugging) or binary (shipping levels)
+ *
+ * Both formats are generated from the Reflect<T> descriptors of the types in
+ * SerializedComponents (component_registry.hpp), and both walk one component
+ * storage at a time, so saving and loading scale with the components present.
+ * Entity references are written as indices into the file's entity list.
+ *
+ * The binary format stores each component type as one contiguous block. The
+ * file is mapped instead of read, and plain components (transforms, lights,
+ * colliders...) are bulk-inserted straight from the mapping, so loading does
+ * no parsing. JSON stays the format for diffs and hand edits; the convert_*
+ * functions turn one into the other.
+ */
+
 #include "engine/scene/scene.hpp"
 
 #include <filesystem>
@@ -7,20 +23,90 @@
 
 namespace hz {
 
+// ============================================================================
+// Binary Format
+// ============================================================================
+
+/// Bump when the layout of the header or a chunk changes
+inline constexpr u32 SCENE_BINARY_VERSION = 3;
+inline constexpr char SCENE_BINARY_MAGIC[4] = {'H', 'Z', 'S', 'C'};
+
+/**
+ * @brief How a chunk's elements are stored
+ */
+enum class SceneChunkEncoding : u32 {
+    Raw,   // Whole components whose reflected fields tile them (scene_layout.hpp)
+    Packed // Reflected fields back to back; strings and arrays are length-prefixed
+};
+
+/**
+ * @brief Start of a binary scene file, followed by chunk_count SceneChunks
+ *
+ * Blocks are 16-byte aligned. Values are stored in native (little-endian)
+ * layout.
+ */
+struct SceneFileHeader {
+    char magic[4];
+    u32 version;
+    u32 entity_count; // Entities are referred to by index in [0, entity_count)
+    u32 chunk_count;
+};
+
+/**
+ * @brief One component type: count entity indices plus count elements
+ *
+ * Chunks whose layout no longer matches the component are rejected; convert
+ * the JSON source again after changing a reflected component.
+ */
+struct SceneChunk {
+    u32 component; // Hash of Reflect<T>::name
+    u32 layout;    // Hash of the reflected fields (and size and offsets, for Raw)
+    u32 count;
+    SceneChunkEncoding encoding;
+    u64 entity_offset; // u32[count] entity indices
+    u64 data_offset;
+    u64 data_size;
+};
+
+// ============================================================================
+// Scene Serializer
+// ============================================================================
+
 class SceneSerializer {
 public:
     explicit SceneSerializer(Scene& scene);
 
     /**
-     * @brief Serialize the current scene to a file
+     * @brief Serialize the current scene to a JSON file
      */
-    void serialize(const std::filesystem::path& path);
+    bool serialize(const std::filesystem::path& path);
 
     /**
-     * @brief Deserialize a scene from a file (clears current scene)
+     * @brief Deserialize a scene from a JSON file (clears current scene)
      */
     bool deserialize(const std::filesystem::path& path);
 
+    /**
+     * @brief Serialize the current scene to a binary file
+     */
+    bool serialize_binary(const std::filesystem::path& path);
+
+    /**
+     * @brief Deserialize a scene from a binary file (clears current scene)
+     *
+     * The whole file is validated before the scene is cleared, so a bad file
+     * leaves the scene untouched.
+     */
+    bool deserialize_binary(const std::filesystem::path& path);
+
+    /**
+     * @brief Convert between formats through a temporary scene
+     */
+    static bool convert_json_to_binary(const std::filesystem::path& json_path,
+                                       const std::filesystem::path& binary_path);
+    static bool convert_binary_to_json(const std::filesystem::path& binary_path,
+                                       const std::filesystem::path& json_path);
+
 private:
     Scene& m_scene;
 };
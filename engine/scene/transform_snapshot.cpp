@@ -0,0 +1,96 @@
+#include "transform_snapshot.hpp"
+
+#include <algorithm>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace hz {
+
+namespace {
+
+[[nodiscard]] glm::quat euler_to_quat(const glm::vec3& degrees) {
+    // Matches TransformComponent::get_transform(): Z, then Y, then X
+    const glm::vec3 radians = glm::radians(degrees);
+    return glm::angleAxis(radians.z, glm::vec3(0, 0, 1)) *
+           glm::angleAxis(radians.y, glm::vec3(0, 1, 0)) *
+           glm::angleAxis(radians.x, glm::vec3(1, 0, 0));
+}
+
+[[nodiscard]] bool entity_less(Entity a, Entity b) {
+    return entt::to_integral(a) < entt::to_integral(b);
+}
+
+} // namespace
+
+// ============================================================================
+// TransformSnapshot
+// ============================================================================
+
+std::optional<usize> TransformSnapshot::find(Entity entity) const {
+    const auto it = std::lower_bound(entities.begin(), entities.end(), entity, entity_less);
+    if (it == entities.end() || *it != entity) {
+        return std::nullopt;
+    }
+    return static_cast<usize>(it - entities.begin());
+}
+
+glm::mat4 TransformSnapshot::interpolate(usize index, f32 alpha) const {
+    const TransformComponent& from = previous[index];
+    const TransformComponent& to = current[index];
+
+    const glm::vec3 position = glm::mix(from.position, to.position, alpha);
+    const glm::vec3 scale = glm::mix(from.scale, to.scale, alpha);
+    const glm::quat rotation =
+        glm::slerp(euler_to_quat(from.rotation), euler_to_quat(to.rotation), alpha);
+
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+    model *= glm::mat4_cast(rotation);
+    return glm::scale(model, scale);
+}
+
+// ============================================================================
+// TransformSnapshotWriter
+// ============================================================================
+
+void TransformSnapshotWriter::capture(const Scene& scene, u64 tick, f64 simulation_time,
+                                      TransformSnapshot& out) {
+    out.tick = tick;
+    out.simulation_time = simulation_time;
+    out.entities.clear();
+    out.previous.clear();
+    out.current.clear();
+
+    const auto* storage = scene.registry().storage<TransformComponent>();
+    if (storage) {
+        const entt::sparse_set& set = *storage;
+        out.entities.assign(set.begin(), set.end());
+    }
+    std::sort(out.entities.begin(), out.entities.end(), entity_less);
+
+    out.current.reserve(out.entities.size());
+    out.previous.reserve(out.entities.size());
+
+    // Both lists are sorted, so previous transforms are matched by a merge walk
+    usize last = 0;
+    for (Entity entity : out.entities) {
+        const TransformComponent& transform = storage->get(entity);
+        out.current.push_back(transform);
+
+        while (last < m_last_entities.size() && entity_less(m_last_entities[last], entity)) {
+            ++last;
+        }
+        const bool existed = last < m_last_entities.size() && m_last_entities[last] == entity;
+        out.previous.push_back(existed ? m_last_transforms[last] : transform);
+    }
+
+    m_last_entities = out.entities;
+    m_last_transforms = out.current;
+}
+
+void TransformSnapshotWriter::reset() {
+    m_last_entities.clear();
+    m_last_transforms.clear();
+}
+
+} // namespace hz
@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file transform_snapshot.hpp
+ * @brief Immutable transform state handed from simulation to rendering
+ */
+
+#include "components.hpp"
+#include "scene.hpp"
+
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace hz {
+
+/**
+ * @brief Transforms of every entity at the end of one fixed tick
+ *
+ * Each entry holds the transform before and after the tick, so the renderer
+ * can interpolate with the game loop's alpha even if it skipped ticks.
+ * Entities are sorted by id for lookup.
+ */
+struct TransformSnapshot {
+    u64 tick{0};
+    f64 simulation_time{0.0};
+    std::vector<Entity> entities;
+    std::vector<TransformComponent> previous;
+    std::vector<TransformComponent> current;
+
+    [[nodiscard]] usize size() const noexcept { return entities.size(); }
+
+    /**
+     * @brief Find the index of an entity, if it was captured
+     */
+    [[nodiscard]] std::optional<usize> find(Entity entity) const;
+
+    /**
+     * @brief Model matrix blended between the previous and current transform
+     * @param alpha Interpolation factor from GameLoop (0 = previous, 1 = current)
+     */
+    [[nodiscard]] glm::mat4 interpolate(usize index, f32 alpha) const;
+};
+
+/**
+ * @brief Fills TransformSnapshots on the simulation thread
+ *
+ * Remembers the transforms from its last capture to fill in the previous
+ * state. Entities created during the tick use their current transform for both.
+ */
+class TransformSnapshotWriter {
+public:
+    void capture(const Scene& scene, u64 tick, f64 simulation_time, TransformSnapshot& out);
+
+    /**
+     * @brief Forget the last capture (e.g. after a teleport or scene reload)
+     */
+    void reset();
+
+private:
+    std::vector<Entity> m_last_entities;
+    std::vector<TransformComponent> m_last_transforms;
+};
+
+} // namespace hz
@@ -0,0 +1,243 @@
+#include "world_transform.hpp"
+
+#include "engine/core/log.hpp"
+
+#include <algorithm>
+
+namespace hz {
+
+namespace {
+
+[[nodiscard]] bool same_local(const TransformComponent& a, const TransformComponent& b) {
+    return a.position == b.position && a.rotation == b.rotation && a.scale == b.scale;
+}
+
+[[nodiscard]] bool same_order(const std::vector<Entity>& cached, const entt::sparse_set* set) {
+    if (!set) {
+        return cached.empty();
+    }
+    return cached.size() == set->size() &&
+           std::equal(cached.begin(), cached.end(), set->data());
+}
+
+} // namespace
+
+// ============================================================================
+// Hierarchy
+// ============================================================================
+
+bool set_parent(entt::registry& registry, Entity child, Entity parent) {
+    if (parent == entt::null) {
+        registry.remove<HierarchyComponent>(child);
+        return true;
+    }
+
+    for (Entity ancestor = parent; ancestor != entt::null;
+         ancestor = get_parent(registry, ancestor)) {
+        if (ancestor == child) {
+            return false;
+        }
+    }
+
+    registry.emplace_or_replace<HierarchyComponent>(child, parent);
+    return true;
+}
+
+Entity get_parent(const entt::registry& registry, Entity entity) {
+    const auto* hierarchy = registry.try_get<HierarchyComponent>(entity);
+    return hierarchy ? hierarchy->parent : Entity{entt::null};
+}
+
+// ============================================================================
+// WorldTransformCache Implementation
+// ============================================================================
+
+void WorldTransformCache::update(const entt::registry& registry) {
+    m_last_update_rebuilt = structure_changed(registry);
+    if (m_last_update_rebuilt) {
+        rebuild(registry);
+    }
+
+    m_last_update_count = 0;
+    if (m_entities.empty()) {
+        return;
+    }
+
+    // Parents come first, so a parent's dirty flag is final before its children read it
+    const auto& transforms = *registry.storage<TransformComponent>();
+    for (usize slot = 0; slot < m_entities.size(); ++slot) {
+        const TransformComponent& local = transforms.get(m_entities[slot]);
+        const u32 parent = m_parents[slot];
+
+        const bool dirty = m_last_update_rebuilt || !same_local(local, m_locals[slot]) ||
+                           (parent != INVALID_SLOT && m_dirty[parent]);
+        m_dirty[slot] = dirty ? 1 : 0;
+        if (!dirty) {
+            continue;
+        }
+
+        m_locals[slot] = local;
+        const glm::mat4 matrix = local.get_transform();
+        m_world[slot] = parent == INVALID_SLOT ? matrix : m_world[parent] * matrix;
+        ++m_last_update_count;
+    }
+}
+
+const glm::mat4& WorldTransformCache::world_matrix(Entity entity) const {
+    static const glm::mat4 identity{1.0f};
+    const u32 index = slot(entity);
+    return index == INVALID_SLOT ? identity : m_world[index];
+}
+
+u32 WorldTransformCache::slot(Entity entity) const {
+    if (entity == entt::null) {
+        return INVALID_SLOT;
+    }
+    const usize key = entt::to_entity(entity);
+    if (key >= m_slot_of.size()) {
+        return INVALID_SLOT;
+    }
+    const u32 index = m_slot_of[key];
+    return index != INVALID_SLOT && m_entities[index] == entity ? index : INVALID_SLOT;
+}
+
+void WorldTransformCache::clear() {
+    m_entities.clear();
+    m_parents.clear();
+    m_locals.clear();
+    m_world.clear();
+    m_dirty.clear();
+    m_slot_of.clear();
+    m_transform_order.clear();
+    m_hierarchy_order.clear();
+    m_hierarchy_parents.clear();
+}
+
+bool WorldTransformCache::structure_changed(const entt::registry& registry) const {
+    const auto* hierarchy = registry.storage<HierarchyComponent>();
+    if (!same_order(m_transform_order, registry.storage<TransformComponent>()) ||
+        !same_order(m_hierarchy_order, hierarchy)) {
+        return true;
+    }
+
+    for (usize i = 0; i < m_hierarchy_order.size(); ++i) {
+        if (hierarchy->get(m_hierarchy_order[i]).parent != m_hierarchy_parents[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorldTransformCache::rebuild(const entt::registry& registry) {
+    clear();
+
+    if (const auto* hierarchy = registry.storage<HierarchyComponent>()) {
+        m_hierarchy_order.assign(hierarchy->data(), hierarchy->data() + hierarchy->size());
+        for (Entity entity : m_hierarchy_order) {
+            m_hierarchy_parents.push_back(hierarchy->get(entity).parent);
+        }
+    }
+
+    const auto* transforms = registry.storage<TransformComponent>();
+    if (!transforms || transforms->empty()) {
+        return;
+    }
+    m_transform_order.assign(transforms->data(), transforms->data() + transforms->size());
+    const usize count = m_transform_order.size();
+
+    // Storage index of every entity and of its parent
+    for (Entity entity : m_transform_order) {
+        const usize key = entt::to_entity(entity);
+        if (key >= m_slot_of.size()) {
+            m_slot_of.resize(key + 1, INVALID_SLOT);
+        }
+    }
+    for (usize i = 0; i < count; ++i) {
+        m_slot_of[entt::to_entity(m_transform_order[i])] = static_cast<u32>(i);
+    }
+
+    const auto index_of = [this](Entity entity) {
+        const usize key = entt::to_entity(entity);
+        if (entity == entt::null || key >= m_slot_of.size()) {
+            return INVALID_SLOT;
+        }
+        const u32 index = m_slot_of[key];
+        return index != INVALID_SLOT && m_transform_order[index] == entity ? index : INVALID_SLOT;
+    };
+
+    std::vector<u32> parent_of(count, INVALID_SLOT);
+    for (usize i = 0; i < m_hierarchy_order.size(); ++i) {
+        const u32 child = index_of(m_hierarchy_order[i]);
+        const u32 parent = index_of(m_hierarchy_parents[i]);
+        if (child != INVALID_SLOT && parent != child) {
+            parent_of[child] = parent;
+        }
+    }
+
+    // Depth of every entity; walks stop at the first ancestor with a known depth,
+    // so each entity is walked once
+    constexpr u32 UNKNOWN = ~0u;
+    constexpr u32 ON_PATH = UNKNOWN - 1;
+    std::vector<u32> depth(count, UNKNOWN);
+    std::vector<u32> path;
+    u32 max_depth = 0;
+    for (usize i = 0; i < count; ++i) {
+        u32 current = static_cast<u32>(i);
+        path.clear();
+        while (current != INVALID_SLOT && depth[current] == UNKNOWN) {
+            depth[current] = ON_PATH;
+            path.push_back(current);
+            current = parent_of[current];
+        }
+
+        u32 d = 0;
+        if (current != INVALID_SLOT && depth[current] == ON_PATH) {
+            // Only possible if HierarchyComponent was written without set_parent().
+            // The last edge walked closes the cycle; cut it, so descendants of
+            // the cycle keep their parents.
+            const u32 last = path.back();
+            HZ_ENGINE_WARN("WorldTransformCache: hierarchy cycle at entity {}",
+                           static_cast<u32>(m_transform_order[last]));
+            parent_of[last] = INVALID_SLOT;
+        } else if (current != INVALID_SLOT) {
+            d = depth[current] + 1;
+        }
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            depth[*it] = d++;
+        }
+        if (!path.empty()) {
+            max_depth = std::max(max_depth, d - 1);
+        }
+    }
+
+    // Counting sort by depth: stable, so siblings keep storage order
+    std::vector<u32> first(max_depth + 2, 0);
+    for (u32 d : depth) {
+        ++first[d + 1];
+    }
+    for (usize d = 1; d < first.size(); ++d) {
+        first[d] += first[d - 1];
+    }
+    std::vector<u32> slot_of_index(count);
+    for (usize i = 0; i < count; ++i) {
+        slot_of_index[i] = first[depth[i]]++;
+    }
+
+    m_entities.resize(count);
+    m_parents.resize(count);
+    for (usize i = 0; i < count; ++i) {
+        const u32 slot = slot_of_index[i];
+        m_entities[slot] = m_transform_order[i];
+        m_parents[slot] = parent_of[i] == INVALID_SLOT ? INVALID_SLOT : slot_of_index[parent_of[i]];
+        m_slot_of[entt::to_entity(m_transform_order[i])] = slot;
+    }
+    m_locals.resize(count);
+    m_world.resize(count, glm::mat4(1.0f));
+    m_dirty.assign(count, 1);
+}
+
+WorldTransformCache& world_transforms(entt::registry& registry) {
+    return registry.ctx().emplace<WorldTransformCache>();
+}
+
+} // namespace hz
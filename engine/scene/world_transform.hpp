@@ -0,0 +1,132 @@
+#pragma once
+
+/**
+ * @file world_transform.hpp
+ * @brief Parent/child transforms and a per-frame cache of world matrices
+ *
+ * TransformComponent stays local: relative to the parent named by a
+ * HierarchyComponent, or to the world if there is none. WorldTransformCache
+ * turns local transforms into world matrices once per frame. It keeps
+ * entities in topological order (parents before children) in flat arrays, and
+ * recomputes only entities whose local transform changed since the last
+ * update, plus their descendants. Changes are found by comparing against the
+ * last seen local transform, so systems can keep writing TransformComponent
+ * directly.
+ */
+
+#include "components.hpp"
+#include "scene.hpp"
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace hz {
+
+/**
+ * @brief Attaches an entity's transform to another entity
+ *
+ * Use set_parent(), which rejects cycles; a cycle written around it is cut at
+ * one of its own edges by WorldTransformCache. A parent that is destroyed or
+ * has no TransformComponent is treated as the world.
+ */
+struct HierarchyComponent {
+    Entity parent{entt::null};
+};
+
+template <>
+struct Reflect<HierarchyComponent> {
+    static constexpr std::string_view name = "HierarchyComponent";
+    static constexpr auto fields = std::tuple{field("parent", &HierarchyComponent::parent)};
+};
+
+/**
+ * @brief Attach child to parent (entt::null detaches)
+ * @return false if parent is child itself or one of its descendants
+ */
+bool set_parent(entt::registry& registry, Entity child, Entity parent);
+
+/**
+ * @brief The entity's parent, or entt::null
+ */
+[[nodiscard]] Entity get_parent(const entt::registry& registry, Entity entity);
+
+// ============================================================================
+// World Transform Cache
+// ============================================================================
+
+/**
+ * @brief World matrices of every entity with a TransformComponent
+ *
+ * Arrays are indexed by slot; slots are in topological order, so
+ * world_matrices() can be uploaded as-is and children can be resolved from
+ * parents in one pass. Slots change only when entities or parents change.
+ */
+class WorldTransformCache {
+public:
+    static constexpr u32 INVALID_SLOT = ~0u;
+
+    /**
+     * @brief Bring every world matrix up to date (call once per frame)
+     */
+    void update(const entt::registry& registry);
+
+    /**
+     * @brief Cached world matrix; identity if the entity was not cached at the last update
+     */
+    [[nodiscard]] const glm::mat4& world_matrix(Entity entity) const;
+
+    /**
+     * @brief Slot of an entity, or INVALID_SLOT if it is not cached
+     */
+    [[nodiscard]] u32 slot(Entity entity) const;
+
+    [[nodiscard]] usize size() const noexcept { return m_entities.size(); }
+    [[nodiscard]] std::span<const Entity> entities() const noexcept { return m_entities; }
+    [[nodiscard]] std::span<const u32> parents() const noexcept { return m_parents; }
+    [[nodiscard]] std::span<const glm::mat4> world_matrices() const noexcept { return m_world; }
+
+    /**
+     * @brief Matrices recomputed by the last update()
+     */
+    [[nodiscard]] u32 last_update_count() const noexcept { return m_last_update_count; }
+
+    /**
+     * @brief Whether the last update() had to rebuild the topological order
+     */
+    [[nodiscard]] bool last_update_rebuilt() const noexcept { return m_last_update_rebuilt; }
+
+    /**
+     * @brief Drop everything; the next update() recomputes every matrix
+     */
+    void clear();
+
+private:
+    [[nodiscard]] bool structure_changed(const entt::registry& registry) const;
+    void rebuild(const entt::registry& registry);
+
+    // Slot arrays (SoA, topological order)
+    std::vector<Entity> m_entities;
+    std::vector<u32> m_parents;               // Parent slot or INVALID_SLOT
+    std::vector<TransformComponent> m_locals; // Local transform the matrix was built from
+    std::vector<glm::mat4> m_world;
+    std::vector<u8> m_dirty;
+
+    std::vector<u32> m_slot_of; // Indexed by entt::to_entity()
+
+    // What the order was built from, compared each update to detect changes
+    std::vector<Entity> m_transform_order; // TransformComponent storage order
+    std::vector<Entity> m_hierarchy_order; // HierarchyComponent storage order
+    std::vector<Entity> m_hierarchy_parents;
+
+    u32 m_last_update_count{0};
+    bool m_last_update_rebuilt{false};
+};
+
+/**
+ * @brief The world transform cache stored in a registry's context (created on first use)
+ */
+[[nodiscard]] WorldTransformCache& world_transforms(entt::registry& registry);
+
+} // namespace hz
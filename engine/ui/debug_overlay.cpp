@@ -1,10 +1,16 @@
 #include "debug_overlay.hpp"
 
+#include "engine/renderer/deferred_renderer.hpp"
+
 #include <imgui.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace hz {
 
-void DebugOverlay::draw(f32 fps, f32 frame_time, u32 physics_bodies) {
+void DebugOverlay::draw(f32 fps, f32 frame_time, u32 physics_bodies,
+                        const RenderStats* render_stats) {
     if (!m_visible)
         return;
 
@@ -32,6 +38,15 @@ void DebugOverlay::draw(f32 fps, f32 frame_time, u32 physics_bodies) {
         ImGui::PlotLines("##FrameGraph", m_frame_times, HISTORY_SIZE,
                          static_cast<int>(m_frame_index), nullptr, 0.0f, 33.3f, ImVec2(150, 40));
 
+        if (render_stats) {
+            ImGui::Separator();
+            ImGui::Text("GPU: %.2f ms", static_cast<double>(render_stats->total_frame_ms));
+            ImGui::Text("  Shadows:  %.2f ms", static_cast<double>(render_stats->shadow_pass_ms));
+            ImGui::Text("  Geometry: %.2f ms", static_cast<double>(render_stats->geometry_pass_ms));
+            ImGui::Text("  Lighting: %.2f ms", static_cast<double>(render_stats->lighting_pass_ms));
+            ImGui::Text("  Post:     %.2f ms", static_cast<double>(render_stats->post_process_ms));
+        }
+
         if (physics_bodies > 0) {
             ImGui::Separator();
             ImGui::Text("Physics: %u bodies", physics_bodies);
@@ -39,7 +54,106 @@ void DebugOverlay::draw(f32 fps, f32 frame_time, u32 physics_bodies) {
 
         ImGui::Separator();
         ImGui::TextDisabled("F3 to toggle");
+        if (ImGui::SmallButton("Profiler")) {
+            toggle_profiler();
+        }
+    }
+    ImGui::End();
+}
+
+void DebugOverlay::draw_profiler() {
+    if (!m_profiler_visible)
+        return;
+
+    if (!m_profiler_paused) {
+        m_profiler_frame = Profiler::last_frame();
+    }
+
+    ImGui::SetNextWindowSize(ImVec2(720, 260), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Profiler", &m_profiler_visible)) {
+        ImGui::End();
+        return;
+    }
+
+    const u64 frame_ns = std::max<u64>(m_profiler_frame.end_ns - m_profiler_frame.start_ns, 1);
+    ImGui::Text("Frame: %.2f ms, %zu zones", static_cast<double>(frame_ns) * 1e-6,
+                m_profiler_frame.zones.size());
+    ImGui::SameLine();
+    ImGui::Checkbox("Pause", &m_profiler_paused);
+    ImGui::SameLine();
+    if (Profiler::is_capturing()) {
+        if (ImGui::Button("Stop capture")) {
+            Profiler::end_capture();
+            Profiler::write_chrome_trace("profile.json");
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu zones captured", Profiler::capture().size());
+    } else if (ImGui::Button("Capture")) {
+        Profiler::begin_capture();
+    }
+
+    ImGui::Separator();
+
+    // Flame view: one band per thread, one row per nesting depth
+    constexpr f32 ROW_HEIGHT = 18.0f;
+    constexpr f32 LABEL_WIDTH = 90.0f;
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const std::vector<ProfileThreadInfo> threads = Profiler::threads();
+    const f32 width = std::max(ImGui::GetContentRegionAvail().x - LABEL_WIDTH, 1.0f);
+    const f32 scale = width / static_cast<f32>(frame_ns);
+    const ImU32 text_color = ImGui::GetColorU32(ImGuiCol_Text);
+
+    usize zone = 0;
+    const auto& zones = m_profiler_frame.zones;
+    while (zone < zones.size()) {
+        const u32 thread_id = zones[zone].thread_id;
+        u32 max_depth = 0;
+        usize end = zone;
+        while (end < zones.size() && zones[end].thread_id == thread_id) {
+            max_depth = std::max(max_depth, zones[end].depth);
+            ++end;
+        }
+
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const char* thread_name =
+            thread_id < threads.size() ? threads[thread_id].name.c_str() : "?";
+        draw_list->AddText(origin, text_color, thread_name);
+
+        const f32 left = origin.x + LABEL_WIDTH;
+        for (; zone < end; ++zone) {
+            const ProfileZone& z = zones[zone];
+            const u64 start = std::max(z.start_ns, m_profiler_frame.start_ns);
+            if (z.end_ns <= start) {
+                continue;
+            }
+
+            const ImVec2 min(left + static_cast<f32>(start - m_profiler_frame.start_ns) * scale,
+                             origin.y + static_cast<f32>(z.depth) * ROW_HEIGHT);
+            const f32 zone_width = static_cast<f32>(z.end_ns - start) * scale;
+            const ImVec2 max(min.x + std::max(zone_width, 1.0f), min.y + ROW_HEIGHT - 1.0f);
+
+            // Stable colour per zone name
+            const auto hash = static_cast<u32>(std::hash<const void*>{}(z.name));
+            const ImU32 color = IM_COL32(80 + (hash & 0x7F), 80 + ((hash >> 8) & 0x7F),
+                                         80 + ((hash >> 16) & 0x7F), 255);
+            draw_list->AddRectFilled(min, max, color);
+
+            if (max.x - min.x > 30.0f) {
+                draw_list->PushClipRect(min, max, true);
+                draw_list->AddText(ImVec2(min.x + 2.0f, min.y + 1.0f), IM_COL32_BLACK, z.name);
+                draw_list->PopClipRect();
+            }
+            if (ImGui::IsMouseHoveringRect(min, max)) {
+                ImGui::SetTooltip("%s\n%.3f ms\n%u allocations", z.name, z.duration_ms(),
+                                  z.allocations);
+            }
+        }
+
+        const f32 band_height = static_cast<f32>(max_depth + 1) * ROW_HEIGHT + 4.0f;
+        ImGui::Dummy(ImVec2(LABEL_WIDTH + width, band_height));
     }
+
     ImGui::End();
 }
 
@@ -5,10 +5,13 @@
  * @brief Debug overlay with FPS counter and stats
  */
 
+#include "engine/core/profiler.hpp"
 #include "engine/core/types.hpp"
 
 namespace hz {
 
+struct RenderStats;
+
 /**
  * @brief Debug overlay showing performance stats
  */
@@ -22,8 +25,15 @@ public:
      * @param fps Current frames per second
      * @param frame_time Frame time in milliseconds
      * @param physics_bodies Number of physics bodies
+     * @param render_stats Renderer stats for the per-pass GPU times (optional)
+     */
+    void draw(f32 fps, f32 frame_time, u32 physics_bodies = 0,
+              const RenderStats* render_stats = nullptr);
+
+    /**
+     * @brief Draw the profiler window: flame view of the last frame and capture controls
      */
-    void draw(f32 fps, f32 frame_time, u32 physics_bodies = 0);
+    void draw_profiler();
 
     /**
      * @brief Toggle overlay visibility
@@ -40,8 +50,16 @@ public:
      */
     void set_visible(bool visible) { m_visible = visible; }
 
+    /**
+     * @brief Toggle profiler window visibility
+     */
+    void toggle_profiler() { m_profiler_visible = !m_profiler_visible; }
+
 private:
     bool m_visible{true};
+    bool m_profiler_visible{false};
+    bool m_profiler_paused{false};
+    ProfileFrame m_profiler_frame; // Frame shown in the flame view
 
     // Frame time history for graph
     static constexpr size_t HISTORY_SIZE = 120;
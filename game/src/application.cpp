@@ -9,10 +9,14 @@
 #include <sstream>
 
 #include <GLFW/glfw3.h>
+#include <engine/core/jobs.hpp>
 #include <engine/core/log.hpp>
 #include <engine/core/memory.hpp>
 #include <engine/renderer/camera.hpp>
 #include <engine/renderer/opengl/gl_context.hpp>
+#include <engine/renderer/render_utils.hpp>
+#include <engine/scene/command_buffer.hpp>
+#include <engine/scene/world_transform.hpp>
 #include <glad/glad.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <imgui.h>
@@ -33,6 +37,7 @@ std::string Application::read_file(const std::string& path) {
 bool Application::init() {
     hz::Log::init();
     hz::MemoryContext::init();
+    hz::JobSystem::init();
 
     if (!init_window()) {
         return false;
@@ -144,39 +149,59 @@ void Application::load_assets() {
         HZ_LOG_WARN("IBL initialization failed!");
     }
 
-    // Load treasure chest model
-    m_test_model = hz::Model::load_from_gltf("assets/models/treasure_chest/treasure_chest_4k.gltf");
-    if (m_test_model && m_test_model->is_valid()) {
-        HZ_LOG_INFO("Test model loaded! Mesh count: {}", m_test_model->mesh_count());
-
-        // Load textures
-        hz::TextureParams albedo_params;
-        albedo_params.srgb = true;
-        albedo_params.flip_y = false;
-        albedo_params.generate_mipmaps = true;
-
-        hz::TextureParams linear_params;
-        linear_params.srgb = false;
-        linear_params.flip_y = false;
-        linear_params.generate_mipmaps = true;
-
-        m_albedo_tex = hz::Texture::load_from_file(
-            "assets/models/treasure_chest/textures/treasure_chest_diff_4k.jpg", albedo_params);
-        m_normal_tex = hz::Texture::load_from_file(
-            "assets/models/treasure_chest/textures/treasure_chest_nor_gl_4k.jpg", linear_params);
-        m_arm_tex = hz::Texture::load_from_file(
-            "assets/models/treasure_chest/textures/treasure_chest_arm_4k.jpg", linear_params);
+    // Models and textures stream in while the scene runs; on_render() uploads them as they finish.
+    // Chest first, character second: the game systems find the character by model index 1
+    m_assets = std::make_unique<hz::AssetRegistry>();
+    m_assets->enable_texture_residency(GameConfig::TEXTURE_BUDGET_BYTES); // Before the loads
+    m_test_model =
+        m_assets->load_model_async("assets/models/treasure_chest/treasure_chest_4k.gltf");
+    m_character_model = m_assets->load_model_async("assets/models/character.fbx");
+
+    hz::TextureParams albedo_params;
+    albedo_params.srgb = true;
+    albedo_params.flip_y = false;
+    albedo_params.generate_mipmaps = true;
+
+    hz::TextureParams linear_params;
+    linear_params.srgb = false;
+    linear_params.flip_y = false;
+    linear_params.generate_mipmaps = true;
+
+    // Residency-managed: the geometry pass requests the levels the chest covers on screen
+    m_chest_material.albedo_tex = m_assets->load_texture_async(
+        "assets/models/treasure_chest/textures/treasure_chest_diff_4k.jpg", albedo_params);
+    m_chest_material.normal_tex = m_assets->load_texture_async(
+        "assets/models/treasure_chest/textures/treasure_chest_nor_gl_4k.jpg", linear_params);
+    m_chest_material.metallic_tex = m_assets->load_texture_async(
+        "assets/models/treasure_chest/textures/treasure_chest_arm_4k.jpg", linear_params);
+}
+
+void Application::on_assets_streamed() {
+    if (m_character_ready) {
+        return;
     }
 
-    // Load character model
-    m_character_model = hz::Model::load_from_fbx("assets/models/character.fbx");
-    if (m_character_model && m_character_model->is_valid()) {
-        HZ_LOG_INFO("Character model loaded! Animations: {}",
-                    m_character_model->animations().size());
-        m_animation_system.init(*m_character_model);
-    } else {
+    if (m_assets->model_state(m_character_model) == hz::AssetState::Failed) {
         HZ_ERROR("Failed to load character model!");
+        m_character_ready = true; // Stays undrawn
+        return;
+    }
+    hz::Model* character = m_assets->get_model(m_character_model);
+    if (!character) {
+        return;
+    }
+
+    HZ_LOG_INFO("Character model loaded! Animations: {}", character->animations().size());
+    m_animation_system.init(*character);
+    if (character->has_skeleton()) {
+        auto& ac = m_scene->registry().emplace<hz::AnimatorComponent>(m_character_entity);
+        ac.skeleton = character->skeleton();
+        if (!character->animations().empty()) {
+            auto anim = character->animations().back();
+            ac.play(anim, true);
+        }
     }
+    m_character_ready = true;
 }
 
 void Application::setup_scene_entities() {
@@ -231,8 +256,8 @@ void Application::setup_scene_entities() {
         }
     }
 
-    // Create treasure chest entity
-    if (m_test_model && m_test_model->is_valid()) {
+    // Create treasure chest entity; drawn once its model is resident
+    {
         auto entity = m_scene->create_entity();
         auto& tc = m_scene->registry().emplace<hz::TransformComponent>(entity);
         tc.position = glm::vec3(0.0f, 5.0f, 0.0f);
@@ -240,7 +265,7 @@ void Application::setup_scene_entities() {
 
         auto& mc = m_scene->registry().emplace<hz::MeshComponent>(entity);
         mc.mesh_type = hz::MeshComponent::MeshType::Model;
-        mc.model.index = 0;
+        mc.model = m_test_model;
 
         auto& tag = m_scene->registry().emplace<hz::TagComponent>(entity);
         tag.tag = "TreasureChest";
@@ -277,9 +302,10 @@ void Application::setup_scene_entities() {
         bc.half_extents = glm::vec3(50.0f, 1.0f, 50.0f);
     }
 
-    // Create character entity
-    if (m_character_model && m_character_model->is_valid()) {
+    // Create character entity; on_assets_streamed() adds its animator
+    {
         auto entity = m_scene->create_entity();
+        m_character_entity = entity;
         auto& tc = m_scene->registry().emplace<hz::TransformComponent>(entity);
         tc.position = glm::vec3(5.0f, 0.0f, 0.0f);
         tc.scale = glm::vec3(1.0f);
@@ -287,22 +313,14 @@ void Application::setup_scene_entities() {
 
         auto& mc = m_scene->registry().emplace<hz::MeshComponent>(entity);
         mc.mesh_type = hz::MeshComponent::MeshType::Model;
-        mc.model.index = 1;
-
-        if (m_character_model->has_skeleton()) {
-            auto& ac = m_scene->registry().emplace<hz::AnimatorComponent>(entity);
-            ac.skeleton = m_character_model->skeleton();
-            if (!m_character_model->animations().empty()) {
-                auto anim = m_character_model->animations().back();
-                ac.play(anim, true);
-            }
-        }
+        mc.model = m_character_model;
     }
 }
 
 void Application::run() {
     hz::GameLoop loop;
 
+    register_systems(loop);
     loop.set_update_callback([this](hz::f64 dt) { on_update(static_cast<float>(dt)); });
 
     loop.set_render_callback([this](hz::f64 alpha) { on_render(static_cast<float>(alpha)); });
@@ -311,30 +329,78 @@ void Application::run() {
     loop.run();
 }
 
-void Application::on_update(float dt) {
-    // Physics
-    m_physics_system.update(*m_scene, *m_physics, dt);
+void Application::register_systems(hz::GameLoop& loop) {
+    // Registration order is the execution order wherever two systems conflict
+
+    loop.add_system("physics",
+                    [this](hz::f64 dt) {
+                        m_physics_system.update(*m_scene, *m_physics, static_cast<float>(dt));
+                    })
+        .reads<hz::BoxColliderComponent, hz::CapsuleColliderComponent>()
+        .writes<hz::TransformComponent, hz::RigidBodyComponent, hz::PhysicsWorld>();
 
     // Player input & movement
-    m_player_system.update(*m_scene, *m_input, *m_window, dt);
-    m_player_system.handle_shooting(*m_scene, *m_input, *m_physics);
+    loop.add_system("player",
+                    [this](hz::f64 dt) {
+                        m_player_system.update(*m_scene, *m_input, *m_window,
+                                               static_cast<float>(dt));
+                    })
+        .main_thread()
+        .reads<hz::InputManager, hz::Window>()
+        .writes<hz::TransformComponent, hz::CameraComponent, PlayerSystem>();
+
+    // Spawns impact VFX entities
+    loop.add_system("player_shooting",
+                    [this](hz::f64) {
+                        m_player_system.handle_shooting(*m_scene, *m_input, *m_physics);
+                    })
+        .main_thread()
+        .exclusive();
 
     // Sync character with camera
-    glm::vec3 cam_pos = m_player_system.get_camera_position(*m_scene);
-    glm::vec3 cam_rot = m_player_system.get_camera_rotation(*m_scene);
-    m_character_system.update(*m_scene, cam_pos, cam_rot);
-
-    // Animation
-    m_animation_system.sync_with_player_movement(*m_scene, m_player_system.state().is_moving);
-    m_animation_system.update(*m_scene, dt);
-
-    if (m_animation_system.is_ik_enabled() && m_character_model) {
-        m_animation_system.apply_ik(*m_scene, *m_character_model, m_ik_target_position);
-    }
-
-    // VFX cleanup
-    m_lifetime_system.update(*m_scene, dt);
+    loop.add_system("character",
+                    [this](hz::f64) {
+                        glm::vec3 cam_pos = m_player_system.get_camera_position(*m_scene);
+                        glm::vec3 cam_rot = m_player_system.get_camera_rotation(*m_scene);
+                        m_character_system.update(*m_scene, cam_pos, cam_rot);
+                    })
+        .reads<hz::CameraComponent, hz::MeshComponent, PlayerSystem>()
+        .writes<hz::TransformComponent>();
+
+    // Animation (runs alongside the character sync)
+    loop.add_system("animation",
+                    [this](hz::f64 dt) {
+                        m_animation_system.sync_with_player_movement(
+                            *m_scene, m_player_system.state().is_moving);
+                        m_animation_system.update(*m_scene, static_cast<float>(dt));
+                    })
+        .reads<hz::MeshComponent, PlayerSystem>()
+        .writes<hz::AnimatorComponent>();
+
+    loop.add_system("animation_ik",
+                    [this](hz::f64) {
+                        hz::Model* character = m_assets->get_model(m_character_model);
+                        if (m_animation_system.is_ik_enabled() && character) {
+                            m_animation_system.apply_ik(*m_scene, *character,
+                                                        m_ik_target_position);
+                        }
+                    })
+        .reads<hz::TransformComponent, hz::MeshComponent>()
+        .writes<hz::AnimatorComponent, AnimationSystem>();
+
+    // VFX cleanup records destroys on the scene's command buffer
+    loop.add_system("lifetime",
+                    [this](hz::f64 dt) {
+                        m_lifetime_system.update(*m_scene, static_cast<float>(dt));
+                    })
+        .writes<hz::LifetimeComponent, hz::CommandBuffer>();
+
+    // Structural sync point: applies everything recorded this tick
+    loop.add_system("scene_commands", [this](hz::f64) { m_scene->flush_commands(); })
+        .exclusive();
+}
 
+void Application::on_update([[maybe_unused]] float dt) {
     // Menu/close
     if (m_input->is_action_just_pressed(hz::InputManager::ACTION_MENU)) {
         m_window->close();
@@ -354,6 +420,17 @@ void Application::on_update(float dt) {
 }
 
 void Application::on_render([[maybe_unused]] float alpha) {
+    // Upload what finished streaming and plan mips from last frame's requests; models stay
+    // undrawn until resident
+    m_assets->update_streaming();
+    on_assets_streamed();
+    hz::Model* chest = m_assets->get_model(m_test_model);
+    hz::Model* character = m_assets->get_model(m_character_model);
+
+    // Resolve world matrices once for every pass below
+    m_scene->update_world_transforms();
+    const hz::WorldTransformCache& world = m_scene->world_transforms();
+
     // Lights
     std::vector<hz::GPUPointLight> point_lights = {
         {{-10.0f, 10.0f, 10.0f, 15.0f}, {300.0f, 300.0f, 300.0f, 5.0f}},
@@ -390,37 +467,37 @@ void Application::on_render([[maybe_unused]] float alpha) {
         for (auto [entity, tc, mc] : view.each()) {
             if (mc.mesh_type == hz::MeshComponent::MeshType::Primitive &&
                 mc.primitive_name == "sphere") {
-                m_shadow_shader->set_mat4("u_Model", tc.get_transform());
+                m_shadow_shader->set_mat4("u_Model", world.world_matrix(entity));
                 m_sphere_mesh->draw();
             }
         }
     }
 
     // Shadow: treasure chest
-    if (m_show_model && m_test_model && m_test_model->is_valid()) {
+    if (m_show_model && chest) {
         auto view = m_scene->registry().view<hz::TransformComponent, hz::MeshComponent>();
         for (auto [entity, tc, mc] : view.each()) {
-            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model.index == 0) {
+            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model == m_test_model) {
                 glDisable(GL_CULL_FACE);
-                m_shadow_shader->set_mat4("u_Model", tc.get_transform());
-                m_test_model->draw();
+                m_shadow_shader->set_mat4("u_Model", world.world_matrix(entity));
+                chest->draw();
                 glEnable(GL_CULL_FACE);
             }
         }
     }
 
     // Shadow: character
-    if (m_character_model && m_character_model->is_valid()) {
+    if (character) {
         auto view = m_scene->registry()
                         .view<hz::TransformComponent, hz::MeshComponent, hz::AnimatorComponent>();
         for (auto [entity, tc, mc, ac] : view.each()) {
-            m_shadow_shader->set_mat4("u_Model", tc.get_transform());
+            m_shadow_shader->set_mat4("u_Model", world.world_matrix(entity));
             m_shadow_shader->set_bool("u_HasAnimation", true);
             if (!ac.bone_transforms.empty()) {
                 m_shadow_shader->set_mat4_array("u_BoneMatrices", ac.bone_transforms.data(),
                                                 ac.bone_transforms.size());
             }
-            m_character_model->draw();
+            character->draw();
             m_shadow_shader->set_bool("u_HasAnimation", false);
         }
     }
@@ -472,7 +549,7 @@ void Application::on_render([[maybe_unused]] float alpha) {
                 continue;
             }
 
-            m_geometry_shader->set_mat4("u_Model", tc.get_transform());
+            m_geometry_shader->set_mat4("u_Model", world.world_matrix(entity));
             m_geometry_shader->set_bool("u_UseAlbedoMap", false);
             m_geometry_shader->set_bool("u_UseNormalMap", false);
             m_geometry_shader->set_bool("u_UseMetallicRoughnessMap", false);
@@ -493,26 +570,35 @@ void Application::on_render([[maybe_unused]] float alpha) {
         }
     }
 
-    // Render treasure chest
-    if (m_show_model && m_test_model && m_test_model->is_valid()) {
+    // Render treasure chest; textures still streaming fall back to the constants below
+    if (m_show_model && chest) {
         auto view = m_scene->registry().view<hz::TransformComponent, hz::MeshComponent>();
         for (auto [entity, tc, mc] : view.each()) {
-            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model.index == 0) {
+            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model == m_test_model) {
+                // Mip levels for the chest's screen size, planned by the next update_streaming()
+                const glm::mat4& model_matrix = world.world_matrix(entity);
+                const float radius = GameConfig::CHEST_BOUNDING_RADIUS *
+                                     glm::max(tc.scale.x, glm::max(tc.scale.y, tc.scale.z));
+                const float distance =
+                    glm::distance(camera.position(), glm::vec3(model_matrix[3]));
+                hz::request_material_textures(
+                    m_chest_material,
+                    hz::TextureResidency::projected_size(
+                        radius, distance, glm::radians(camera.fov),
+                        static_cast<float>(GameConfig::WINDOW_HEIGHT)),
+                    *m_assets);
+
                 glDisable(GL_CULL_FACE);
-                if (m_albedo_tex)
-                    m_albedo_tex->bind(0);
-                if (m_normal_tex)
-                    m_normal_tex->bind(1);
-                if (m_arm_tex)
-                    m_arm_tex->bind(2);
-
-                m_geometry_shader->set_mat4("u_Model", tc.get_transform());
-                m_geometry_shader->set_bool("u_UseAlbedoMap",
-                                            m_albedo_tex && m_albedo_tex->is_valid());
-                m_geometry_shader->set_bool("u_UseNormalMap",
-                                            m_normal_tex && m_normal_tex->is_valid());
-                m_geometry_shader->set_bool("u_UseMetallicRoughnessMap",
-                                            m_arm_tex && m_arm_tex->is_valid());
+                m_geometry_shader->set_mat4("u_Model", model_matrix);
+                m_geometry_shader->set_bool(
+                    "u_UseAlbedoMap",
+                    hz::bind_material_texture(m_chest_material.albedo_tex, 0, *m_assets));
+                m_geometry_shader->set_bool(
+                    "u_UseNormalMap",
+                    hz::bind_material_texture(m_chest_material.normal_tex, 1, *m_assets));
+                m_geometry_shader->set_bool(
+                    "u_UseMetallicRoughnessMap",
+                    hz::bind_material_texture(m_chest_material.metallic_tex, 2, *m_assets));
                 m_geometry_shader->set_bool("u_UseAOMap", false);
                 m_geometry_shader->set_bool("u_UseEmissionMap", false);
                 m_geometry_shader->set_vec3("u_AlbedoColor", glm::vec3(1.0f));
@@ -522,24 +608,24 @@ void Application::on_render([[maybe_unused]] float alpha) {
                 m_geometry_shader->set_vec3("u_EmissionColor", glm::vec3(0.0f));
                 m_geometry_shader->set_float("u_EmissionStrength", 0.0f);
 
-                m_test_model->draw();
+                chest->draw();
                 glEnable(GL_CULL_FACE);
             }
         }
     }
 
     // Render character
-    if (m_character_model) {
+    if (character) {
         auto view = m_scene->registry().view<hz::TransformComponent, hz::MeshComponent>();
         for (auto entity : view) {
-            auto& tc = view.get<hz::TransformComponent>(entity);
             auto& mc = view.get<hz::MeshComponent>(entity);
 
-            if (mc.mesh_type != hz::MeshComponent::MeshType::Model || mc.model.index != 1) {
+            if (mc.mesh_type != hz::MeshComponent::MeshType::Model ||
+                mc.model != m_character_model) {
                 continue;
             }
 
-            m_geometry_shader->set_mat4("u_Model", tc.get_transform());
+            m_geometry_shader->set_mat4("u_Model", world.world_matrix(entity));
 
             bool has_anim = false;
             if (auto* ac = m_scene->registry().try_get<hz::AnimatorComponent>(entity)) {
@@ -555,9 +641,8 @@ void Application::on_render([[maybe_unused]] float alpha) {
             bool has_albedo = false, has_normal = false, has_mr = false;
             bool has_ao = false, has_emission = false;
 
-            if (m_character_model->has_fbx_materials() &&
-                !m_character_model->fbx_materials().empty()) {
-                const auto& mat = m_character_model->fbx_materials()[0];
+            if (character->has_fbx_materials() && !character->fbx_materials().empty()) {
+                const auto& mat = character->fbx_materials()[0];
                 if (mat.albedo_texture && mat.albedo_texture->is_valid()) {
                     mat.albedo_texture->bind(0);
                     has_albedo = true;
@@ -594,7 +679,7 @@ void Application::on_render([[maybe_unused]] float alpha) {
             m_geometry_shader->set_bool("u_UseEmissionMap", has_emission);
 
             glDisable(GL_CULL_FACE);
-            m_character_model->draw();
+            character->draw();
             glEnable(GL_CULL_FACE);
             m_geometry_shader->set_bool("u_HasAnimation", false);
         }
@@ -615,15 +700,15 @@ void Application::on_render([[maybe_unused]] float alpha) {
     m_renderer->render_to_screen();
 
     // === Debug Skeleton ===
-    if (m_show_skeleton && m_character_model && m_character_model->is_valid() &&
-        m_character_model->has_skeleton()) {
+    if (m_show_skeleton && character && character->has_skeleton()) {
         auto view = m_scene->registry()
                         .view<hz::TransformComponent, hz::MeshComponent, hz::AnimatorComponent>();
         for (auto [entity, tc, mc, ac] : view.each()) {
-            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model.index == 1) {
-                m_debug_renderer->draw_skeleton(*m_character_model->skeleton(), ac.bone_transforms,
-                                                tc.get_transform(), glm::vec3(0.0f, 1.0f, 0.0f),
-                                                glm::vec3(1.0f, 1.0f, 0.0f));
+            if (mc.mesh_type == hz::MeshComponent::MeshType::Model &&
+                mc.model == m_character_model) {
+                m_debug_renderer->draw_skeleton(
+                    *character->skeleton(), ac.bone_transforms, world.world_matrix(entity),
+                    glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f));
             }
         }
         glm::mat4 debug_vp =
@@ -659,13 +744,14 @@ void Application::on_render([[maybe_unused]] float alpha) {
     if (m_show_model) {
         auto view = m_scene->registry().view<hz::TransformComponent, hz::MeshComponent>();
         for (auto [entity, tc, mc] : view.each()) {
-            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model.index == 0) {
+            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model == m_test_model) {
                 ImGui::SeparatorText("Model transform");
                 ImGui::DragFloat3("Position", &tc.position.x, 0.05f);
                 ImGui::DragFloat3("Rotation", &tc.rotation.x, 1.0f);
                 ImGui::DragFloat3("Scale", &tc.scale.x, 0.05f, 0.01f, 50.0f);
             }
-            if (mc.mesh_type == hz::MeshComponent::MeshType::Model && mc.model.index == 1) {
+            if (mc.mesh_type == hz::MeshComponent::MeshType::Model &&
+                mc.model == m_character_model) {
                 ImGui::SeparatorText("Character Transform");
                 ImGui::DragFloat3("Char Pos", &tc.position.x, 0.05f);
                 ImGui::DragFloat3("Char Rot", &tc.rotation.x, 1.0f);
@@ -697,10 +783,12 @@ void Application::on_render([[maybe_unused]] float alpha) {
 }
 
 void Application::shutdown() {
+    m_assets.reset(); // Stops the streaming threads; GL objects go while the context is current
     m_imgui->shutdown();
     m_renderer->shutdown();
     m_physics->shutdown();
     m_audio->shutdown();
+    hz::JobSystem::shutdown();
     hz::MemoryContext::shutdown();
     hz::Log::shutdown();
 }
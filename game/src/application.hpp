@@ -15,8 +15,7 @@
 #include <memory>
 #include <optional>
 
-#include <engine/assets/model.hpp>
-#include <engine/assets/texture.hpp>
+#include <engine/assets/asset_registry.hpp>
 #include <engine/audio/audio_engine.hpp>
 #include <engine/core/game_loop.hpp>
 #include <engine/physics/physics_world.hpp>
@@ -73,6 +72,7 @@ private:
     std::unique_ptr<hz::PhysicsWorld> m_physics;
     std::unique_ptr<hz::DebugRenderer> m_debug_renderer;
     std::unique_ptr<hz::IBL> m_ibl;
+    std::unique_ptr<hz::AssetRegistry> m_assets;
 
     // Game systems
     PlayerSystem m_player_system;
@@ -85,16 +85,16 @@ private:
     std::unique_ptr<hz::gl::Shader> m_geometry_shader;
     std::unique_ptr<hz::gl::Shader> m_shadow_shader;
 
-    // Models & Meshes (optional because they are created during init)
+    // Meshes (optional because they are created during init)
     std::optional<hz::Mesh> m_sphere_mesh;
     std::optional<hz::Mesh> m_cube_mesh;
-    std::optional<hz::Model> m_test_model;      // Treasure chest
-    std::optional<hz::Model> m_character_model; // Character
 
-    // Textures (optional)
-    std::optional<hz::Texture> m_albedo_tex;
-    std::optional<hz::Texture> m_normal_tex;
-    std::optional<hz::Texture> m_arm_tex;
+    // Streamed models and textures; not drawn or bound until resident
+    hz::ModelHandle m_test_model;      // Treasure chest
+    hz::ModelHandle m_character_model; // Character
+    hz::Material m_chest_material;     // Textures only; metallic_tex holds the packed ARM map
+    hz::Entity m_character_entity{entt::null};
+    bool m_character_ready{false}; // Animation set up from the resident model
 
     // IBL textures
     GLuint m_irradiance_map{0};
@@ -121,8 +121,10 @@ private:
     void init_scene();
     void load_assets();
     void setup_scene_entities();
+    void on_assets_streamed();
 
     // Game loop callbacks
+    void register_systems(hz::GameLoop& loop);
     void on_update(float dt);
     void on_render(float alpha);
 
@@ -62,4 +62,10 @@ constexpr float PBR_GRID_SPACING = 2.5f;
 constexpr float CHARACTER_EYE_OFFSET = 1.5f;     // How far below camera the character is
 constexpr float CHARACTER_FORWARD_OFFSET = 0.4f; // How far in front of camera
 
+// =============================================================================
+// Asset Streaming
+// =============================================================================
+constexpr unsigned long long TEXTURE_BUDGET_BYTES = 256ull << 20; // VRAM for streamed mips
+constexpr float CHEST_BOUNDING_RADIUS = 1.75f; // Sphere around the chest's unit box collider
+
 } // namespace GameConfig
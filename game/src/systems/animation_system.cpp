@@ -6,6 +6,7 @@
 #include "animation_system.hpp"
 
 #include <engine/core/log.hpp>
+#include <engine/scene/parallel.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace game {
@@ -25,10 +26,9 @@ void AnimationSystem::init(hz::Model& character_model) {
 }
 
 void AnimationSystem::update(hz::Scene& scene, float dt) {
-    auto view = scene.registry().view<hz::AnimatorComponent>();
-    for (auto [entity, animator] : view.each()) {
-        animator.update(dt);
-    }
+    // Each animator only writes its own bone transforms
+    hz::parallel_each(scene.registry().view<hz::AnimatorComponent>(),
+                      [dt](hz::Entity, hz::AnimatorComponent& animator) { animator.update(dt); });
 }
 
 void AnimationSystem::apply_ik(hz::Scene& scene, hz::Model& character_model,
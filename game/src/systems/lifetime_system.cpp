@@ -5,25 +5,20 @@
 
 #include "lifetime_system.hpp"
 
-#include <vector>
+#include <engine/scene/parallel.hpp>
 
 namespace game {
 
 void LifetimeSystem::update(hz::Scene& scene, float dt) {
-    auto view = scene.registry().view<hz::LifetimeComponent>();
-
-    std::vector<hz::Entity> to_destroy;
-
-    for (auto [entity, lifetime] : view.each()) {
-        lifetime.time_remaining -= dt;
-        if (lifetime.time_remaining <= 0.0f) {
-            to_destroy.push_back(entity);
-        }
-    }
-
-    for (auto entity : to_destroy) {
-        scene.destroy_entity(entity);
-    }
+    // Expired entities are destroyed at the scene's next flush_commands()
+    hz::parallel_each(scene.registry().view<hz::LifetimeComponent>(), scene.commands(),
+                      [dt](hz::CommandList& commands, hz::Entity entity,
+                           hz::LifetimeComponent& lifetime) {
+                          lifetime.time_remaining -= dt;
+                          if (lifetime.time_remaining <= 0.0f) {
+                              commands.destroy(entity);
+                          }
+                      });
 }
 
 } // namespace game
@@ -12,6 +12,8 @@ namespace game {
 
 /**
  * @brief Manages entity lifetimes - destroys entities when their lifetime expires
+ *
+ * Destruction is recorded on the scene's command buffer.
  */
 class LifetimeSystem {
 public:
@@ -0,0 +1,171 @@
+/**
+ * @file test_alloc_tracker.cpp
+ * @brief Unit tests for allocation tracking
+ */
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/alloc_tracker.hpp>
+#include <engine/core/handle_pool.hpp>
+#include <engine/core/log.hpp>
+#include <engine/core/memory.hpp>
+#include <engine/core/profiler.hpp>
+
+using namespace hz;
+
+// ============================================================================
+// PMR Counting
+// ============================================================================
+
+TEST_CASE("CountingResource counts allocations", "[core][alloc]") {
+    std::pmr::monotonic_buffer_resource upstream;
+    CountingResource counting(&upstream);
+
+    AllocCounterScope scope;
+    {
+        std::pmr::vector<u32> values(&counting);
+        values.reserve(16);
+        values.reserve(64);
+    }
+
+    REQUIRE(counting.allocations() == 2);
+    REQUIRE(counting.deallocations() == 2);
+    REQUIRE(counting.bytes_allocated() == 80 * sizeof(u32));
+    REQUIRE(scope.counters().pmr_allocations == 2);
+    REQUIRE(scope.counters().pmr_bytes == 80 * sizeof(u32));
+}
+
+TEST_CASE("Thread counters only see the calling thread", "[core][alloc]") {
+    std::pmr::monotonic_buffer_resource upstream;
+    CountingResource counting(&upstream);
+
+    AllocCounterScope scope;
+    std::thread other([&] { (void)counting.allocate(32); });
+    other.join();
+
+    REQUIRE(counting.allocations() == 1);
+    REQUIRE(scope.counters().pmr_allocations == 0);
+}
+
+TEST_CASE("AllocTracker samples all threads per frame", "[core][alloc]") {
+    std::pmr::monotonic_buffer_resource upstream;
+    CountingResource counting(&upstream);
+
+    AllocTracker::end_frame();
+    (void)counting.allocate(16);
+    std::thread other([&] { (void)counting.allocate(16); });
+    other.join();
+    AllocTracker::end_frame();
+    REQUIRE(AllocTracker::last_frame().pmr_allocations == 2);
+
+    AllocTracker::end_frame();
+    REQUIRE(AllocTracker::last_frame().pmr_allocations == 0);
+}
+
+TEST_CASE("Memory domains report to the allocation tracker", "[core][alloc]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    MemoryContext::init();
+
+    AllocCounterScope scope;
+    {
+        std::pmr::vector<u64> values(MemoryContext::get(MemoryDomain::General));
+        values.resize(8);
+    }
+    REQUIRE(scope.counters().pmr_allocations == 1);
+
+    // Frame arena bumps are free by design and are not counted
+    AllocCounterScope frame_scope;
+    {
+        std::pmr::vector<u64> values(MemoryContext::get(MemoryDomain::Frame));
+        values.resize(8);
+    }
+    REQUIRE(frame_scope.allocations() == 0);
+
+    MemoryContext::shutdown();
+    Log::shutdown();
+}
+
+TEST_CASE("Profiler zones record their allocations", "[core][alloc][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    // Stack-backed, so heap hooks see nothing but the profiler's own work
+    std::byte buffer[256];
+    std::pmr::monotonic_buffer_resource upstream(buffer, sizeof(buffer),
+                                                 std::pmr::null_memory_resource());
+    CountingResource counting(&upstream);
+
+    // The first zone on a thread registers its ring (heap allocations)
+    {
+        ProfileScope warm_up("warm up");
+    }
+    Profiler::end_frame();
+
+    {
+        ProfileScope outer("outer");
+        (void)counting.allocate(8);
+        {
+            ProfileScope inner("inner");
+            (void)counting.allocate(8);
+        }
+    }
+    Profiler::end_frame();
+
+    const auto& zones = Profiler::last_frame().zones;
+    REQUIRE(zones.size() == 2);
+    REQUIRE(zones[0].allocations == 2); // Includes the child zone
+    REQUIRE(zones[1].allocations == 1);
+
+    Log::shutdown();
+}
+
+// ============================================================================
+// Heap Hooks
+// ============================================================================
+
+#ifdef HZ_ALLOC_TRACKING
+TEST_CASE("Global operator new is counted", "[core][alloc]") {
+    // Called directly: unused new-expressions may be optimized away
+    AllocCounterScope scope;
+    void* block = ::operator new(64);
+    void* array = ::operator new[](128, std::align_val_t{64});
+    ::operator delete[](array, std::align_val_t{64});
+    ::operator delete(block);
+
+    const AllocCounters counters = scope.counters();
+    REQUIRE(counters.heap_allocations == 2);
+    REQUIRE(counters.heap_frees == 2);
+    REQUIRE(counters.heap_bytes == 192);
+}
+
+TEST_CASE("Steady-state HandlePool churn does not allocate", "[core][alloc]") {
+    struct Item {
+        f32 value{0.0f};
+    };
+
+    HandlePool<Item> pool;
+    pool.reserve(256);
+    std::vector<HandlePool<Item>::HandleType> handles;
+    handles.reserve(256);
+
+    AllocCounterScope scope;
+    {
+        NoAllocScope no_alloc; // Aborts with the allocation size if this regresses
+        for (int frame = 0; frame < 10; ++frame) {
+            for (int i = 0; i < 256; ++i) {
+                handles.push_back(pool.emplace());
+            }
+            for (auto handle : handles) {
+                pool.erase(handle);
+            }
+            handles.clear();
+        }
+    }
+    REQUIRE(scope.counters().heap_allocations == 0);
+}
+#endif
@@ -0,0 +1,165 @@
+/**
+ * @file test_asset_streaming.cpp
+ * @brief Unit tests for the asset streamer, off-thread decoding and streamed registry loads
+ *
+ * Uploads need a GL context, so registry tests cover only loads that fail
+ * before reaching GL.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/assets/asset_registry.hpp>
+#include <engine/assets/asset_streamer.hpp>
+#include <engine/core/log.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hz;
+
+namespace {
+// 2x2 binary PGM, rows {1, 2} and {3, 4}
+std::vector<u8> make_pgm() {
+    const std::string header = "P5\n2 2\n255\n";
+    std::vector<u8> bytes(header.begin(), header.end());
+    bytes.insert(bytes.end(), {1, 2, 3, 4});
+    return bytes;
+}
+
+/// Call update_streaming() until nothing is streaming, or give up after a second
+void drain(AssetRegistry& registry) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (registry.streaming_count() > 0 && std::chrono::steady_clock::now() < deadline) {
+        registry.update_streaming();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+} // namespace
+
+// ============================================================================
+// AssetStreamer Tests
+// ============================================================================
+
+TEST_CASE("AssetStreamer runs work inline until started", "[assets][streaming]") {
+    AssetStreamer streamer;
+    const auto caller = std::this_thread::get_id();
+    std::thread::id ran_on;
+    streamer.submit([&ran_on] { ran_on = std::this_thread::get_id(); });
+    REQUIRE(ran_on == caller);
+    REQUIRE_FALSE(streamer.is_running());
+}
+
+TEST_CASE("AssetStreamer runs all work on its threads", "[assets][streaming]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    constexpr u32 WORK_COUNT = 64;
+    std::atomic<u32> done{0};
+    std::atomic<bool> on_caller{false};
+    const auto caller = std::this_thread::get_id();
+    {
+        AssetStreamer streamer;
+        streamer.start(2);
+        REQUIRE(streamer.is_running());
+        for (u32 i = 0; i < WORK_COUNT; ++i) {
+            streamer.submit([&] {
+                if (std::this_thread::get_id() == caller) {
+                    on_caller = true;
+                }
+                done.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        while (done.load() < WORK_COUNT) {
+            std::this_thread::yield();
+        }
+        REQUIRE(streamer.queued() == 0);
+    }
+    REQUIRE(done.load() == WORK_COUNT);
+    REQUIRE_FALSE(on_caller.load());
+    Log::shutdown();
+}
+
+// ============================================================================
+// Decoding Tests
+// ============================================================================
+
+TEST_CASE("Texture decodes without a GL context", "[assets][streaming]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const std::vector<u8> pgm = make_pgm();
+
+    SECTION("As stored") {
+        const TextureImage image = Texture::decode_memory(pgm.data(), pgm.size());
+        REQUIRE(image.is_valid());
+        REQUIRE(image.width == 2);
+        REQUIRE(image.height == 2);
+        REQUIRE(image.format == TextureFormat::R8);
+        REQUIRE(image.pixels == std::vector<u8>{1, 2, 3, 4});
+    }
+    SECTION("Flipped") {
+        TextureParams params;
+        params.flip_y = true;
+        const TextureImage image = Texture::decode_memory(pgm.data(), pgm.size(), params);
+        REQUIRE(image.pixels == std::vector<u8>{3, 4, 1, 2});
+    }
+    SECTION("Corrupt") {
+        const std::vector<u8> bad = {'n', 'o', 'p', 'e'};
+        REQUIRE_FALSE(Texture::decode_memory(bad.data(), bad.size()).is_valid());
+        REQUIRE_FALSE(Texture::decode_file("horizon_test_missing.png").is_valid());
+    }
+    Log::shutdown();
+}
+
+TEST_CASE("Model material textures decode ahead of upload", "[assets][streaming]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    ModelData data;
+    MaterialData material;
+    material.albedo_texture.embedded = make_pgm();
+    material.normal_texture.path = "horizon_test_missing.png";
+    data.materials.push_back(material);
+
+    Model::decode_textures(data);
+    REQUIRE(data.materials[0].albedo_texture.image.is_valid());
+    REQUIRE(data.materials[0].albedo_texture.image.pixels.size() == 4);
+    REQUIRE_FALSE(data.materials[0].normal_texture.image.is_valid());
+    REQUIRE_FALSE(data.materials[0].ao_texture.image.is_valid());
+    Log::shutdown();
+}
+
+// ============================================================================
+// Registry Streaming Tests
+// ============================================================================
+
+TEST_CASE("Streamed model that fails to load", "[assets][streaming]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    AssetRegistry registry;
+
+    const ModelHandle handle = registry.load_model_async("horizon_test_missing.obj");
+    REQUIRE(handle.is_valid());
+    REQUIRE(registry.load_model_async("horizon_test_missing.obj") == handle);
+    REQUIRE(registry.get_model(handle) == nullptr);
+
+    drain(registry);
+    REQUIRE(registry.streaming_count() == 0);
+    REQUIRE(registry.model_state(handle) == AssetState::Failed);
+    REQUIRE(registry.get_model(handle) == nullptr);
+    REQUIRE_FALSE(registry.reload_model(handle));
+    Log::shutdown();
+}
+
+TEST_CASE("Registry clear drops streaming results", "[assets][streaming]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    AssetRegistry registry;
+
+    const ModelHandle handle = registry.load_model_async("horizon_test_missing_a.obj");
+    REQUIRE(registry.model_state(handle) == AssetState::Pending);
+    registry.clear();
+    REQUIRE(registry.streaming_count() == 0);
+
+    // Reuses slot 0; a late result for the cleared request must not resolve it
+    const ModelHandle next = registry.load_model_async("horizon_test_missing_b.obj");
+    REQUIRE(next == handle);
+    drain(registry);
+    REQUIRE(registry.model_state(next) == AssetState::Failed);
+    REQUIRE(registry.streaming_count() == 0);
+    Log::shutdown();
+}
@@ -0,0 +1,335 @@
+/**
+ * @file test_block_compression.cpp
+ * @brief Unit tests for the BC encoder, decoder and cooked (.dds) textures
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/assets/block_compression.hpp>
+#include <engine/assets/cooked_texture.hpp>
+#include <engine/core/log.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace hz;
+
+namespace {
+std::filesystem::path temp_path(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+/// Diagonal RGBA gradient with a little per-pixel noise in blue
+std::vector<u8> make_image(u32 width, u32 height) {
+    std::vector<u8> rgba(static_cast<usize>(width) * height * 4);
+    for (u32 y = 0; y < height; ++y) {
+        for (u32 x = 0; x < width; ++x) {
+            const u32 t = (x + y) * 255 / (width + height - 2);
+            u8* pixel = &rgba[(static_cast<usize>(y) * width + x) * 4];
+            pixel[0] = static_cast<u8>(t);
+            pixel[1] = static_cast<u8>(255 - t / 2);
+            pixel[2] = static_cast<u8>(64 + t / 4 + (x * 7 + y * 13) % 4);
+            pixel[3] = static_cast<u8>(255 - t / 4);
+        }
+    }
+    return rgba;
+}
+
+/// Root mean square difference over the given channels
+double rms_error(const std::vector<u8>& a, const std::vector<u8>& b, u32 channels) {
+    double sum = 0.0;
+    usize count = 0;
+    for (usize i = 0; i < a.size(); i += 4) {
+        for (u32 c = 0; c < channels; ++c) {
+            const double diff = static_cast<double>(a[i + c]) - static_cast<double>(b[i + c]);
+            sum += diff * diff;
+            ++count;
+        }
+    }
+    return std::sqrt(sum / static_cast<double>(count));
+}
+
+std::vector<u8> round_trip(TextureFormat format, const std::vector<u8>& rgba, u32 width,
+                           u32 height) {
+    const std::vector<u8> blocks = compress_image(format, rgba.data(), width, height);
+    REQUIRE(blocks.size() == compressed_size(format, width, height));
+    std::vector<u8> decoded = decompress_image(format, blocks.data(), width, height);
+    REQUIRE(decoded.size() == rgba.size());
+    return decoded;
+}
+
+std::vector<char> read_bytes(const std::filesystem::path& path) {
+    std::vector<char> bytes(std::filesystem::file_size(path));
+    std::ifstream(path, std::ios::binary)
+        .read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    return bytes;
+}
+
+void write_bytes(const std::filesystem::path& path, const std::vector<char>& bytes) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc)
+        .write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+} // namespace
+
+// ============================================================================
+// Codec Tests
+// ============================================================================
+
+TEST_CASE("Block sizes follow the format", "[assets][compression]") {
+    REQUIRE(block_bytes(TextureFormat::RGBA8) == 0);
+    REQUIRE(block_bytes(TextureFormat::BC1) == 8);
+    REQUIRE(block_bytes(TextureFormat::BC7_SRGB) == 16);
+    REQUIRE(compressed_size(TextureFormat::BC1, 4, 4) == 8);
+    REQUIRE(compressed_size(TextureFormat::BC1, 1, 1) == 8);
+    REQUIRE(compressed_size(TextureFormat::BC3, 5, 9) == 2 * 3 * 16);
+    REQUIRE(mip_extent(256, 3) == 32);
+    REQUIRE(mip_extent(256, 10) == 1);
+}
+
+TEST_CASE("Compressed images decode close to the source", "[assets][compression]") {
+    const u32 width = 64;
+    const u32 height = 48;
+    const std::vector<u8> rgba = make_image(width, height);
+
+    SECTION("BC1") {
+        REQUIRE(rms_error(rgba, round_trip(TextureFormat::BC1, rgba, width, height), 3) < 3.0);
+    }
+    SECTION("BC3") {
+        REQUIRE(rms_error(rgba, round_trip(TextureFormat::BC3, rgba, width, height), 4) < 3.0);
+    }
+    SECTION("BC5") {
+        REQUIRE(rms_error(rgba, round_trip(TextureFormat::BC5, rgba, width, height), 2) < 1.0);
+    }
+    SECTION("BC7") {
+        const auto decoded = round_trip(TextureFormat::BC7, rgba, width, height);
+        REQUIRE(rms_error(rgba, decoded, 4) < 1.5);
+        const auto bc1 = round_trip(TextureFormat::BC1, rgba, width, height);
+        REQUIRE(rms_error(rgba, decoded, 3) < rms_error(rgba, bc1, 3));
+    }
+}
+
+TEST_CASE("Solid blocks decode exactly where the format allows", "[assets][compression]") {
+    std::vector<u8> rgba(16 * 4);
+    for (usize i = 0; i < rgba.size(); i += 4) {
+        rgba[i + 0] = 255;
+        rgba[i + 1] = 0;
+        rgba[i + 2] = 255;
+        rgba[i + 3] = 200;
+    }
+    u8 block[16];
+    std::vector<u8> decoded(16 * 4);
+
+    encode_block(TextureFormat::BC1, rgba.data(), block);
+    REQUIRE(decode_block(TextureFormat::BC1, block, decoded.data()));
+    REQUIRE(decoded[0] == 255);
+    REQUIRE(decoded[1] == 0);
+    REQUIRE(decoded[2] == 255);
+    REQUIRE(decoded[3] == 255);
+
+    encode_block(TextureFormat::BC3, rgba.data(), block);
+    REQUIRE(decode_block(TextureFormat::BC3, block, decoded.data()));
+    REQUIRE(decoded[3] == 200);
+
+    encode_block(TextureFormat::BC7, rgba.data(), block);
+    REQUIRE(decode_block(TextureFormat::BC7, block, decoded.data()));
+    for (usize i = 0; i < rgba.size(); ++i) {
+        REQUIRE(std::abs(static_cast<int>(decoded[i]) - static_cast<int>(rgba[i])) <= 1);
+    }
+}
+
+TEST_CASE("BC7 blocks swap endpoints to fit the anchor index", "[assets][compression]") {
+    // Pixel 0 at the far end of the line needs the endpoints swapped, since the
+    // anchor index is stored without its top bit
+    std::vector<u8> rgba(16 * 4);
+    for (u32 i = 0; i < 16; ++i) {
+        const auto value = static_cast<u8>(255 - i * 17);
+        rgba[i * 4 + 0] = value;
+        rgba[i * 4 + 1] = value;
+        rgba[i * 4 + 2] = static_cast<u8>(255 - value);
+        rgba[i * 4 + 3] = 255;
+    }
+    u8 block[16];
+    encode_block(TextureFormat::BC7, rgba.data(), block);
+    REQUIRE((block[0] & 0x7F) == 0x40); // Mode 6
+
+    std::vector<u8> decoded(16 * 4);
+    REQUIRE(decode_block(TextureFormat::BC7, block, decoded.data()));
+    REQUIRE(rms_error(rgba, decoded, 4) < 3.0);
+}
+
+TEST_CASE("BC7 blocks in other modes are rejected", "[assets][compression]") {
+    u8 block[16] = {0x01}; // Mode 0
+    std::vector<u8> decoded(16 * 4);
+    REQUIRE_FALSE(decode_block(TextureFormat::BC7, block, decoded.data()));
+    REQUIRE_FALSE(decode_block(TextureFormat::RGBA8, block, decoded.data()));
+}
+
+// ============================================================================
+// Mip Chain Tests
+// ============================================================================
+
+TEST_CASE("Mip chains go down to 1x1", "[assets][compression]") {
+    TextureImage image;
+    image.width = 40;
+    image.height = 10;
+    image.format = TextureFormat::RGBA8;
+    image.pixels = make_image(image.width, image.height);
+
+    const TextureImage compressed = compress_texture(image, TextureFormat::BC7, true);
+    REQUIRE(compressed.format == TextureFormat::BC7);
+    REQUIRE(compressed.mip_count == 6); // 40, 20, 10, 5, 2, 1
+
+    usize expected = 0;
+    for (u32 level = 0; level < compressed.mip_count; ++level) {
+        expected += compressed_size(TextureFormat::BC7, mip_extent(40, level),
+                                    mip_extent(10, level));
+    }
+    REQUIRE(compressed.pixels.size() == expected);
+
+    // Already compressed or uncompressed targets are refused
+    REQUIRE_FALSE(compress_texture(compressed, TextureFormat::BC1, false).is_valid());
+    REQUIRE_FALSE(compress_texture(image, TextureFormat::RGBA8, false).is_valid());
+}
+
+TEST_CASE("Dropping top mips keeps the rest of the chain", "[assets][compression]") {
+    TextureImage image;
+    image.width = 40;
+    image.height = 10;
+    image.format = TextureFormat::SRGBA8;
+    image.pixels = make_image(image.width, image.height);
+    REQUIRE(full_mip_count(40, 10) == 6);
+
+    SECTION("Compressed") {
+        const TextureImage compressed = compress_texture(image, TextureFormat::BC1, true);
+        const TextureImage dropped = drop_top_mips(compressed, 2);
+        REQUIRE(dropped.width == 10);
+        REQUIRE(dropped.height == 2);
+        REQUIRE(dropped.mip_count == 4);
+        const usize top = compressed_size(TextureFormat::BC1, 40, 10) +
+                          compressed_size(TextureFormat::BC1, 20, 5);
+        REQUIRE(dropped.pixels.size() == compressed.pixels.size() - top);
+        REQUIRE(dropped.pixels[0] == compressed.pixels[top]);
+
+        REQUIRE(drop_top_mips(compressed, 99).mip_count == 1); // Clamped to 1x1
+    }
+    SECTION("Uncompressed") {
+        const TextureImage dropped = drop_top_mips(image, 1);
+        REQUIRE(dropped.width == 20);
+        REQUIRE(dropped.height == 5);
+        REQUIRE(dropped.format == TextureFormat::SRGBA8);
+        REQUIRE(dropped.pixels ==
+                downsample_image(image.pixels.data(), image.width, image.height, true));
+        REQUIRE(drop_top_mips(image, 0).pixels == image.pixels);
+    }
+}
+
+TEST_CASE("sRGB downsampling averages in linear light", "[assets][compression]") {
+    // Alternating black and white columns
+    std::vector<u8> rgba(2 * 2 * 4);
+    for (u32 i = 0; i < 4; ++i) {
+        const u8 value = (i % 2 == 0) ? 0 : 255;
+        rgba[i * 4 + 0] = value;
+        rgba[i * 4 + 1] = value;
+        rgba[i * 4 + 2] = value;
+        rgba[i * 4 + 3] = value;
+    }
+
+    const std::vector<u8> linear = downsample_image(rgba.data(), 2, 2, false);
+    const std::vector<u8> srgb = downsample_image(rgba.data(), 2, 2, true);
+    REQUIRE(linear.size() == 4);
+    REQUIRE(std::abs(static_cast<int>(linear[0]) - 128) <= 1);
+    // Half of linear white is 188 in sRGB; alpha stays a plain average
+    REQUIRE(std::abs(static_cast<int>(srgb[0]) - 188) <= 1);
+    REQUIRE(std::abs(static_cast<int>(srgb[3]) - 128) <= 1);
+}
+
+// ============================================================================
+// DDS Tests
+// ============================================================================
+
+TEST_CASE("DDS files round-trip every mip", "[assets][compression]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_texture.dds");
+
+    TextureImage image;
+    image.width = 32;
+    image.height = 16;
+    image.format = TextureFormat::RGBA8;
+    image.pixels = make_image(image.width, image.height);
+
+    for (const TextureFormat format : {TextureFormat::BC1, TextureFormat::BC3_SRGB,
+                                       TextureFormat::BC5, TextureFormat::BC7_SRGB}) {
+        const TextureImage compressed = compress_texture(image, format, false);
+        REQUIRE(write_dds(compressed, path));
+
+        const TextureImage loaded = read_dds(path);
+        REQUIRE(loaded.is_valid());
+        REQUIRE(loaded.format == format);
+        REQUIRE(loaded.width == 32);
+        REQUIRE(loaded.height == 16);
+        REQUIRE(loaded.mip_count == compressed.mip_count);
+        REQUIRE(loaded.pixels == compressed.pixels);
+    }
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("DDS reader rejects bad files", "[assets][compression]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_bad_texture.dds");
+
+    TextureImage image;
+    image.width = 16;
+    image.height = 16;
+    image.format = TextureFormat::RGBA8;
+    image.pixels = make_image(image.width, image.height);
+    REQUIRE(write_dds(compress_texture(image, TextureFormat::BC7, false), path));
+    const std::vector<char> bytes = read_bytes(path);
+
+    SECTION("Missing file") {
+        REQUIRE_FALSE(read_dds(temp_path("horizon_test_missing.dds")).is_valid());
+    }
+    SECTION("Wrong magic") {
+        auto corrupt = bytes;
+        corrupt[0] = 'X';
+        write_bytes(path, corrupt);
+        REQUIRE_FALSE(read_dds(path).is_valid());
+    }
+    SECTION("Unsupported format") {
+        auto corrupt = bytes;
+        corrupt[128] = 2; // DXGI_FORMAT_R32G32B32A32_FLOAT
+        write_bytes(path, corrupt);
+        REQUIRE_FALSE(read_dds(path).is_valid());
+    }
+    SECTION("Truncated") {
+        const auto size = static_cast<std::ptrdiff_t>(bytes.size() - 1);
+        write_bytes(path, std::vector<char>(bytes.begin(), bytes.begin() + size));
+        REQUIRE_FALSE(read_dds(path).is_valid());
+    }
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("Cooked texture is used only while it is not older than its source",
+          "[assets][compression]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto source = temp_path("horizon_test_source.png");
+    const auto cooked = cooked_texture_path(source);
+    REQUIRE(cooked.filename() == "horizon_test_source.png.dds");
+    std::filesystem::remove(cooked);
+
+    std::ofstream(source) << "png";
+    REQUIRE_FALSE(is_cooked_texture_current(source));
+
+    std::ofstream(cooked) << "dds";
+    std::filesystem::last_write_time(cooked, std::filesystem::last_write_time(source));
+    REQUIRE(is_cooked_texture_current(source));
+
+    std::filesystem::remove(source);
+    std::filesystem::remove(cooked);
+    Log::shutdown();
+}
@@ -0,0 +1,237 @@
+/**
+ * @file test_command_buffer.cpp
+ * @brief Unit tests for deferred structural changes and parallel view iteration
+ */
+
+#include <atomic>
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
+#include <engine/scene/parallel.hpp>
+
+using namespace hz;
+
+namespace {
+struct Health {
+    i32 value{0};
+};
+
+struct Marked {
+    u32 value{0};
+};
+
+struct Owned {
+    std::shared_ptr<int> value;
+};
+
+struct JobSystemFixture {
+    JobSystemFixture() {
+        Log::init(LogLevel::Off, LogLevel::Off);
+        JobSystem::init({.worker_count = 3});
+    }
+    ~JobSystemFixture() {
+        JobSystem::shutdown();
+        Log::shutdown();
+    }
+};
+} // namespace
+
+// ============================================================================
+// CommandBuffer Tests
+// ============================================================================
+
+TEST_CASE("CommandBuffer defers changes until flush", "[scene][commands]") {
+    entt::registry registry;
+    const Entity doomed = registry.create();
+    const Entity target = registry.create();
+    registry.emplace<Health>(target, 5);
+
+    CommandBuffer commands;
+    CommandList& list = commands.list();
+    list.destroy(doomed);
+    list.emplace<Health>(target, 10);
+    list.emplace<Marked>(target);
+    list.remove<Marked>(target);
+
+    REQUIRE(commands.size() == 4);
+    REQUIRE(registry.valid(doomed));
+    REQUIRE(registry.get<Health>(target).value == 5);
+
+    commands.flush(registry);
+
+    REQUIRE(commands.empty());
+    REQUIRE_FALSE(registry.valid(doomed));
+    REQUIRE(registry.get<Health>(target).value == 10);
+    REQUIRE_FALSE(registry.all_of<Marked>(target));
+}
+
+TEST_CASE("CommandBuffer resolves pending entities across lists", "[scene][commands]") {
+    entt::registry registry;
+    CommandBuffer commands;
+
+    const PendingEntity spawned = commands.list(1).create();
+    commands.list(0).emplace<Health>(spawned, 7); // Earlier list, later entity
+    REQUIRE(registry.view<Health>().size() == 0);
+
+    commands.flush(registry);
+
+    auto view = registry.view<Health>();
+    REQUIRE(view.size() == 1);
+    REQUIRE(view.get<Health>(*view.begin()).value == 7);
+}
+
+TEST_CASE("CommandBuffer ignores entities destroyed before flush", "[scene][commands]") {
+    entt::registry registry;
+    const Entity entity = registry.create();
+
+    CommandBuffer commands;
+    commands.list().destroy(entity);
+    commands.list().destroy(entity);
+    commands.list().emplace<Health>(entity, 1);
+    commands.flush(registry);
+
+    REQUIRE_FALSE(registry.valid(entity));
+    REQUIRE(registry.storage<Health>().empty());
+}
+
+TEST_CASE("CommandBuffer clear drops recorded commands", "[scene][commands]") {
+    entt::registry registry;
+    CommandBuffer commands;
+    (void)commands.list().create();
+    commands.clear();
+    REQUIRE(commands.empty());
+
+    commands.flush(registry);
+    REQUIRE(entt::to_entity(registry.create()) == 0); // Nothing was created before
+}
+
+TEST_CASE("CommandBuffer keeps per-type order across lists", "[scene][commands]") {
+    entt::registry registry;
+    const Entity entity = registry.create();
+
+    CommandBuffer commands;
+    commands.list(0).emplace<Health>(entity, 1);
+    commands.list(0).remove<Marked>(entity);
+    commands.list(1).emplace<Marked>(entity, 3u);
+    commands.list(1).emplace<Health>(entity, 2);
+    commands.list(1).remove<Health>(entity);
+    commands.list(2).emplace<Health>(entity, 4);
+    commands.flush(registry);
+
+    REQUIRE(registry.get<Health>(entity).value == 4);
+    REQUIRE(registry.get<Marked>(entity).value == 3);
+}
+
+TEST_CASE("CommandBuffer destroys emplaced values", "[scene][commands]") {
+    entt::registry registry;
+    const Entity entity = registry.create();
+    auto value = std::make_shared<int>(7);
+
+    CommandBuffer commands;
+    commands.list().emplace<Owned>(entity, value);
+    REQUIRE(value.use_count() == 2);
+    REQUIRE(commands.list().payload_bytes() >= sizeof(Owned));
+    commands.clear();
+    REQUIRE(value.use_count() == 1);
+    REQUIRE(commands.list().payload_bytes() == 0);
+
+    commands.list().emplace<Owned>(entity, value);
+    commands.flush(registry);
+    REQUIRE(value.use_count() == 2); // Moved into the registry
+    REQUIRE(*registry.get<Owned>(entity).value == 7);
+
+    commands.list().emplace<Owned>(entity, value);
+    commands.list().destroy(entity);
+    commands.flush(registry);
+    REQUIRE(value.use_count() == 1);
+}
+
+TEST_CASE("Scene keeps its command buffer in the registry context", "[scene][commands]") {
+    Scene scene;
+    REQUIRE(&scene.commands() == &command_buffer(scene.registry()));
+
+    const Entity entity = scene.create_entity();
+    scene.commands().list().destroy(entity);
+    REQUIRE(scene.is_valid(entity));
+
+    scene.flush_commands();
+    REQUIRE_FALSE(scene.is_valid(entity));
+    REQUIRE(scene.commands().empty());
+}
+
+// ============================================================================
+// parallel_each Tests
+// ============================================================================
+
+TEST_CASE("parallel_each runs inline without the job system", "[scene][parallel]") {
+    entt::registry registry;
+    for (i32 i = 0; i < 10; ++i) {
+        registry.emplace<Health>(registry.create(), i);
+    }
+
+    parallel_each(registry.view<Health>(), [](Entity, Health& health) { health.value *= 2; });
+
+    i32 sum = 0;
+    for (auto [entity, health] : registry.view<Health>().each()) {
+        sum += health.value;
+    }
+    REQUIRE(sum == 90);
+}
+
+TEST_CASE_METHOD(JobSystemFixture, "parallel_each visits every matching entity once",
+                 "[scene][parallel]") {
+    entt::registry registry;
+    for (i32 i = 0; i < 1000; ++i) {
+        const Entity entity = registry.create();
+        registry.emplace<Health>(entity, 1);
+        if (i % 3 == 0) {
+            registry.emplace<Marked>(entity);
+        }
+    }
+
+    std::atomic<i32> visited{0};
+    parallel_each(
+        registry.view<Health, Marked>(),
+        [&](Entity, Health& health, Marked&) {
+            ++health.value;
+            visited.fetch_add(1, std::memory_order_relaxed);
+        },
+        16);
+
+    REQUIRE(visited.load() == 334);
+    for (auto [entity, health] : registry.view<Health>().each()) {
+        REQUIRE(health.value == (registry.all_of<Marked>(entity) ? 2 : 1));
+    }
+}
+
+TEST_CASE_METHOD(JobSystemFixture, "parallel_each defers structural changes to flush",
+                 "[scene][parallel]") {
+    entt::registry registry;
+    for (i32 i = 0; i < 1000; ++i) {
+        registry.emplace<Health>(registry.create(), i);
+    }
+
+    CommandBuffer commands;
+    parallel_each(
+        registry.view<Health>(), commands,
+        [](CommandList& list, Entity entity, const Health& health) {
+            if (health.value % 2 == 0) {
+                list.destroy(entity);
+            } else {
+                list.emplace<Marked>(list.create());
+            }
+        },
+        32);
+
+    REQUIRE(commands.list_count() == 32);
+    REQUIRE(registry.storage<Health>().size() == 1000);
+
+    commands.flush(registry);
+
+    REQUIRE(registry.storage<Health>().size() == 500);
+    REQUIRE(registry.storage<Marked>().size() == 500);
+    for (auto [entity, health] : registry.view<Health>().each()) {
+        REQUIRE(health.value % 2 == 1);
+    }
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_cooked_model.cpp
+ * @brief Unit tests for the cooked (.hzmesh) model format
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/assets/cooked_model.hpp>
+#include <engine/core/log.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace hz;
+
+namespace {
+std::filesystem::path temp_path(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+ModelData make_model() {
+    ModelData data;
+    for (u32 m = 0; m < 2; ++m) {
+        MeshData mesh;
+        for (u32 i = 0; i < 5 + m; ++i) {
+            Vertex vertex{};
+            vertex.position = glm::vec3(static_cast<f32>(i), static_cast<f32>(m), 1.0f);
+            vertex.texcoord = glm::vec2(0.5f, static_cast<f32>(i));
+            vertex.tangent = glm::vec4(1.0f, 0.0f, 0.0f, -1.0f);
+            vertex.add_bone(static_cast<int>(i % 2), 1.0f);
+            mesh.vertices.push_back(vertex);
+            mesh.indices.push_back(i);
+        }
+        data.meshes.push_back(std::move(mesh));
+    }
+
+    data.skeleton = std::make_shared<Skeleton>();
+    const i32 root = data.skeleton->add_bone("root", -1, glm::mat4(2.0f));
+    const i32 arm = data.skeleton->add_bone("arm", root, glm::mat4(1.0f));
+    data.skeleton->get_bone(root)->children.push_back(arm);
+    data.skeleton->get_bone(arm)->position = glm::vec3(0.0f, 1.0f, 0.0f);
+
+    auto clip = std::make_shared<AnimationClip>();
+    clip->name = "wave";
+    clip->duration = 2.0f;
+    BoneAnimation channel;
+    channel.bone_name = "arm";
+    channel.bone_id = arm;
+    channel.position_keys = {{0.0f, glm::vec3(0.0f)}, {2.0f, glm::vec3(1.0f)}};
+    channel.rotation_keys = {{1.0f, glm::quat(0.0f, 1.0f, 0.0f, 0.0f)}};
+    clip->channels.push_back(std::move(channel));
+    data.animations.push_back(std::move(clip));
+
+    MaterialData material;
+    material.name = "skin";
+    material.albedo_texture.path = "textures/skin.png";
+    material.albedo_texture.srgb = true;
+    material.normal_texture.embedded = {0x89, 'P', 'N', 'G'};
+    material.roughness = 0.8f;
+    data.materials.push_back(std::move(material));
+    return data;
+}
+
+std::vector<char> read_bytes(const std::filesystem::path& path) {
+    std::vector<char> bytes(std::filesystem::file_size(path));
+    std::ifstream(path, std::ios::binary)
+        .read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    return bytes;
+}
+
+void write_bytes(const std::filesystem::path& path, const std::vector<char>& bytes) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc)
+        .write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+} // namespace
+
+// ============================================================================
+// Round-Trip Tests
+// ============================================================================
+
+TEST_CASE("Cooked model round-trips meshes, skeleton, animations and materials",
+          "[assets][cooked]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_model.hzmesh");
+    const ModelData source = make_model();
+    REQUIRE(write_cooked_model(source, path));
+
+    CookedModel cooked;
+    REQUIRE(cooked.open(path));
+    REQUIRE(cooked.mesh_count() == 2);
+    for (u32 m = 0; m < 2; ++m) {
+        const auto vertices = cooked.vertices(m);
+        const auto indices = cooked.indices(m);
+        REQUIRE(vertices.size() == source.meshes[m].vertices.size());
+        REQUIRE(reinterpret_cast<std::uintptr_t>(vertices.data()) % alignof(Vertex) == 0);
+        REQUIRE(std::vector<u32>(indices.begin(), indices.end()) == source.meshes[m].indices);
+        for (usize i = 0; i < vertices.size(); ++i) {
+            REQUIRE(vertices[i].position == source.meshes[m].vertices[i].position);
+            REQUIRE(vertices[i].tangent == source.meshes[m].vertices[i].tangent);
+            REQUIRE(vertices[i].bone_ids[0] == source.meshes[m].vertices[i].bone_ids[0]);
+        }
+    }
+
+    const ModelData& extras = cooked.extras();
+    REQUIRE(extras.meshes.empty());
+    REQUIRE(extras.skeleton);
+    REQUIRE(extras.skeleton->bone_count() == 2);
+    REQUIRE(extras.skeleton->get_bone_id("arm") == 1);
+    REQUIRE(extras.skeleton->get_bone(0)->offset_matrix == glm::mat4(2.0f));
+    REQUIRE(extras.skeleton->get_bone(0)->children == std::vector<i32>{1});
+    REQUIRE(extras.skeleton->get_bone(1)->parent_id == 0);
+    REQUIRE(extras.skeleton->get_bone(1)->position == glm::vec3(0.0f, 1.0f, 0.0f));
+
+    REQUIRE(extras.animations.size() == 1);
+    const AnimationClip& clip = *extras.animations[0];
+    REQUIRE(clip.name == "wave");
+    REQUIRE(clip.duration == 2.0f);
+    REQUIRE(clip.channels.size() == 1);
+    REQUIRE(clip.channels[0].bone_name == "arm");
+    REQUIRE(clip.channels[0].position_keys.size() == 2);
+    REQUIRE(clip.channels[0].position_keys[1].value == glm::vec3(1.0f));
+    REQUIRE(clip.channels[0].rotation_keys[0].value == glm::quat(0.0f, 1.0f, 0.0f, 0.0f));
+    REQUIRE(clip.channels[0].scale_keys.empty());
+
+    REQUIRE(extras.materials.size() == 1);
+    const MaterialData& material = extras.materials[0];
+    REQUIRE(material.name == "skin");
+    REQUIRE(material.albedo_texture.path == "textures/skin.png");
+    REQUIRE(material.albedo_texture.srgb);
+    REQUIRE(material.normal_texture.embedded == source.materials[0].normal_texture.embedded);
+    REQUIRE_FALSE(material.ao_texture.is_set());
+    REQUIRE(material.roughness == 0.8f);
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("Cooked model rejects bad files", "[assets][cooked]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_bad_model.hzmesh");
+    REQUIRE(write_cooked_model(make_model(), path));
+    const std::vector<char> bytes = read_bytes(path);
+    CookedModel cooked;
+
+    SECTION("Missing file") {
+        REQUIRE_FALSE(cooked.open(temp_path("horizon_test_missing.hzmesh")));
+    }
+    SECTION("Wrong magic") {
+        auto corrupt = bytes;
+        corrupt[0] = 'X';
+        write_bytes(path, corrupt);
+        REQUIRE_FALSE(cooked.open(path));
+    }
+    SECTION("Wrong version") {
+        auto corrupt = bytes;
+        corrupt[4] = static_cast<char>(COOKED_MODEL_VERSION + 1);
+        write_bytes(path, corrupt);
+        REQUIRE_FALSE(cooked.open(path));
+    }
+    SECTION("Truncated") {
+        const auto size = static_cast<std::ptrdiff_t>(bytes.size() - 8);
+        write_bytes(path, std::vector<char>(bytes.begin(), bytes.begin() + size));
+        REQUIRE_FALSE(cooked.open(path));
+    }
+    REQUIRE(cooked.mesh_count() == 0);
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+// ============================================================================
+// Freshness Tests
+// ============================================================================
+
+TEST_CASE("Cooked model is used only while it is not older than its source",
+          "[assets][cooked]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto source = temp_path("horizon_test_source.obj");
+    const auto cooked = cooked_model_path(source);
+    REQUIRE(cooked.filename() == "horizon_test_source.obj.hzmesh");
+    std::filesystem::remove(cooked);
+
+    std::ofstream(source) << "v 0 0 0\n";
+    REQUIRE_FALSE(is_cooked_model_current(source));
+
+    REQUIRE(write_cooked_model(make_model(), cooked));
+    const auto now = std::filesystem::last_write_time(source);
+    std::filesystem::last_write_time(cooked, now);
+    REQUIRE(is_cooked_model_current(source));
+
+    std::filesystem::last_write_time(source, now + std::chrono::seconds(10));
+    REQUIRE_FALSE(is_cooked_model_current(source));
+
+    // Shipped builds may contain only the cooked file
+    std::filesystem::remove(source);
+    REQUIRE(is_cooked_model_current(source));
+
+    std::filesystem::remove(cooked);
+    Log::shutdown();
+}
@@ -3,6 +3,10 @@
  * @brief Unit tests for the game loop
  */
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <engine/core/game_loop.hpp>
@@ -10,6 +14,11 @@
 
 using namespace hz;
 
+namespace {
+struct Position {};
+struct Velocity {};
+} // namespace
+
 // ============================================================================
 // Game Loop Tests
 // ============================================================================
@@ -34,3 +43,84 @@ TEST_CASE("GameLoop fixed timestep", "[core][gameloop]") {
 
     Log::shutdown();
 }
+
+TEST_CASE("GameLoop pipelined mode", "[core][gameloop]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    GameLoopConfig config;
+    config.fixed_timestep = 1.0 / 200.0;
+    config.log_fps = false;
+    config.pipelined = true;
+    GameLoop loop(config);
+
+    const std::thread::id render_thread = std::this_thread::get_id();
+    std::atomic<bool> updated_off_render_thread{true};
+    std::atomic<u64> last_published{0};
+    std::atomic<bool> published_in_order{true};
+    bool alpha_in_range = true;
+    u32 frames = 0;
+
+    loop.set_update_callback([&](f64) {
+        if (std::this_thread::get_id() == render_thread) {
+            updated_off_render_thread = false;
+        }
+    });
+    loop.set_publish_callback([&](u64 tick, f64 simulation_time) {
+        if (tick != last_published + 1 ||
+            simulation_time != Catch::Approx(static_cast<f64>(tick) * config.fixed_timestep)) {
+            published_in_order = false;
+        }
+        last_published = tick;
+    });
+    loop.set_render_callback([&](f64 alpha) {
+        alpha_in_range = alpha_in_range && alpha >= 0.0 && alpha <= 1.0;
+        ++frames;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+    loop.set_should_quit_callback([&] { return loop.tick_count() >= 20; });
+
+    loop.run();
+
+    REQUIRE_FALSE(loop.is_running());
+    REQUIRE(loop.tick_count() >= 20);
+    REQUIRE(frames > 0);
+    REQUIRE(updated_off_render_thread.load());
+    REQUIRE(published_in_order.load());
+    REQUIRE(last_published.load() == loop.tick_count());
+    REQUIRE(alpha_in_range);
+
+    Log::shutdown();
+}
+
+TEST_CASE("GameLoop pipelined mode logs system stats while ticking", "[core][gameloop]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    // Log every frame so the render thread reads the task graph stats while the
+    // simulation thread rewrites them (run under -DHZ_SANITIZE=thread)
+    GameLoopConfig config;
+    config.fixed_timestep = 1.0 / 500.0;
+    config.log_fps = true;
+    config.fps_log_interval = 0.0;
+    config.pipelined = true;
+    GameLoop loop(config);
+
+    std::atomic<u32> moved{0};
+    loop.add_system("input", [](f64) {}).writes<Velocity>();
+    loop.add_system("movement", [&](f64) { moved.fetch_add(1, std::memory_order_relaxed); })
+        .reads<Velocity>()
+        .writes<Position>();
+    loop.add_system("collision", [](f64) {}).reads<Position>();
+
+    u32 frames = 0;
+    loop.set_render_callback([&](f64) { ++frames; });
+    loop.set_should_quit_callback([&] { return loop.tick_count() >= 50; });
+
+    loop.run();
+
+    REQUIRE(loop.tick_count() >= 50);
+    REQUIRE(frames > 0);
+    REQUIRE(moved.load() >= 50);
+    REQUIRE(loop.systems().stats().critical_path.size() == 3);
+
+    Log::shutdown();
+}
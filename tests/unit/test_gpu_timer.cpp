@@ -0,0 +1,82 @@
+/**
+ * @file test_gpu_timer.cpp
+ * @brief Unit tests for GPU pass timing without a GPU
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
+#include <engine/renderer/opengl/gpu_timer.hpp>
+
+#include <initializer_list>
+
+using namespace hz;
+
+TEST_CASE("GpuTimer detects software rasterizers", "[renderer][gpu_timer]") {
+    REQUIRE(gl::GpuTimer::is_software_renderer("llvmpipe (LLVM 15.0.7, 256 bits)"));
+    REQUIRE(gl::GpuTimer::is_software_renderer("softpipe"));
+    REQUIRE(gl::GpuTimer::is_software_renderer("Mesa X11 Software Rasterizer"));
+    REQUIRE_FALSE(gl::GpuTimer::is_software_renderer("NVIDIA GeForce RTX 3070/PCIe/SSE2"));
+    REQUIRE_FALSE(gl::GpuTimer::is_software_renderer("AMD Radeon RX 6800 (radeonsi, navi21)"));
+}
+
+TEST_CASE("GpuTimer reports zeros without timer queries", "[renderer][gpu_timer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    // No GL context is loaded in unit tests
+    gl::GpuTimer timer(3);
+    REQUIRE_FALSE(timer.is_supported());
+    REQUIRE(timer.pass_count() == 3);
+
+    for (u32 frame = 0; frame < gl::GpuTimer::FRAME_LATENCY * 2; ++frame) {
+        for (u32 pass = 0; pass < 3; ++pass) {
+            timer.begin(pass);
+            timer.end(pass);
+        }
+        timer.end_frame();
+    }
+
+    for (u32 pass = 0; pass < 3; ++pass) {
+        REQUIRE(timer.elapsed_ms(pass) == 0.0f);
+    }
+
+    Log::shutdown();
+}
+
+TEST_CASE("GpuTimer marks passes skipped in a frame inactive", "[renderer][gpu_timer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    gl::GpuTimer timer(3);
+    REQUIRE_FALSE(timer.is_active(0));
+
+    auto run_frame = [&timer](std::initializer_list<u32> passes) {
+        for (const u32 pass : passes) {
+            timer.begin(pass);
+            timer.end(pass);
+        }
+        timer.end_frame();
+    };
+
+    run_frame({0, 1, 2});
+    REQUIRE(timer.is_active(0));
+    REQUIRE(timer.is_active(1));
+    REQUIRE(timer.is_active(2));
+
+    // Pass 1 switched off, as SSR or TAA would be
+    for (u32 frame = 0; frame < gl::GpuTimer::FRAME_LATENCY + 1; ++frame) {
+        run_frame({0, 2});
+        REQUIRE(timer.is_active(0));
+        REQUIRE_FALSE(timer.is_active(1));
+        REQUIRE(timer.elapsed_ms(1) == 0.0f);
+        REQUIRE(timer.is_active(2));
+    }
+
+    run_frame({0, 1, 2});
+    REQUIRE(timer.is_active(1));
+
+    run_frame({});
+    for (u32 pass = 0; pass < 3; ++pass) {
+        REQUIRE_FALSE(timer.is_active(pass));
+    }
+
+    Log::shutdown();
+}
@@ -0,0 +1,238 @@
+/**
+ * @file test_handle_pool.cpp
+ * @brief Unit tests for HandlePool
+ */
+
+#include <algorithm>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/handle_pool.hpp>
+
+using namespace hz;
+
+namespace {
+struct Particle {
+    f32 position[3]{};
+    f32 velocity[3]{};
+    f32 life{0.0f};
+};
+
+struct ThrowingValue {
+    explicit ThrowingValue(int v) : value(v) {
+        if (v < 0) {
+            throw std::runtime_error("negative value");
+        }
+    }
+    int value;
+};
+
+/// Forwards to the default resource until told to fail
+class FailingResource : public std::pmr::memory_resource {
+public:
+    bool fail{false};
+
+private:
+    void* do_allocate(usize bytes, usize alignment) override {
+        if (fail) {
+            throw std::bad_alloc();
+        }
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, usize bytes, usize alignment) override {
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+} // namespace
+
+// ============================================================================
+// HandlePool Tests
+// ============================================================================
+
+TEST_CASE("HandlePool basic operations", "[core][handle_pool]") {
+    HandlePool<std::string> pool;
+
+    SECTION("Emplace returns valid handles") {
+        auto a = pool.emplace("alpha");
+        auto b = pool.emplace("beta");
+        REQUIRE(a.is_valid());
+        REQUIRE(b.is_valid());
+        REQUIRE(a != b);
+        REQUIRE(pool.size() == 2);
+        REQUIRE(*pool.get(a) == "alpha");
+        REQUIRE(*pool.get(b) == "beta");
+    }
+
+    SECTION("Erase invalidates the handle") {
+        auto a = pool.insert("alpha");
+        REQUIRE(pool.erase(a));
+        REQUIRE_FALSE(pool.contains(a));
+        REQUIRE(pool.get(a) == nullptr);
+        REQUIRE_FALSE(pool.erase(a));
+        REQUIRE(pool.empty());
+    }
+
+    SECTION("Default and foreign handles are rejected") {
+        (void)pool.emplace("alpha");
+        REQUIRE_FALSE(pool.contains(HandlePool<std::string>::HandleType{}));
+        REQUIRE_FALSE(pool.contains({100, 1}));
+    }
+}
+
+TEST_CASE("HandlePool stale handle rejection", "[core][handle_pool]") {
+    HandlePool<int> pool;
+
+    auto first = pool.emplace(1);
+    REQUIRE(pool.erase(first));
+
+    // The slot is recycled with a bumped generation
+    auto second = pool.emplace(2);
+    REQUIRE(second.index == first.index);
+    REQUIRE(second.generation != first.generation);
+
+    REQUIRE(pool.get(first) == nullptr);
+    REQUIRE(*pool.get(second) == 2);
+}
+
+TEST_CASE("HandlePool swap-remove keeps handles stable", "[core][handle_pool]") {
+    HandlePool<int> pool;
+    std::vector<HandlePool<int>::HandleType> handles;
+    for (int i = 0; i < 8; ++i) {
+        handles.push_back(pool.emplace(i));
+    }
+
+    // Erase from the front and middle so the tail gets moved
+    REQUIRE(pool.erase(handles[0]));
+    REQUIRE(pool.erase(handles[3]));
+    REQUIRE(pool.size() == 6);
+
+    for (int i = 0; i < 8; ++i) {
+        if (i == 0 || i == 3) {
+            REQUIRE(pool.get(handles[i]) == nullptr);
+        } else {
+            REQUIRE(*pool.get(handles[i]) == i);
+        }
+    }
+
+    // Dense positions map back to the handles that own them
+    for (usize i = 0; i < pool.size(); ++i) {
+        auto handle = pool.handle_at(i);
+        REQUIRE(pool.get(handle) == pool.data() + i);
+    }
+}
+
+TEST_CASE("HandlePool iteration", "[core][handle_pool]") {
+    HandlePool<int> pool;
+    auto a = pool.emplace(10);
+    auto b = pool.emplace(20);
+    auto c = pool.emplace(30);
+    REQUIRE(pool.erase(b));
+
+    int sum = 0;
+    for (int value : pool) {
+        sum += value;
+    }
+    REQUIRE(sum == 40);
+
+    int visited = 0;
+    pool.for_each([&](auto handle, int& value) {
+        REQUIRE((handle == a || handle == c));
+        value += 1;
+        ++visited;
+    });
+    REQUIRE(visited == 2);
+    REQUIRE(*pool.get(a) == 11);
+    REQUIRE(*pool.get(c) == 31);
+}
+
+TEST_CASE("HandlePool clear", "[core][handle_pool]") {
+    HandlePool<int> pool;
+    auto a = pool.emplace(1);
+    auto b = pool.emplace(2);
+
+    pool.clear();
+    REQUIRE(pool.empty());
+    REQUIRE_FALSE(pool.contains(a));
+    REQUIRE_FALSE(pool.contains(b));
+
+    auto c = pool.emplace(3);
+    REQUIRE(pool.size() == 1);
+    REQUIRE(*pool.get(c) == 3);
+    REQUIRE_FALSE(pool.contains(a));
+    REQUIRE_FALSE(pool.contains(b));
+}
+
+TEST_CASE("HandlePool uses the supplied memory resource", "[core][handle_pool]") {
+    std::pmr::monotonic_buffer_resource upstream;
+    std::pmr::unsynchronized_pool_resource resource(&upstream);
+
+    HandlePool<Particle> pool(&resource);
+    pool.reserve(64);
+    for (int i = 0; i < 64; ++i) {
+        (void)pool.emplace();
+    }
+    REQUIRE(pool.size() == 64);
+    REQUIRE(std::all_of(pool.begin(), pool.end(), [](const Particle& p) { return p.life == 0.0f; }));
+}
+
+TEST_CASE("HandlePool emplace leaves the pool unchanged on exceptions", "[core][handle_pool]") {
+    SECTION("Throwing constructor") {
+        HandlePool<ThrowingValue> pool;
+        auto a = pool.emplace(1);
+        auto b = pool.emplace(2);
+        REQUIRE(pool.erase(a));
+
+        // Neither the freed slot nor a new one is lost
+        REQUIRE_THROWS_AS(pool.emplace(-1), std::runtime_error);
+        REQUIRE(pool.size() == 1);
+        auto c = pool.emplace(3);
+        REQUIRE(c.index == a.index);
+        REQUIRE_THROWS_AS(pool.emplace(-1), std::runtime_error);
+        auto d = pool.emplace(4);
+        REQUIRE(d.index == 2);
+
+        REQUIRE(pool.erase(b));
+        REQUIRE(pool.get(c)->value == 3);
+        REQUIRE(pool.get(d)->value == 4);
+        REQUIRE(pool.handle_at(0) == d);
+        REQUIRE(pool.handle_at(1) == c);
+    }
+
+    SECTION("Failed allocation") {
+        FailingResource resource;
+        HandlePool<int> pool(&resource);
+        std::vector<HandlePool<int>::HandleType> handles;
+
+        // Fail every time the pool has to grow, then retry
+        for (int i = 0; i < 100; ++i) {
+            resource.fail = true;
+            try {
+                handles.push_back(pool.emplace(i));
+            } catch (const std::bad_alloc&) {
+                REQUIRE(pool.size() == handles.size());
+                resource.fail = false;
+                handles.push_back(pool.emplace(i));
+            }
+        }
+        resource.fail = false;
+
+        // Dense order and slots still agree after swap-and-pop erases
+        for (usize i = 0; i < handles.size(); i += 2) {
+            REQUIRE(pool.erase(handles[i]));
+        }
+        REQUIRE(pool.size() == 50);
+        for (usize i = 1; i < handles.size(); i += 2) {
+            REQUIRE(*pool.get(handles[i]) == static_cast<int>(i));
+        }
+        for (usize i = 0; i < pool.size(); ++i) {
+            REQUIRE(pool.get(pool.handle_at(i)) == pool.data() + i);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * @file test_headless_runner.cpp
+ * @brief Unit tests for the headless simulation runner
+ */
+
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/headless_runner.hpp>
+#include <engine/core/log.hpp>
+
+using namespace hz;
+
+namespace {
+/// Tiny deterministic simulation: a damped spring
+struct Spring {
+    f64 position{1.0};
+    f64 velocity{0.0};
+
+    void step(f64 dt) {
+        velocity += (-10.0 * position - 0.5 * velocity) * dt;
+        position += velocity * dt;
+    }
+};
+} // namespace
+
+// ============================================================================
+// HeadlessRunner Tests
+// ============================================================================
+
+TEST_CASE("HeadlessRunner steps a fixed number of ticks", "[core][headless]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    HeadlessRunnerConfig config;
+    config.fixed_timestep = 0.01;
+    config.max_ticks = 500;
+    config.log_stats = false;
+    HeadlessRunner runner(config);
+
+    u32 system_calls = 0;
+    u32 update_calls = 0;
+    runner.add_system("count", [&](f64 dt) {
+        REQUIRE(dt == Catch::Approx(0.01));
+        ++system_calls;
+    });
+    runner.set_update_callback([&](f64) { ++update_calls; });
+
+    const HeadlessRunnerStats stats = runner.run();
+
+    REQUIRE(stats.ticks == 500);
+    REQUIRE(system_calls == 500);
+    REQUIRE(update_calls == 500);
+    REQUIRE(stats.simulation_time == Catch::Approx(5.0));
+    REQUIRE(runner.simulation_time() == Catch::Approx(5.0));
+    // Unthrottled: 5 simulated seconds finish far faster than real time
+    REQUIRE(stats.speedup > 1.0);
+    REQUIRE(stats.ticks_per_second > 0.0);
+    REQUIRE_FALSE(runner.is_running());
+
+    Log::shutdown();
+}
+
+TEST_CASE("HeadlessRunner is deterministic", "[core][headless]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    auto simulate = [] {
+        HeadlessRunnerConfig config;
+        config.max_ticks = 1000;
+        config.log_stats = false;
+        HeadlessRunner runner(config);
+
+        Spring spring;
+        runner.set_update_callback([&](f64 dt) { spring.step(dt); });
+        runner.run();
+        return spring.position;
+    };
+
+    REQUIRE(simulate() == simulate());
+
+    Log::shutdown();
+}
+
+TEST_CASE("HeadlessRunner time scale paces against real time", "[core][headless]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    HeadlessRunnerConfig config;
+    config.fixed_timestep = 0.01;
+    config.time_scale = 4.0; // 4x real time
+    config.max_ticks = 40;   // 0.4 simulated seconds
+    config.log_stats = false;
+    HeadlessRunner runner(config);
+
+    const HeadlessRunnerStats stats = runner.run();
+
+    // The last tick is due at 39 * 0.01 / 4 seconds
+    REQUIRE(stats.wall_time >= 0.09);
+    REQUIRE(stats.speedup <= 4.5);
+
+    Log::shutdown();
+}
+
+TEST_CASE("HeadlessRunner stops on quit", "[core][headless]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    HeadlessRunnerConfig config;
+    config.log_stats = false;
+    HeadlessRunner runner(config);
+
+    runner.set_update_callback([&](f64) {
+        if (runner.tick_count() == 9) {
+            runner.quit();
+        }
+    });
+    runner.run();
+    REQUIRE(runner.tick_count() == 10);
+
+    u32 polls = 0;
+    runner.set_update_callback(nullptr);
+    runner.set_should_quit_callback([&] { return ++polls > 3; });
+    runner.run();
+    REQUIRE(runner.tick_count() == 3);
+
+    Log::shutdown();
+}
@@ -0,0 +1,118 @@
+/**
+ * @file test_jobs.cpp
+ * @brief Unit tests for the work-stealing job system
+ */
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/jobs.hpp>
+#include <engine/core/log.hpp>
+
+using namespace hz;
+
+namespace {
+struct JobSystemFixture {
+    JobSystemFixture() {
+        Log::init(LogLevel::Off, LogLevel::Off);
+        JobSystem::init({.worker_count = 3});
+    }
+    ~JobSystemFixture() {
+        JobSystem::shutdown();
+        Log::shutdown();
+    }
+};
+} // namespace
+
+// ============================================================================
+// JobSystem Tests
+// ============================================================================
+
+TEST_CASE("JobSystem runs inline when not initialized", "[core][jobs]") {
+    REQUIRE_FALSE(JobSystem::is_initialized());
+
+    int value = 0;
+    JobCounter counter;
+    JobSystem::run([&] { value = 42; }, &counter);
+    REQUIRE(value == 42);
+    REQUIRE(counter.is_done());
+
+    std::vector<int> data(100, 1);
+    JobSystem::parallel_for_each(data, [](int& x) { x *= 2; });
+    REQUIRE(std::accumulate(data.begin(), data.end(), 0) == 200);
+}
+
+TEST_CASE_METHOD(JobSystemFixture, "JobSystem fork/join", "[core][jobs]") {
+    REQUIRE(JobSystem::worker_count() == 3);
+    REQUIRE(JobSystem::thread_index() == 0);
+
+    std::atomic<int> sum{0};
+    JobCounter counter;
+    for (int i = 1; i <= 1000; ++i) {
+        JobSystem::run([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+    }
+    JobSystem::wait(counter);
+
+    REQUIRE(counter.is_done());
+    REQUIRE(sum.load() == 500500);
+}
+
+TEST_CASE_METHOD(JobSystemFixture, "JobSystem parallel_for covers every index once",
+                 "[core][jobs]") {
+    constexpr usize COUNT = 10'007;
+    std::vector<std::atomic<u32>> hits(COUNT);
+
+    JobSystem::parallel_for(
+        COUNT,
+        [&](usize begin, usize end) {
+            for (usize i = begin; i < end; ++i) {
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        },
+        64);
+
+    bool all_once = true;
+    for (const auto& hit : hits) {
+        all_once = all_once && hit.load() == 1;
+    }
+    REQUIRE(all_once);
+}
+
+TEST_CASE_METHOD(JobSystemFixture, "JobSystem nested waits help instead of blocking",
+                 "[core][jobs]") {
+    // More outer jobs than workers, each waiting on inner jobs; this deadlocks
+    // unless waiting threads execute queued work
+    std::atomic<int> inner_runs{0};
+    JobCounter outer;
+    for (int i = 0; i < 16; ++i) {
+        JobSystem::run(
+            [&inner_runs] {
+                JobCounter inner;
+                for (int j = 0; j < 8; ++j) {
+                    JobSystem::run([&inner_runs] { inner_runs.fetch_add(1); }, &inner);
+                }
+                JobSystem::wait(inner);
+            },
+            &outer);
+    }
+    JobSystem::wait(outer);
+
+    REQUIRE(inner_runs.load() == 16 * 8);
+}
+
+TEST_CASE_METHOD(JobSystemFixture, "JobSystem runs jobs on worker threads", "[core][jobs]") {
+    std::atomic<bool> ran_on_worker{false};
+    JobSystem::parallel_for(
+        1024,
+        [&](usize, usize) {
+            if (JobSystem::thread_index() != 0) {
+                ran_on_worker.store(true);
+            }
+            std::this_thread::yield();
+        },
+        1);
+
+    REQUIRE(ran_on_worker.load());
+}
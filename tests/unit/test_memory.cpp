@@ -3,7 +3,12 @@
  * @brief Unit tests for the memory management system
  */
 
+#include <latch>
+#include <new>
+#include <thread>
+
 #include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
 #include <engine/core/memory.hpp>
 
 using namespace hz;
@@ -50,6 +55,104 @@ TEST_CASE("LinearArena basic operations", "[memory][arena]") {
     }
 }
 
+TEST_CASE("LinearArena virtual memory mode", "[memory][arena][virtual]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    VirtualArenaConfig config;
+    config.reserve_size = 4 * 1024 * 1024;
+    config.initial_commit = 256 * 1024;
+    config.decommit_after_frames = 3;
+
+    LinearArena arena(config);
+    REQUIRE(arena.is_virtual());
+    REQUIRE(arena.capacity() >= config.reserve_size);
+    REQUIRE(arena.committed() >= config.initial_commit);
+    const usize initial_commit = arena.committed();
+
+    SECTION("Commits pages on demand") {
+        auto* bytes = static_cast<std::byte*>(arena.allocate(1024 * 1024, 64));
+        REQUIRE(reinterpret_cast<uintptr_t>(bytes) % 64 == 0);
+        bytes[1024 * 1024 - 1] = std::byte{0xAB};
+        REQUIRE(arena.committed() >= 1024 * 1024);
+        REQUIRE(arena.committed() <= arena.capacity());
+    }
+
+    SECTION("Decommits after quiet frames") {
+        (void)arena.allocate(2 * 1024 * 1024, 16);
+        arena.reset();
+        const usize spike_commit = arena.committed();
+        REQUIRE(spike_commit > initial_commit);
+        REQUIRE(arena.high_water_mark() >= 2 * 1024 * 1024);
+
+        for (u32 frame = 0; frame < config.decommit_after_frames; ++frame) {
+            (void)arena.allocate(1024, 16);
+            arena.reset();
+        }
+        REQUIRE(arena.committed() == initial_commit);
+        REQUIRE(arena.high_water_mark() >= 2 * 1024 * 1024);
+    }
+
+    SECTION("A busy frame restarts the quiet window") {
+        (void)arena.allocate(2 * 1024 * 1024, 16);
+        arena.reset();
+        const usize spike_commit = arena.committed();
+
+        (void)arena.allocate(1024, 16);
+        arena.reset();
+        (void)arena.allocate(2 * 1024 * 1024, 16);
+        arena.reset();
+        (void)arena.allocate(1024, 16);
+        arena.reset();
+        REQUIRE(arena.committed() == spike_commit);
+    }
+
+    Log::shutdown();
+}
+
+TEST_CASE("LinearArena overflow chaining", "[memory][arena][virtual]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    VirtualArenaConfig config;
+    config.reserve_size = 64 * 1024;
+    config.initial_commit = 64 * 1024;
+
+    LinearArena arena(config);
+    const usize reserve = arena.capacity();
+
+    SECTION("Allocations past the reservation succeed") {
+        (void)arena.allocate(reserve - 128, 16);
+        void* spill = arena.allocate(4096, 16);
+        REQUIRE(spill != nullptr);
+        REQUIRE(arena.overflow_block_count() == 1);
+        REQUIRE(arena.used() > reserve);
+
+        arena.reset();
+        REQUIRE(arena.overflow_block_count() == 0);
+        REQUIRE(arena.used() == 0);
+    }
+
+    SECTION("Rewinding releases overflow blocks") {
+        (void)arena.allocate(reserve / 2, 16);
+        {
+            ScopedArenaMarker marker(arena);
+            (void)arena.allocate(reserve, 16);
+            (void)arena.allocate(reserve * 2, 16);
+            REQUIRE(arena.overflow_block_count() >= 1);
+        }
+        REQUIRE(arena.overflow_block_count() == 0);
+        REQUIRE(arena.used() == reserve / 2);
+    }
+
+    SECTION("Overflow can be disabled") {
+        VirtualArenaConfig strict = config;
+        strict.allow_overflow = false;
+        LinearArena strict_arena(strict);
+        REQUIRE_THROWS_AS(strict_arena.allocate(strict_arena.capacity() + 1, 16), std::bad_alloc);
+    }
+
+    Log::shutdown();
+}
+
 // ============================================================================
 // PMR Vector Tests
 // ============================================================================
@@ -84,3 +187,238 @@ TEST_CASE("PMR vector with arena", "[memory][pmr]") {
         REQUIRE(vec2.size() == 10);
     }
 }
+
+// ============================================================================
+// Scoped Arena Tests
+// ============================================================================
+
+TEST_CASE("ScopedArenaMarker rewinds the arena", "[memory][arena]") {
+    LinearArena arena(4096);
+    (void)arena.allocate(64, 8);
+    const usize before = arena.used();
+
+    SECTION("Single scope") {
+        {
+            ScopedArenaMarker marker(arena);
+            REQUIRE(arena.scope_depth() == 1);
+            (void)arena.allocate(512, 16);
+            REQUIRE(arena.used() > before);
+        }
+        REQUIRE(arena.used() == before);
+        REQUIRE(arena.scope_depth() == 0);
+    }
+
+    SECTION("Nested scopes unwind in order") {
+        ScopedArenaMarker outer(arena);
+        (void)arena.allocate(100, 8);
+        const usize outer_used = arena.used();
+        {
+            ScopedArenaMarker inner(arena);
+            REQUIRE(inner.is_innermost());
+            REQUIRE_FALSE(outer.is_innermost());
+            (void)arena.allocate(200, 8);
+        }
+        REQUIRE(arena.used() == outer_used);
+        REQUIRE(outer.is_innermost());
+    }
+}
+
+TEST_CASE("ScratchScope provides a scoped memory resource", "[memory][scratch]") {
+    LinearArena arena(8192);
+
+    SECTION("Containers allocate from the arena and are released with the scope") {
+        {
+            ScratchScope scratch(arena);
+            PmrVector<int> values(scratch.resource());
+            for (int i = 0; i < 256; ++i) {
+                values.push_back(i);
+            }
+            REQUIRE(scratch.bytes_used() >= 256 * sizeof(int));
+            REQUIRE(arena.used() == scratch.bytes_used());
+        }
+        REQUIRE(arena.used() == 0);
+    }
+
+    SECTION("Nested scratch scopes") {
+        ScratchScope outer(arena);
+        PmrVector<float> a(outer.resource());
+        a.resize(32);
+        const usize outer_used = arena.used();
+        {
+            ScratchScope inner(arena);
+            PmrVector<float> b(inner.resource());
+            b.resize(64);
+            REQUIRE(inner.bytes_used() >= 64 * sizeof(float));
+        }
+        REQUIRE(arena.used() == outer_used);
+        REQUIRE(a.size() == 32);
+    }
+}
+
+// ============================================================================
+// Memory Domain Accounting Tests
+// ============================================================================
+
+TEST_CASE("TrackedPoolResource accounting", "[memory][domain]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    TrackedPoolResource resource(MemoryDomain::Assets);
+
+    SECTION("Live and peak bytes") {
+        void* a = resource.allocate(256, 16);
+        void* b = resource.allocate(1024, 16);
+
+        MemoryDomainStats stats = resource.stats();
+        REQUIRE(stats.live_bytes == 1280);
+        REQUIRE(stats.peak_bytes == 1280);
+        REQUIRE(stats.live_allocations == 2);
+        REQUIRE(stats.total_allocations == 2);
+
+        resource.deallocate(b, 1024, 16);
+        stats = resource.stats();
+        REQUIRE(stats.live_bytes == 256);
+        REQUIRE(stats.peak_bytes == 1280);
+        REQUIRE(stats.live_allocations == 1);
+
+        resource.deallocate(a, 256, 16);
+        REQUIRE(resource.stats().live_bytes == 0);
+    }
+
+    SECTION("Per-frame allocation rate") {
+        PmrVector<int> values(&resource);
+        values.reserve(8);
+        resource.end_frame();
+        REQUIRE(resource.stats().allocations_last_frame == 1);
+
+        resource.end_frame();
+        REQUIRE(resource.stats().allocations_last_frame == 0);
+    }
+
+    SECTION("Hard budget rejects allocations") {
+        resource.set_budget({512, 1024});
+        void* a = resource.allocate(800, 8);
+        REQUIRE_THROWS_AS(resource.allocate(400, 8), std::bad_alloc);
+
+        MemoryDomainStats stats = resource.stats();
+        REQUIRE(stats.budget_failures == 1);
+        REQUIRE(stats.live_bytes == 800);
+        REQUIRE(stats.budget.hard_limit == 1024);
+
+        resource.deallocate(a, 800, 8);
+    }
+
+    Log::shutdown();
+}
+
+TEST_CASE("MemoryContext domains are isolated", "[memory][domain]") {
+    auto* ecs = MemoryContext::get(MemoryDomain::ECS);
+    auto* audio = MemoryContext::get(MemoryDomain::Audio);
+    REQUIRE(ecs != audio);
+
+    const MemoryDomainStats ecs_before = MemoryContext::stats(MemoryDomain::ECS);
+    const MemoryDomainStats audio_before = MemoryContext::stats(MemoryDomain::Audio);
+    {
+        PmrVector<float> samples(audio);
+        samples.resize(4096);
+        REQUIRE(MemoryContext::stats(MemoryDomain::Audio).live_bytes >=
+                audio_before.live_bytes + 4096 * sizeof(float));
+    }
+    REQUIRE(MemoryContext::stats(MemoryDomain::Audio).live_bytes == audio_before.live_bytes);
+    REQUIRE(MemoryContext::stats(MemoryDomain::ECS).total_allocations ==
+            ecs_before.total_allocations);
+}
+
+// ============================================================================
+// MemoryContext Frame Arena Tests
+// ============================================================================
+
+TEST_CASE("MemoryContext double-buffered frame arenas", "[memory][context]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    MemoryContext::init();
+
+    SECTION("Previous frame data survives one reset") {
+        auto* value = static_cast<int*>(MemoryContext::frame_arena().allocate(sizeof(int)));
+        *value = 1234;
+        const usize used = MemoryContext::frame_arena().used();
+
+        MemoryContext::reset_frame();
+
+        REQUIRE(MemoryContext::frame_arena().used() == 0);
+        REQUIRE(MemoryContext::previous_frame_arena().used() == used);
+        REQUIRE(*value == 1234);
+
+        MemoryContext::reset_frame();
+        REQUIRE(MemoryContext::frame_arena().used() == 0);
+        REQUIRE(MemoryContext::previous_frame_arena().used() == 0);
+        REQUIRE(MemoryContext::stats(MemoryDomain::Frame).peak_bytes >= used);
+    }
+
+    SECTION("Default ScratchScope uses the thread frame arena") {
+        const usize before = MemoryContext::frame_arena().used();
+        {
+            ScratchScope scratch;
+            REQUIRE(&scratch.arena() == &MemoryContext::frame_arena());
+            (void)scratch.resource()->allocate(128, 8);
+            REQUIRE(MemoryContext::frame_arena().used() > before);
+        }
+        REQUIRE(MemoryContext::frame_arena().used() == before);
+    }
+
+    SECTION("Frame domain resolves to the calling thread's arena") {
+        REQUIRE(MemoryContext::get(MemoryDomain::Frame) == &MemoryContext::frame_arena());
+        REQUIRE(&MemoryContext::thread_frame_arena() == &MemoryContext::frame_arena());
+
+        LinearArena* worker_arena = nullptr;
+        std::pmr::memory_resource* worker_resource = nullptr;
+        std::thread worker([&] {
+            worker_arena = &MemoryContext::thread_frame_arena();
+            worker_resource = MemoryContext::get(MemoryDomain::Frame);
+            (void)worker_resource->allocate(256, 16);
+        });
+        worker.join();
+
+        REQUIRE(worker_arena != nullptr);
+        REQUIRE(worker_resource == worker_arena);
+        REQUIRE(worker_arena != &MemoryContext::frame_arena());
+        REQUIRE(worker_arena->used() >= 256);
+        REQUIRE(MemoryContext::thread_arena_count() == 1);
+
+        // Worker arenas flip and reset together with the main arena
+        MemoryContext::reset_frame();
+        MemoryContext::reset_frame();
+        REQUIRE(worker_arena->used() == 0);
+    }
+
+    SECTION("Exited threads hand their arenas to the next thread") {
+        LinearArena* first = nullptr;
+        std::thread([&] { first = &MemoryContext::thread_frame_arena(); }).join();
+        LinearArena* second = nullptr;
+        std::thread([&] { second = &MemoryContext::thread_frame_arena(); }).join();
+        REQUIRE(first != nullptr);
+        REQUIRE(second == first);
+        REQUIRE(MemoryContext::thread_arena_count() == 1);
+
+        // Threads alive at the same time get separate arenas
+        std::latch both_registered(2);
+        LinearArena* concurrent[2]{};
+        auto register_and_wait = [&](usize index) {
+            concurrent[index] = &MemoryContext::thread_frame_arena();
+            both_registered.arrive_and_wait();
+        };
+        std::thread a(register_and_wait, usize{0});
+        std::thread b(register_and_wait, usize{1});
+        a.join();
+        b.join();
+        REQUIRE(concurrent[0] != concurrent[1]);
+        REQUIRE(MemoryContext::thread_arena_count() == 2);
+
+        // Restarting threads, as AssetStreamer and pipelined GameLoop do, adds none
+        for (int i = 0; i < 8; ++i) {
+            std::thread([] { (void)MemoryContext::thread_frame_arena().allocate(64, 8); }).join();
+        }
+        REQUIRE(MemoryContext::thread_arena_count() == 2);
+        REQUIRE(MemoryContext::stats(MemoryDomain::Frame).live_bytes >= 8 * 64);
+    }
+
+    MemoryContext::shutdown();
+    Log::shutdown();
+}
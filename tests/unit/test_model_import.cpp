@@ -0,0 +1,130 @@
+/**
+ * @file test_model_import.cpp
+ * @brief Unit tests for GL-free OBJ import and vertex deduplication
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/assets/model.hpp>
+#include <engine/core/jobs.hpp>
+#include <engine/core/log.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace hz;
+
+namespace {
+std::filesystem::path write_obj(const char* name, const char* contents) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path) << contents;
+    return path;
+}
+
+// Two quads sharing an edge, then a triangle reusing a corner with another normal
+constexpr const char* TWO_SHAPES = R"(o quads
+v 0 0 0
+v 1 0 0
+v 1 1 0
+v 0 1 0
+v 2 0 0
+v 2 1 0
+vt 0 0
+vt 1 0
+vt 1 1
+vt 0 1
+vn 0 0 1
+vn 0 0 -1
+f 1/1/1 2/2/1 3/3/1 4/4/1
+f 2/1/1 5/2/1 6/3/1 3/4/1
+o flipped
+f 1/1/2 2/2/2 3/3/1
+)";
+
+/// Index of the vertex with the given position and texcoord, or -1
+i32 find_vertex(const MeshData& mesh, glm::vec3 position, glm::vec2 texcoord) {
+    for (usize i = 0; i < mesh.vertices.size(); ++i) {
+        if (mesh.vertices[i].position == position && mesh.vertices[i].texcoord == texcoord) {
+            return static_cast<i32>(i);
+        }
+    }
+    return -1;
+}
+
+void check_two_shapes(const ModelData& data) {
+    REQUIRE(data.meshes.size() == 2);
+
+    // Corners on the shared edge match by position but not by texcoord, so
+    // only exact (position, normal, texcoord) triples merge
+    const MeshData& quads = data.meshes[0];
+    REQUIRE(quads.vertices.size() == 8);
+    REQUIRE(quads.indices.size() == 12);
+    for (u32 index : quads.indices) {
+        REQUIRE(index < quads.vertices.size());
+    }
+    // Texcoord v is flipped on import
+    REQUIRE(find_vertex(quads, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f}) >= 0);
+    REQUIRE(find_vertex(quads, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f}) >= 0);
+    REQUIRE(find_vertex(quads, {1.0f, 1.0f, 0.0f}, {1.0f, 0.0f}) >= 0);
+
+    const MeshData& flipped = data.meshes[1];
+    REQUIRE(flipped.indices == std::vector<u32>{0, 1, 2});
+    REQUIRE(flipped.vertices[0].normal == glm::vec3(0.0f, 0.0f, -1.0f));
+    REQUIRE(flipped.vertices[2].normal == glm::vec3(0.0f, 0.0f, 1.0f));
+}
+} // namespace
+
+// ============================================================================
+// OBJ Import Tests
+// ============================================================================
+
+TEST_CASE("OBJ import merges only identical index triples", "[assets][obj]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = write_obj("horizon_test_two_shapes.obj", TWO_SHAPES);
+
+    SECTION("Single thread") {
+        check_two_shapes(Model::import_obj(path.string()));
+    }
+    SECTION("Shapes imported on the job system") {
+        JobSystem::init({.worker_count = 3});
+        check_two_shapes(Model::import_obj(path.string()));
+        JobSystem::shutdown();
+    }
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("OBJ import dedupes a shared grid", "[assets][obj]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    // 3 x 3 grid of quads over a 4 x 4 lattice, positions only
+    std::string obj;
+    for (u32 y = 0; y < 4; ++y) {
+        for (u32 x = 0; x < 4; ++x) {
+            obj += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\n";
+        }
+    }
+    for (u32 y = 0; y < 3; ++y) {
+        for (u32 x = 0; x < 3; ++x) {
+            const u32 a = y * 4 + x + 1;
+            obj += "f " + std::to_string(a) + " " + std::to_string(a + 1) + " " +
+                   std::to_string(a + 5) + " " + std::to_string(a + 4) + "\n";
+        }
+    }
+    const auto path = write_obj("horizon_test_grid.obj", obj.c_str());
+
+    const ModelData data = Model::import_obj(path.string());
+    REQUIRE(data.meshes.size() == 1);
+    REQUIRE(data.meshes[0].vertices.size() == 16);
+    REQUIRE(data.meshes[0].indices.size() == 3 * 3 * 6);
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("OBJ import of a missing file is empty", "[assets][obj]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    REQUIRE(Model::import_obj("horizon_test_missing.obj").meshes.empty());
+    Log::shutdown();
+}
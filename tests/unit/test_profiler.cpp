@@ -0,0 +1,184 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Unit tests for the CPU profiler
+ */
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
+#include <engine/core/profiler.hpp>
+
+using namespace hz;
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+TEST_CASE("Profiler records nested zones", "[core][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    {
+        ProfileScope outer("outer");
+        {
+            ProfileScope inner("inner");
+        }
+        ProfileScope sibling("sibling");
+    }
+    Profiler::end_frame();
+
+    const ProfileFrame& frame = Profiler::last_frame();
+    REQUIRE(frame.zones.size() == 3);
+
+    // Sorted by start time: outer, inner, sibling
+    const ProfileZone& outer = frame.zones[0];
+    const ProfileZone& inner = frame.zones[1];
+    const ProfileZone& sibling = frame.zones[2];
+    REQUIRE(std::string(outer.name) == "outer");
+    REQUIRE(std::string(inner.name) == "inner");
+    REQUIRE(std::string(sibling.name) == "sibling");
+    REQUIRE(outer.depth == 0);
+    REQUIRE(inner.depth == 1);
+    REQUIRE(sibling.depth == 1);
+    REQUIRE(outer.start_ns <= inner.start_ns);
+    REQUIRE(inner.end_ns <= sibling.start_ns);
+    REQUIRE(sibling.end_ns <= outer.end_ns);
+
+    // Drained zones are not reported again
+    Profiler::end_frame();
+    REQUIRE(Profiler::last_frame().zones.empty());
+
+    Log::shutdown();
+}
+
+TEST_CASE("Profiler collects zones from other threads", "[core][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    std::thread worker([] {
+        Profiler::set_thread_name("Test worker");
+        for (int i = 0; i < 10; ++i) {
+            ProfileScope scope("work");
+        }
+    });
+    worker.join();
+    {
+        ProfileScope scope("main");
+    }
+    Profiler::end_frame();
+
+    u32 work = 0;
+    u32 worker_id = 0;
+    for (const ProfileZone& zone : Profiler::last_frame().zones) {
+        if (std::string(zone.name) == "work") {
+            ++work;
+            worker_id = zone.thread_id;
+        }
+    }
+    REQUIRE(work == 10);
+
+    bool named = false;
+    for (const ProfileThreadInfo& thread : Profiler::threads()) {
+        named |= thread.id == worker_id && thread.name == "Test worker";
+    }
+    REQUIRE(named);
+
+    Log::shutdown();
+}
+
+TEST_CASE("Profiler drops zones when a ring is full", "[core][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    for (usize i = 0; i < Profiler::RING_CAPACITY + 100; ++i) {
+        ProfileScope scope("spam");
+    }
+    Profiler::end_frame();
+    REQUIRE(Profiler::last_frame().zones.size() == Profiler::RING_CAPACITY);
+
+    u64 dropped = 0;
+    for (const ProfileThreadInfo& thread : Profiler::threads()) {
+        dropped += thread.dropped_zones;
+    }
+    REQUIRE(dropped == 100);
+
+    Log::shutdown();
+}
+
+TEST_CASE("Profiler can be disabled at runtime", "[core][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    Profiler::set_enabled(false);
+    {
+        ProfileScope scope("ignored");
+    }
+    Profiler::set_enabled(true);
+    Profiler::end_frame();
+    REQUIRE(Profiler::last_frame().zones.empty());
+
+    Log::shutdown();
+}
+
+TEST_CASE("Profiler interns runtime names", "[core][profiler]") {
+    const std::string a = "system";
+    const std::string b = "system";
+    REQUIRE(Profiler::intern(a) == Profiler::intern(b));
+    REQUIRE(std::string(Profiler::intern(a)) == "system");
+}
+
+#ifdef HZ_PROFILER
+TEST_CASE("HZ_PROFILE_SCOPE records a zone", "[core][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    {
+        HZ_PROFILE_SCOPE("macro");
+    }
+    HZ_PROFILE_FRAME();
+    REQUIRE(Profiler::last_frame().zones.size() == 1);
+
+    Log::shutdown();
+}
+#endif
+
+// ============================================================================
+// Export
+// ============================================================================
+
+TEST_CASE("Profiler exports a capture as Chrome trace JSON", "[core][profiler]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    Profiler::reset();
+
+    {
+        ProfileScope scope("before capture");
+    }
+    Profiler::end_frame();
+
+    Profiler::begin_capture();
+    for (int frame = 0; frame < 3; ++frame) {
+        {
+            ProfileScope scope("quoted \"zone\"");
+        }
+        Profiler::end_frame();
+    }
+    Profiler::end_capture();
+    Profiler::end_frame();
+
+    REQUIRE(Profiler::capture().size() == 3);
+
+    std::ostringstream out;
+    Profiler::write_chrome_trace(out, Profiler::capture());
+    const std::string json = out.str();
+
+    REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    REQUIRE(json.find("\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(json.find("\"thread_name\"") != std::string::npos);
+    REQUIRE(json.find("quoted \\\"zone\\\"") != std::string::npos);
+    REQUIRE(json.find("before capture") == std::string::npos);
+
+    Log::shutdown();
+}
@@ -0,0 +1,425 @@
+/**
+ * @file test_scene_serializer.cpp
+ * @brief Unit tests for JSON and binary scene serialization
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
+#include <engine/scene/component_registry.hpp>
+#include <engine/scene/scene_layout.hpp>
+#include <engine/scene/scene_serializer.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace hz;
+
+namespace {
+// The same reflected fields, with the members declared in the opposite order
+struct LayoutAB {
+    f32 a{0.0f};
+    i32 b{0};
+};
+struct LayoutBA {
+    i32 b{0};
+    f32 a{0.0f};
+};
+
+// Plain fields, but with padding after the first
+struct PaddedLayout {
+    u8 tag{0};
+    f32 value{0.0f};
+};
+} // namespace
+
+template <>
+struct hz::Reflect<LayoutAB> {
+    static constexpr std::string_view name = "Layout";
+    static constexpr auto fields = std::tuple{field("a", &LayoutAB::a), field("b", &LayoutAB::b)};
+};
+
+template <>
+struct hz::Reflect<LayoutBA> {
+    static constexpr std::string_view name = "Layout";
+    static constexpr auto fields = std::tuple{field("a", &LayoutBA::a), field("b", &LayoutBA::b)};
+};
+
+template <>
+struct hz::Reflect<PaddedLayout> {
+    static constexpr std::string_view name = "PaddedLayout";
+    static constexpr auto fields =
+        std::tuple{field("tag", &PaddedLayout::tag), field("value", &PaddedLayout::value)};
+};
+
+namespace {
+std::filesystem::path temp_path(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+
+void populate(Scene& scene, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        const Entity entity = scene.create_entity();
+        scene.registry().emplace<TagComponent>(entity, "entity_" + std::to_string(i));
+        auto& transform = scene.registry().emplace<TransformComponent>(entity);
+        transform.position = glm::vec3(static_cast<f32>(i), 2.0f, -1.0f);
+        transform.scale = glm::vec3(0.5f);
+        if (i % 2 == 0) {
+            auto& mesh = scene.registry().emplace<MeshComponent>(entity);
+            mesh.mesh_type = MeshComponent::MeshType::Model;
+            mesh.model = {i + 1, 3};
+            mesh.albedo_path = "textures/albedo_" + std::to_string(i) + ".png";
+            mesh.roughness = 0.25f;
+        }
+        if (i % 3 == 0) {
+            auto& light = scene.registry().emplace<LightComponent>(entity);
+            light.type = LightType::Directional;
+            light.intensity = static_cast<f32>(i);
+        }
+    }
+}
+
+Entity find_tagged(Scene& scene, const std::string& tag) {
+    for (auto [entity, tc] : scene.registry().view<TagComponent>().each()) {
+        if (tc.tag == tag) {
+            return entity;
+        }
+    }
+    FAIL("No entity tagged " << tag);
+    return entt::null;
+}
+
+void require_same_scene(Scene& expected, Scene& actual, u32 count) {
+    REQUIRE(actual.registry().storage<TransformComponent>().size() ==
+            expected.registry().storage<TransformComponent>().size());
+    for (u32 i = 0; i < count; ++i) {
+        const std::string tag = "entity_" + std::to_string(i);
+        const Entity a = find_tagged(expected, tag);
+        const Entity b = find_tagged(actual, tag);
+        auto& ra = expected.registry();
+        auto& rb = actual.registry();
+
+        REQUIRE(rb.get<TransformComponent>(b).position == ra.get<TransformComponent>(a).position);
+        REQUIRE(rb.get<TransformComponent>(b).scale == ra.get<TransformComponent>(a).scale);
+
+        REQUIRE(rb.all_of<MeshComponent>(b) == ra.all_of<MeshComponent>(a));
+        if (ra.all_of<MeshComponent>(a)) {
+            const auto& ma = ra.get<MeshComponent>(a);
+            const auto& mb = rb.get<MeshComponent>(b);
+            REQUIRE(mb.mesh_type == ma.mesh_type);
+            REQUIRE(mb.model == ma.model);
+            REQUIRE(mb.albedo_path == ma.albedo_path);
+            REQUIRE(mb.primitive_name == ma.primitive_name);
+            REQUIRE(mb.roughness == ma.roughness);
+        }
+
+        REQUIRE(rb.all_of<LightComponent>(b) == ra.all_of<LightComponent>(a));
+        if (ra.all_of<LightComponent>(a)) {
+            REQUIRE(rb.get<LightComponent>(b).type == ra.get<LightComponent>(a).type);
+            REQUIRE(rb.get<LightComponent>(b).intensity == ra.get<LightComponent>(a).intensity);
+        }
+    }
+}
+
+/// One entity carrying every serialized component besides the populate() ones
+Entity populate_gameplay(Scene& scene) {
+    auto& registry = scene.registry();
+    const Entity parent = scene.create_entity();
+    registry.emplace<TagComponent>(parent, "crate");
+    registry.emplace<TransformComponent>(parent);
+
+    auto& body = registry.emplace<RigidBodyComponent>(parent);
+    body.type = RigidBodyComponent::BodyType::Dynamic;
+    body.mass = 12.0f;
+    registry.emplace<BoxColliderComponent>(parent).half_extents = glm::vec3(0.5f, 1.0f, 2.0f);
+    registry.emplace<CapsuleColliderComponent>(parent).radius = 0.75f;
+    registry.emplace<LifetimeComponent>(parent).time_remaining = 3.0f;
+    registry.emplace<CameraComponent>(parent).fov = 90.0f;
+    registry.emplace<IKTargetComponent>(parent).end_bone_id = 7;
+
+    auto& hitboxes = registry.emplace<HitboxComponent>(parent);
+    Hitbox head;
+    head.name = "head";
+    head.type = HitboxType::Head;
+    head.shape = HitboxShape::Sphere;
+    head.damage_multiplier = 4.0f;
+    hitboxes.hitboxes = {head, Hitbox{}};
+    hitboxes.bone_names = {"spine", "neck"};
+    registry.emplace<HurtboxComponent>(parent).armor = 25.0f;
+
+    auto& destructible = registry.emplace<DestructibleComponent>(parent);
+    destructible.material = Materials::wood();
+    destructible.stages = {{0.5f, "crate_damaged.glb", "crack.wav", ""}};
+    auto& prop = registry.emplace<PhysicsPropComponent>(parent);
+    prop.interaction_type = InteractionType::Grab;
+    prop.grab_distance = 1.5f;
+    registry.emplace<MaterialComponent>(parent).material.name = "oak";
+
+    const Entity child = scene.create_entity();
+    registry.emplace<TagComponent>(child, "lid");
+    registry.emplace<TransformComponent>(child);
+    REQUIRE(set_parent(registry, child, parent));
+    return child;
+}
+
+void require_same_gameplay(Scene& scene) {
+    auto& registry = scene.registry();
+    const Entity parent = find_tagged(scene, "crate");
+    const Entity child = find_tagged(scene, "lid");
+    REQUIRE(get_parent(registry, child) == parent);
+
+    const auto& body = registry.get<RigidBodyComponent>(parent);
+    REQUIRE(body.type == RigidBodyComponent::BodyType::Dynamic);
+    REQUIRE(body.mass == 12.0f);
+    REQUIRE(registry.get<BoxColliderComponent>(parent).half_extents == glm::vec3(0.5f, 1.0f, 2.0f));
+    REQUIRE(registry.get<CapsuleColliderComponent>(parent).radius == 0.75f);
+    REQUIRE(registry.get<LifetimeComponent>(parent).time_remaining == 3.0f);
+    REQUIRE(registry.get<CameraComponent>(parent).fov == 90.0f);
+    REQUIRE(registry.get<IKTargetComponent>(parent).end_bone_id == 7);
+
+    const auto& hitboxes = registry.get<HitboxComponent>(parent);
+    REQUIRE(hitboxes.hitboxes.size() == 2);
+    REQUIRE(hitboxes.hitboxes[0].name == "head");
+    REQUIRE(hitboxes.hitboxes[0].type == HitboxType::Head);
+    REQUIRE(hitboxes.hitboxes[0].shape == HitboxShape::Sphere);
+    REQUIRE(hitboxes.hitboxes[0].damage_multiplier == 4.0f);
+    REQUIRE(hitboxes.bone_names == std::vector<std::string>{"spine", "neck"});
+    REQUIRE(registry.get<HurtboxComponent>(parent).armor == 25.0f);
+
+    const auto& destructible = registry.get<DestructibleComponent>(parent);
+    REQUIRE(destructible.material.type == PhysicsMaterialType::Wood);
+    REQUIRE(destructible.stages.size() == 1);
+    REQUIRE(destructible.stages[0].model_path == "crate_damaged.glb");
+    REQUIRE(registry.get<PhysicsPropComponent>(parent).interaction_type ==
+            InteractionType::Grab);
+    REQUIRE(registry.get<PhysicsPropComponent>(parent).grab_distance == 1.5f);
+    REQUIRE(registry.get<MaterialComponent>(parent).material.name == "oak");
+}
+
+std::string read_text(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+// ============================================================================
+// Binary Format Tests
+// ============================================================================
+
+TEST_CASE("Binary scene round-trips every component", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    constexpr u32 COUNT = 50;
+    const auto path = temp_path("horizon_test_scene.hzscene");
+
+    Scene scene;
+    populate(scene, COUNT);
+    REQUIRE(SceneSerializer(scene).serialize_binary(path));
+
+    Scene loaded;
+    loaded.create_entity(); // Replaced by the load
+    REQUIRE(SceneSerializer(loaded).deserialize_binary(path));
+    require_same_scene(scene, loaded, COUNT);
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("Binary scene rejects bad files without touching the scene", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_bad_scene.hzscene");
+
+    Scene source;
+    populate(source, 4);
+    REQUIRE(SceneSerializer(source).serialize_binary(path));
+
+    std::vector<char> bytes(std::filesystem::file_size(path));
+    std::ifstream(path, std::ios::binary)
+        .read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    auto write = [&](const std::vector<char>& data) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc)
+            .write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+
+    Scene scene;
+    const Entity kept = scene.create_entity();
+    SceneSerializer serializer(scene);
+
+    SECTION("Missing file") {
+        REQUIRE_FALSE(serializer.deserialize_binary(temp_path("horizon_test_missing.hzscene")));
+    }
+    SECTION("Wrong magic") {
+        auto corrupt = bytes;
+        corrupt[0] = 'X';
+        write(corrupt);
+        REQUIRE_FALSE(serializer.deserialize_binary(path));
+    }
+    SECTION("Wrong version") {
+        auto corrupt = bytes;
+        corrupt[4] = static_cast<char>(SCENE_BINARY_VERSION + 1);
+        write(corrupt);
+        REQUIRE_FALSE(serializer.deserialize_binary(path));
+    }
+    SECTION("Truncated") {
+        const auto half = static_cast<std::ptrdiff_t>(bytes.size() / 2);
+        write(std::vector<char>(bytes.begin(), bytes.begin() + half));
+        REQUIRE_FALSE(serializer.deserialize_binary(path));
+    }
+
+    REQUIRE(scene.is_valid(kept));
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+// ============================================================================
+// Registry Tests
+// ============================================================================
+
+TEST_CASE("Every registered component round-trips in both formats", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto json_path = temp_path("horizon_test_registry.json");
+    const auto binary_path = temp_path("horizon_test_registry.hzscene");
+
+    Scene scene;
+    populate(scene, 3);
+    populate_gameplay(scene);
+    REQUIRE(SceneSerializer(scene).serialize(json_path));
+    REQUIRE(SceneSerializer(scene).serialize_binary(binary_path));
+
+    Scene from_json;
+    REQUIRE(SceneSerializer(from_json).deserialize(json_path));
+    require_same_scene(scene, from_json, 3);
+    require_same_gameplay(from_json);
+
+    Scene from_binary;
+    REQUIRE(SceneSerializer(from_binary).deserialize_binary(binary_path));
+    require_same_scene(scene, from_binary, 3);
+    require_same_gameplay(from_binary);
+
+    std::filesystem::remove(json_path);
+    std::filesystem::remove(binary_path);
+    Log::shutdown();
+}
+
+TEST_CASE("Entity references to unsaved entities load as null", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_stale_ref.hzscene");
+
+    Scene scene;
+    const Entity child = scene.create_entity();
+    scene.registry().emplace<TagComponent>(child, "orphan");
+    const Entity parent = scene.create_entity();
+    scene.registry().emplace<HierarchyComponent>(child, parent);
+    scene.destroy_entity(parent);
+    REQUIRE(SceneSerializer(scene).serialize_binary(path));
+
+    Scene loaded;
+    REQUIRE(SceneSerializer(loaded).deserialize_binary(path));
+    const Entity orphan = find_tagged(loaded, "orphan");
+    REQUIRE(loaded.registry().get<HierarchyComponent>(orphan).parent == entt::null);
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+TEST_CASE("JSON load skips unknown components and migrates old fields", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_legacy.json");
+    std::ofstream(path) << R"({"entities": [{
+        "id": 0,
+        "TagComponent": {"tag": "legacy"},
+        "RetiredComponent": {"value": 1},
+        "MeshComponent": {"mesh_path": "sphere"}
+    }]})";
+
+    Scene scene;
+    REQUIRE(SceneSerializer(scene).deserialize(path));
+    const Entity entity = find_tagged(scene, "legacy");
+    const auto& mesh = scene.registry().get<MeshComponent>(entity);
+    REQUIRE(mesh.primitive_name == "sphere");
+    REQUIRE(mesh.roughness == MeshComponent{}.roughness);
+
+    REQUIRE(SceneSerializer(scene).serialize(path));
+    REQUIRE(read_text(path).find("RetiredComponent") == std::string::npos);
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
+
+// ============================================================================
+// Conversion Tests
+// ============================================================================
+
+TEST_CASE("JSON and binary scenes convert both ways", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    constexpr u32 COUNT = 12;
+    const auto json_path = temp_path("horizon_test_scene.json");
+    const auto binary_path = temp_path("horizon_test_converted.hzscene");
+    const auto json_again_path = temp_path("horizon_test_converted.json");
+
+    Scene scene;
+    populate(scene, COUNT);
+    REQUIRE(SceneSerializer(scene).serialize(json_path));
+
+    REQUIRE(SceneSerializer::convert_json_to_binary(json_path, binary_path));
+    REQUIRE(SceneSerializer::convert_binary_to_json(binary_path, json_again_path));
+
+    Scene from_binary;
+    REQUIRE(SceneSerializer(from_binary).deserialize_binary(binary_path));
+    require_same_scene(scene, from_binary, COUNT);
+
+    Scene from_json;
+    REQUIRE(SceneSerializer(from_json).deserialize(json_again_path));
+    require_same_scene(scene, from_json, COUNT);
+
+    std::filesystem::remove(json_path);
+    std::filesystem::remove(binary_path);
+    std::filesystem::remove(json_again_path);
+    Log::shutdown();
+}
+
+// ============================================================================
+// Layout Tests
+// ============================================================================
+
+TEST_CASE("Only components whose fields tile them are stored raw", "[scene][serializer]") {
+    STATIC_REQUIRE(is_raw_component_v<LayoutAB>);
+    STATIC_REQUIRE(is_raw_component_v<LayoutBA>);
+    STATIC_REQUIRE_FALSE(is_raw_component_v<PaddedLayout>);
+    // Bools and unreflected last-hit state
+    STATIC_REQUIRE_FALSE(is_raw_component_v<HurtboxComponent>);
+}
+
+TEST_CASE("Raw layouts with swapped members hash differently", "[scene][serializer]") {
+    REQUIRE(component_id<LayoutAB>() == component_id<LayoutBA>());
+    REQUIRE(component_layout<LayoutAB>() != component_layout<LayoutBA>());
+    REQUIRE(component_layout<LayoutAB>() == component_layout<LayoutAB>());
+}
+
+TEST_CASE("Binary scenes do not save unreflected component state", "[scene][serializer]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    const auto path = temp_path("horizon_test_hurtbox.hzscene");
+
+    Scene scene;
+    auto& hurtbox = scene.registry().emplace<HurtboxComponent>(scene.create_entity());
+    hurtbox.is_dead = true;
+    hurtbox.last_damage_amount = 40.0f;
+    hurtbox.last_damage_direction = glm::vec3(1.0f, 0.0f, 0.0f);
+    REQUIRE(SceneSerializer(scene).serialize_binary(path));
+
+    Scene loaded;
+    REQUIRE(SceneSerializer(loaded).deserialize_binary(path));
+    auto view = loaded.registry().view<HurtboxComponent>();
+    REQUIRE(view.size() == 1);
+    const auto& loaded_hurtbox = view.get<HurtboxComponent>(*view.begin());
+    REQUIRE(loaded_hurtbox.is_dead);
+    REQUIRE(loaded_hurtbox.last_damage_amount == 0.0f);
+    REQUIRE(loaded_hurtbox.last_damage_direction == glm::vec3(0.0f));
+
+    std::filesystem::remove(path);
+    Log::shutdown();
+}
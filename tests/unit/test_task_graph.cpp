@@ -0,0 +1,132 @@
+/**
+ * @file test_task_graph.cpp
+ * @brief Unit tests for the update system task graph
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
+#include <engine/core/task_graph.hpp>
+
+using namespace hz;
+
+namespace {
+struct Position {};
+struct Velocity {};
+struct Health {};
+
+void sleep_ms(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+} // namespace
+
+// ============================================================================
+// Dependency Construction
+// ============================================================================
+
+TEST_CASE("TaskGraph derives dependencies from data access", "[core][task_graph]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    TaskGraph graph;
+    const u32 movement = graph.add_system("move", [](f64) {}).writes<Position>().index();
+    const u32 damage = graph.add_system("damage", [](f64) {}).writes<Health>().index();
+    const u32 render_prep = graph.add_system("render_prep", [](f64) {}).reads<Position>().index();
+    const u32 audio = graph.add_system("audio", [](f64) {}).reads<Position>().index();
+    const u32 cleanup = graph.add_system("cleanup", [](f64) {}).exclusive().index();
+
+    REQUIRE(graph.dependencies(movement).empty());
+    REQUIRE(graph.dependencies(damage).empty());
+    REQUIRE(graph.dependencies(render_prep) == std::vector<u32>{movement});
+    // Two readers do not conflict
+    REQUIRE(graph.dependencies(audio) == std::vector<u32>{movement});
+    // Exclusive systems depend on everything registered before them
+    REQUIRE(graph.dependencies(cleanup).size() == 4);
+
+    Log::shutdown();
+}
+
+// ============================================================================
+// Execution
+// ============================================================================
+
+TEST_CASE("TaskGraph executes inline without a job system", "[core][task_graph]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    std::vector<int> order;
+    TaskGraph graph;
+    graph.add_system("a", [&](f64) { order.push_back(0); }).writes<Position>();
+    graph.add_system("b", [&](f64) { order.push_back(1); }).reads<Position>();
+    graph.add_system("c", [&](f64 dt) { order.push_back(dt == 0.5 ? 2 : -1); }).main_thread();
+
+    graph.execute(0.5);
+
+    REQUIRE(order.size() == 3);
+    REQUIRE(std::find(order.begin(), order.end(), 2) != order.end());
+    REQUIRE(std::find(order.begin(), order.end(), 0) <
+            std::find(order.begin(), order.end(), 1));
+
+    Log::shutdown();
+}
+
+TEST_CASE("TaskGraph runs independent systems in parallel", "[core][task_graph]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+    JobSystem::init({.worker_count = 3});
+
+    std::atomic<int> step{0};
+    std::atomic<int> writer_done_at{-1};
+    std::atomic<int> reader_saw{-1};
+    std::atomic<u32> main_thread_index{99};
+
+    TaskGraph graph;
+    auto writer = [&](f64) {
+        sleep_ms(5);
+        writer_done_at = step.fetch_add(1);
+    };
+    graph.add_system("writer", writer).writes<Position>();
+    graph.add_system("reader", [&](f64) { reader_saw = step.fetch_add(1); }).reads<Position>();
+    graph.add_system("independent_a", [&](f64) { sleep_ms(5); }).writes<Health>();
+    graph.add_system("independent_b", [&](f64) { sleep_ms(5); }).writes<Velocity>();
+    graph.add_system("main", [&](f64) { main_thread_index = JobSystem::thread_index(); })
+        .main_thread();
+
+    for (int i = 0; i < 3; ++i) {
+        step = 0;
+        graph.execute(1.0 / 60.0);
+        REQUIRE(writer_done_at.load() < reader_saw.load());
+        REQUIRE(main_thread_index.load() == 0);
+    }
+
+    const TaskGraphStats& stats = graph.stats();
+    REQUIRE(stats.serial_ms >= 15.0);
+    REQUIRE(stats.critical_path_ms <= stats.serial_ms);
+    REQUIRE(stats.wall_ms < stats.serial_ms);
+
+    JobSystem::shutdown();
+    Log::shutdown();
+}
+
+TEST_CASE("TaskGraph reports the critical path", "[core][task_graph]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    TaskGraph graph;
+    const u32 slow = graph.add_system("slow", [](f64) { sleep_ms(10); }).writes<Position>().index();
+    const u32 fast = graph.add_system("fast", [](f64) { sleep_ms(1); }).writes<Health>().index();
+    const u32 after_slow =
+        graph.add_system("after_slow", [](f64) { sleep_ms(2); }).reads<Position>().index();
+
+    graph.execute(0.0);
+
+    const TaskGraphStats& stats = graph.stats();
+    REQUIRE(stats.critical_path == std::vector<u32>{slow, after_slow});
+    REQUIRE(graph.timing(slow).on_critical_path);
+    REQUIRE(graph.timing(after_slow).on_critical_path);
+    REQUIRE_FALSE(graph.timing(fast).on_critical_path);
+    REQUIRE(stats.critical_path_ms >= 12.0);
+
+    Log::shutdown();
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_telemetry.cpp
+ * @brief Unit tests for frame-time telemetry
+ */
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/game_loop.hpp>
+#include <engine/core/log.hpp>
+#include <engine/core/telemetry.hpp>
+
+using namespace hz;
+
+// ============================================================================
+// LatencyHistogram Tests
+// ============================================================================
+
+TEST_CASE("LatencyHistogram counts small values exactly", "[core][telemetry]") {
+    LatencyHistogram histogram;
+    for (u64 value = 1; value <= 100; ++value) {
+        histogram.record(value);
+    }
+
+    REQUIRE(histogram.count() == 100);
+    REQUIRE(histogram.min() == 1);
+    REQUIRE(histogram.max() == 100);
+    REQUIRE(histogram.mean() == Catch::Approx(50.5));
+    REQUIRE(histogram.value_at_percentile(50.0) == 50);
+    REQUIRE(histogram.value_at_percentile(99.0) == 99);
+    REQUIRE(histogram.value_at_percentile(100.0) == 100);
+}
+
+TEST_CASE("LatencyHistogram percentiles stay within bucket precision", "[core][telemetry]") {
+    LatencyHistogram histogram;
+    // 1 ms .. 100 ms in nanoseconds
+    for (u64 ms = 1; ms <= 100; ++ms) {
+        histogram.record(ms * 1'000'000);
+    }
+
+    const PercentileSummary summary = histogram.summary(1e-6);
+    REQUIRE(summary.count == 100);
+    REQUIRE(summary.p50 == Catch::Approx(50.0).epsilon(1.0 / 64.0));
+    REQUIRE(summary.p95 == Catch::Approx(95.0).epsilon(1.0 / 64.0));
+    REQUIRE(summary.p99 == Catch::Approx(99.0).epsilon(1.0 / 64.0));
+    REQUIRE(summary.max == Catch::Approx(100.0));
+}
+
+TEST_CASE("LatencyHistogram surfaces rare hitches", "[core][telemetry]") {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 990; ++i) {
+        histogram.record(8'000'000); // 8 ms
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(80'000'000); // 80 ms
+    }
+
+    const PercentileSummary summary = histogram.summary(1e-6);
+    REQUIRE(summary.mean < 9.0);
+    REQUIRE(summary.p50 == Catch::Approx(8.0).epsilon(1.0 / 64.0));
+    REQUIRE(summary.p99 == Catch::Approx(8.0).epsilon(1.0 / 64.0));
+    REQUIRE(histogram.value_at_percentile(99.5) >= 79'000'000);
+    REQUIRE(summary.max == Catch::Approx(80.0));
+}
+
+TEST_CASE("LatencyHistogram merge and reset", "[core][telemetry]") {
+    LatencyHistogram a;
+    LatencyHistogram b;
+    a.record(10);
+    b.record(1000);
+    b.record(LatencyHistogram::MAX_VALUE * 2); // Clamped bucket, exact max
+
+    a.merge(b);
+    REQUIRE(a.count() == 3);
+    REQUIRE(a.min() == 10);
+    REQUIRE(a.max() == LatencyHistogram::MAX_VALUE * 2);
+
+    a.reset();
+    REQUIRE(a.count() == 0);
+    REQUIRE(a.value_at_percentile(50.0) == 0);
+}
+
+// ============================================================================
+// FrameTelemetry Tests
+// ============================================================================
+
+TEST_CASE("FrameTelemetry detects a spiral of death", "[core][telemetry]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    FrameTelemetry telemetry({.spiral_frame_threshold = 3});
+    for (int i = 0; i < 5; ++i) {
+        telemetry.record_frame(1.0 / 60.0, 1);
+    }
+    REQUIRE_FALSE(telemetry.in_spiral());
+
+    for (int i = 0; i < 4; ++i) {
+        telemetry.record_clamp();
+        telemetry.record_frame(0.5, 15);
+    }
+    REQUIRE(telemetry.in_spiral());
+    REQUIRE(telemetry.clamped_frames() == 4);
+    REQUIRE(telemetry.spiral_events() == 1);
+
+    telemetry.record_frame(1.0 / 60.0, 1);
+    REQUIRE_FALSE(telemetry.in_spiral());
+
+    REQUIRE(telemetry.frame_count() == 10);
+    REQUIRE(telemetry.updates_per_frame().max == Catch::Approx(15.0));
+    REQUIRE(telemetry.frame_times().max == Catch::Approx(500.0));
+
+    Log::shutdown();
+}
+
+TEST_CASE("FrameTelemetry records systems and dumps CSV and JSON", "[core][telemetry]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    TaskGraph graph;
+    graph.add_system("sleepy",
+                     [](f64) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    graph.add_system("fast", [](f64) {});
+
+    FrameTelemetry telemetry;
+    for (int i = 0; i < 3; ++i) {
+        graph.execute(0.0);
+        telemetry.record_systems(graph);
+        telemetry.record_frame(0.004, 1);
+    }
+
+    REQUIRE(telemetry.system_times("sleepy").count == 3);
+    REQUIRE(telemetry.system_times("sleepy").p50 >= 1.9);
+    REQUIRE(telemetry.system_times("missing").count == 0);
+
+    std::ostringstream csv;
+    telemetry.write_csv(csv);
+    REQUIRE(csv.str().starts_with("metric,count,mean,p50,p95,p99,max\n"));
+    REQUIRE(csv.str().find("frame_time_ms,3,") != std::string::npos);
+    REQUIRE(csv.str().find("system.sleepy_ms,3,") != std::string::npos);
+
+    std::ostringstream json;
+    telemetry.write_json(json);
+    REQUIRE(json.str().find("\"frame_time_ms\": {\"count\":3") != std::string::npos);
+    REQUIRE(json.str().find("\"fast\": {\"count\":3") != std::string::npos);
+    REQUIRE(json.str().find("\"spiral_events\": 0") != std::string::npos);
+
+    Log::shutdown();
+}
+
+TEST_CASE("GameLoop feeds telemetry", "[core][telemetry][gameloop]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    GameLoopConfig config;
+    config.fixed_timestep = 1.0 / 200.0;
+    config.log_fps = false;
+    GameLoop loop(config);
+
+    u32 frames = 0;
+    loop.add_system("noop", [](f64) {});
+    loop.set_render_callback([&](f64) {
+        ++frames;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    loop.set_should_quit_callback([&] { return frames >= 30; });
+    loop.run();
+
+    REQUIRE(loop.telemetry().frame_count() == 30);
+    REQUIRE(loop.telemetry().frame_times().p50 > 0.0);
+    REQUIRE(loop.telemetry().system_times("noop").count == loop.tick_count());
+
+    Log::shutdown();
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_texture_residency.cpp
+ * @brief Unit tests for mip residency planning against a VRAM budget
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <engine/assets/texture_residency.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace hz;
+
+namespace {
+constexpr u32 SIZE = 1024; // BC7: 1 byte per texel, tail at 64x64 (mip 4)
+constexpr u32 MIPS = 11;
+
+void track_texture(TextureResidency& residency, u32 id, u32 resident_mip = 4) {
+    residency.track(id, SIZE, SIZE, TextureFormat::BC7, MIPS, resident_mip);
+}
+
+u64 bytes_from(u32 mip) {
+    return TextureResidency::chain_bytes(TextureFormat::BC7, SIZE, SIZE, mip, MIPS);
+}
+
+/// Run update() and complete every change it starts
+std::vector<TextureMipChange> update_and_complete(TextureResidency& residency) {
+    std::vector<TextureMipChange> changes = residency.update();
+    for (const TextureMipChange& change : changes) {
+        residency.complete(change.id, change.mip);
+    }
+    return changes;
+}
+
+bool changes_contain(const std::vector<TextureMipChange>& changes, u32 id, u32 mip) {
+    return std::any_of(changes.begin(), changes.end(), [&](const TextureMipChange& change) {
+        return change.id == id && change.mip == mip;
+    });
+}
+} // namespace
+
+// ============================================================================
+// Helper Tests
+// ============================================================================
+
+TEST_CASE("Residency sizes follow the chain", "[assets][residency]") {
+    REQUIRE(TextureResidency::chain_bytes(TextureFormat::BC7, SIZE, SIZE, 10, MIPS) == 16);
+    REQUIRE(bytes_from(0) - bytes_from(1) == SIZE * SIZE);
+    REQUIRE(TextureResidency::chain_bytes(TextureFormat::RGBA8, 4, 2, 0, 3) == 32 + 8 + 4);
+    REQUIRE(TextureResidency::chain_bytes(TextureFormat::R8, 4, 4, 0, 1) == 16);
+
+    REQUIRE(TextureResidency::tail_mip_for(SIZE, SIZE, MIPS) == 4);
+    REQUIRE(TextureResidency::tail_mip_for(SIZE, 16, MIPS) == 4);
+    REQUIRE(TextureResidency::tail_mip_for(SIZE, SIZE, 3) == 2); // Partial chain
+    REQUIRE(TextureResidency::tail_mip_for(32, 32, 6) == 0);
+}
+
+TEST_CASE("Screen size picks the level with at least one texel per pixel",
+          "[assets][residency]") {
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 2000.0f) == 0);
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 1024.0f) == 0);
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 1000.0f) == 0);
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 512.0f) == 1);
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 100.0f) == 3);
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 0.5f) == 10);
+    REQUIRE(TextureResidency::mip_for_screen_size(SIZE, SIZE, 0.0f) == 10);
+
+    // A sphere twice as far away covers half the pixels
+    const f32 close_size = TextureResidency::projected_size(1.0f, 10.0f, 1.0f, 1080.0f);
+    const f32 far_size = TextureResidency::projected_size(1.0f, 20.0f, 1.0f, 1080.0f);
+    REQUIRE(close_size > 0.0f);
+    REQUIRE(far_size * 2.0f == close_size);
+    REQUIRE(TextureResidency::projected_size(5.0f, 1.0f, 1.0f, 1080.0f) == 1080.0f);
+}
+
+// ============================================================================
+// Planning Tests
+// ============================================================================
+
+TEST_CASE("Requested levels stream in once", "[assets][residency]") {
+    TextureResidency residency;
+    track_texture(residency, 0);
+    track_texture(residency, 1);
+    REQUIRE(residency.stats().tracked_textures == 2);
+    REQUIRE(residency.stats().resident_bytes == 2 * bytes_from(4));
+
+    residency.request(0, 3);
+    residency.request(0, 1); // The finest request wins
+    residency.request(1, 9); // Clamped to the tail, which is resident
+    auto changes = residency.update();
+    REQUIRE(changes.size() == 1);
+    REQUIRE(changes_contain(changes, 0, 1));
+    REQUIRE(residency.stats().pending_requests == 1);
+
+    // No second change while the first is in flight
+    residency.request(0, 0);
+    REQUIRE(residency.update().empty());
+
+    residency.complete(0, 1);
+    REQUIRE(residency.resident_mip(0) == 1);
+    REQUIRE(residency.stats().pending_requests == 0);
+    REQUIRE(residency.stats().resident_bytes == bytes_from(1) + bytes_from(4));
+
+    // Requests do not carry over: the next plan needs a new one
+    residency.request(0, 0);
+    changes = update_and_complete(residency);
+    REQUIRE(changes_contain(changes, 0, 0));
+    REQUIRE(residency.resident_mip(0) == 0);
+}
+
+TEST_CASE("Levels stream out only past the hysteresis", "[assets][residency]") {
+    TextureResidency residency;
+    track_texture(residency, 0, 0);
+
+    residency.request(0, 1);
+    REQUIRE(residency.update().empty());
+
+    residency.request(0, 2);
+    const auto changes = update_and_complete(residency);
+    REQUIRE(changes_contain(changes, 0, 2));
+    REQUIRE(residency.resident_mip(0) == 2);
+}
+
+TEST_CASE("Unrequested textures keep their levels without a budget", "[assets][residency]") {
+    TextureResidency residency;
+    track_texture(residency, 0, 0);
+    for (int frame = 0; frame < 10; ++frame) {
+        REQUIRE(residency.update().empty());
+    }
+    REQUIRE(residency.resident_mip(0) == 0);
+    REQUIRE(residency.stats().evictions == 0);
+}
+
+// ============================================================================
+// Budget Tests
+// ============================================================================
+
+TEST_CASE("Budget evicts the least recently used textures first", "[assets][residency]") {
+    TextureResidency residency;
+    for (u32 id = 0; id < 3; ++id) {
+        track_texture(residency, id);
+    }
+
+    // Texture 0 used first, then 1, then 2; all at full resolution
+    for (u32 id = 0; id < 3; ++id) {
+        residency.request(id, 0);
+        update_and_complete(residency);
+    }
+    REQUIRE(residency.stats().resident_bytes == 3 * bytes_from(0));
+
+    // Room for two full textures; texture 2 stays requested
+    residency.set_budget(2 * bytes_from(0) + bytes_from(4));
+    residency.request(2, 0);
+    const auto changes = update_and_complete(residency);
+    REQUIRE(changes.size() == 1);
+    REQUIRE(changes_contain(changes, 0, 4));
+    REQUIRE(residency.resident_mip(1) == 0);
+    REQUIRE(residency.resident_mip(2) == 0);
+
+    const TextureResidencyStats stats = residency.stats();
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.planned_bytes <= stats.budget_bytes);
+    REQUIRE(stats.resident_bytes == stats.planned_bytes);
+
+    // An evicted texture comes back when requested, at another's expense
+    residency.request(0, 0);
+    residency.request(2, 0);
+    update_and_complete(residency);
+    REQUIRE(residency.resident_mip(0) == 0);
+    REQUIRE(residency.resident_mip(1) == 4);
+    REQUIRE(residency.stats().evictions == 2);
+}
+
+TEST_CASE("Requested textures share a budget too small for all of them",
+          "[assets][residency]") {
+    TextureResidency residency;
+    track_texture(residency, 0);
+    track_texture(residency, 1);
+    residency.set_budget(bytes_from(0) + bytes_from(2));
+
+    residency.request(0, 0);
+    residency.request(1, 0);
+    update_and_complete(residency);
+
+    // The largest texture loses a level at a time, so both end up at level 1
+    REQUIRE(residency.resident_mip(0) == 1);
+    REQUIRE(residency.resident_mip(1) == 1);
+    const TextureResidencyStats stats = residency.stats();
+    REQUIRE(stats.resident_bytes <= stats.budget_bytes);
+    REQUIRE(stats.evictions == 0);
+}
+
+TEST_CASE("Tails stay resident whatever the budget", "[assets][residency]") {
+    TextureResidency residency;
+    track_texture(residency, 0, 0);
+    residency.set_budget(1);
+    const auto changes = update_and_complete(residency);
+    REQUIRE(changes_contain(changes, 0, 4));
+    REQUIRE(residency.resident_mip(0) == 4);
+    REQUIRE(residency.tail_mip(0) == 4);
+
+    residency.request(0, 0);
+    REQUIRE(residency.update().empty());
+}
+
+// ============================================================================
+// Request Lifecycle Tests
+// ============================================================================
+
+TEST_CASE("Level changes in flight are capped", "[assets][residency]") {
+    TextureResidency residency;
+    const u32 count = TextureResidency::MAX_PENDING + 4;
+    for (u32 id = 0; id < count; ++id) {
+        track_texture(residency, id);
+        residency.request(id, 0);
+    }
+    const auto changes = residency.update();
+    REQUIRE(changes.size() == TextureResidency::MAX_PENDING);
+    REQUIRE(residency.stats().pending_requests == TextureResidency::MAX_PENDING);
+
+    for (const TextureMipChange& change : changes) {
+        residency.complete(change.id, change.mip);
+    }
+    for (u32 id = 0; id < count; ++id) {
+        residency.request(id, 0);
+    }
+    REQUIRE(residency.update().size() == 4);
+}
+
+TEST_CASE("Failed and cancelled changes", "[assets][residency]") {
+    TextureResidency residency;
+    track_texture(residency, 0);
+    track_texture(residency, 1);
+
+    residency.request(0, 0);
+    residency.request(1, 0);
+    REQUIRE(residency.update().size() == 2);
+
+    // A cancelled change is planned again on the next request
+    residency.cancel(0);
+    REQUIRE(residency.resident_mip(0) == 4);
+    residency.request(0, 0);
+    REQUIRE(changes_contain(residency.update(), 0, 0));
+
+    // A failed texture stops streaming until tracked again
+    residency.fail(1);
+    REQUIRE(residency.stats().pending_requests == 1);
+    residency.request(1, 0);
+    REQUIRE(residency.update().empty());
+    track_texture(residency, 1);
+    residency.request(1, 0);
+    REQUIRE(changes_contain(residency.update(), 1, 0));
+
+    residency.untrack(0);
+    REQUIRE_FALSE(residency.is_tracked(0));
+    REQUIRE(residency.stats().pending_requests == 1);
+    residency.clear();
+    REQUIRE(residency.stats().tracked_textures == 0);
+    REQUIRE(residency.stats().pending_requests == 0);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file test_transform_snapshot.cpp
+ * @brief Unit tests for transform snapshots used by pipelined rendering
+ */
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/scene/transform_snapshot.hpp>
+
+using namespace hz;
+
+// ============================================================================
+// TransformSnapshot Tests
+// ============================================================================
+
+TEST_CASE("TransformSnapshotWriter tracks previous transforms", "[scene][snapshot]") {
+    Scene scene;
+    auto a = scene.create_entity();
+    auto b = scene.create_entity();
+    scene.registry().emplace<TransformComponent>(a).position = {0.0f, 0.0f, 0.0f};
+    scene.registry().emplace<TransformComponent>(b).position = {5.0f, 0.0f, 0.0f};
+
+    TransformSnapshotWriter writer;
+    TransformSnapshot snapshot;
+    writer.capture(scene, 1, 0.1, snapshot);
+
+    REQUIRE(snapshot.tick == 1);
+    REQUIRE(snapshot.size() == 2);
+    // First capture has no history, so previous == current
+    auto index_a = snapshot.find(a);
+    REQUIRE(index_a.has_value());
+    REQUIRE(snapshot.previous[*index_a].position == snapshot.current[*index_a].position);
+
+    scene.registry().get<TransformComponent>(a).position = {2.0f, 0.0f, 0.0f};
+    auto c = scene.create_entity();
+    scene.registry().emplace<TransformComponent>(c).position = {9.0f, 0.0f, 0.0f};
+    writer.capture(scene, 2, 0.2, snapshot);
+
+    REQUIRE(snapshot.size() == 3);
+    index_a = snapshot.find(a);
+    REQUIRE(index_a.has_value());
+    REQUIRE(snapshot.previous[*index_a].position.x == Catch::Approx(0.0f));
+    REQUIRE(snapshot.current[*index_a].position.x == Catch::Approx(2.0f));
+
+    // Newly created entities don't interpolate from the origin
+    auto index_c = snapshot.find(c);
+    REQUIRE(index_c.has_value());
+    REQUIRE(snapshot.previous[*index_c].position.x == Catch::Approx(9.0f));
+
+    scene.destroy_entity(b);
+    writer.capture(scene, 3, 0.3, snapshot);
+    REQUIRE_FALSE(snapshot.find(b).has_value());
+}
+
+TEST_CASE("TransformSnapshot interpolation", "[scene][snapshot]") {
+    TransformSnapshot snapshot;
+    snapshot.entities.push_back(entt::entity{0});
+
+    TransformComponent from;
+    from.position = {0.0f, 0.0f, 0.0f};
+    from.rotation = {0.0f, 0.0f, 0.0f};
+    TransformComponent to;
+    to.position = {10.0f, 0.0f, 0.0f};
+    to.rotation = {0.0f, 90.0f, 0.0f};
+    snapshot.previous.push_back(from);
+    snapshot.current.push_back(to);
+
+    SECTION("Endpoints match TransformComponent::get_transform") {
+        const glm::mat4 start = snapshot.interpolate(0, 0.0f);
+        const glm::mat4 end = snapshot.interpolate(0, 1.0f);
+        const glm::mat4 expected_start = from.get_transform();
+        const glm::mat4 expected_end = to.get_transform();
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                REQUIRE(start[col][row] == Catch::Approx(expected_start[col][row]).margin(1e-5));
+                REQUIRE(end[col][row] == Catch::Approx(expected_end[col][row]).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("Midpoint blends position") {
+        const glm::mat4 mid = snapshot.interpolate(0, 0.5f);
+        REQUIRE(mid[3][0] == Catch::Approx(5.0f));
+    }
+}
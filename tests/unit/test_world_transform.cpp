@@ -0,0 +1,203 @@
+/**
+ * @file test_world_transform.cpp
+ * @brief Unit tests for the transform hierarchy and world matrix cache
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <engine/core/log.hpp>
+#include <engine/scene/world_transform.hpp>
+
+using namespace hz;
+
+namespace {
+Entity make_entity(entt::registry& registry, const glm::vec3& position) {
+    const Entity entity = registry.create();
+    registry.emplace<TransformComponent>(entity).position = position;
+    return entity;
+}
+
+glm::vec3 world_position(const WorldTransformCache& cache, Entity entity) {
+    return glm::vec3(cache.world_matrix(entity)[3]);
+}
+} // namespace
+
+// ============================================================================
+// Hierarchy Tests
+// ============================================================================
+
+TEST_CASE("set_parent rejects cycles", "[scene][hierarchy]") {
+    entt::registry registry;
+    const Entity a = registry.create();
+    const Entity b = registry.create();
+    const Entity c = registry.create();
+
+    REQUIRE(set_parent(registry, b, a));
+    REQUIRE(set_parent(registry, c, b));
+    REQUIRE_FALSE(set_parent(registry, a, c));
+    REQUIRE_FALSE(set_parent(registry, a, a));
+    REQUIRE(get_parent(registry, c) == b);
+    REQUIRE(get_parent(registry, a) == entt::null);
+
+    REQUIRE(set_parent(registry, c, entt::null));
+    REQUIRE_FALSE(registry.all_of<HierarchyComponent>(c));
+}
+
+// ============================================================================
+// WorldTransformCache Tests
+// ============================================================================
+
+TEST_CASE("WorldTransformCache matches local transforms of roots", "[scene][hierarchy]") {
+    entt::registry registry;
+    const Entity entity = make_entity(registry, {1.0f, 2.0f, 3.0f});
+    auto& transform = registry.get<TransformComponent>(entity);
+    transform.rotation = {10.0f, 20.0f, 30.0f};
+    transform.scale = {2.0f, 2.0f, 2.0f};
+
+    WorldTransformCache cache;
+    cache.update(registry);
+
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.world_matrix(entity) == transform.get_transform());
+    REQUIRE(cache.world_matrix(registry.create()) == glm::mat4(1.0f)); // Not cached
+}
+
+TEST_CASE("WorldTransformCache composes parents before children", "[scene][hierarchy]") {
+    entt::registry registry;
+    // Child created first, so storage order is not topological
+    const Entity child = make_entity(registry, {0.0f, 1.0f, 0.0f});
+    const Entity parent = make_entity(registry, {10.0f, 0.0f, 0.0f});
+    const Entity grandchild = make_entity(registry, {0.0f, 0.0f, 1.0f});
+    REQUIRE(set_parent(registry, child, parent));
+    REQUIRE(set_parent(registry, grandchild, child));
+
+    WorldTransformCache cache;
+    cache.update(registry);
+
+    REQUIRE(cache.slot(parent) < cache.slot(child));
+    REQUIRE(cache.slot(child) < cache.slot(grandchild));
+    REQUIRE(cache.parents()[cache.slot(child)] == cache.slot(parent));
+    REQUIRE(world_position(cache, grandchild).x == Catch::Approx(10.0f));
+    REQUIRE(world_position(cache, grandchild).y == Catch::Approx(1.0f));
+    REQUIRE(world_position(cache, grandchild).z == Catch::Approx(1.0f));
+
+    // Rotating the parent swings the whole subtree around it
+    registry.get<TransformComponent>(parent).rotation = {0.0f, 0.0f, 90.0f};
+    cache.update(registry);
+    REQUIRE(cache.last_update_count() == 3);
+    REQUIRE(world_position(cache, child).x == Catch::Approx(9.0f));
+    REQUIRE(world_position(cache, child).y == Catch::Approx(0.0f).margin(1e-5));
+}
+
+TEST_CASE("WorldTransformCache only recomputes dirty subtrees", "[scene][hierarchy]") {
+    entt::registry registry;
+    const Entity root = make_entity(registry, {0.0f, 0.0f, 0.0f});
+    const Entity child = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    const Entity other = make_entity(registry, {5.0f, 0.0f, 0.0f});
+    REQUIRE(set_parent(registry, child, root));
+
+    WorldTransformCache cache;
+    cache.update(registry);
+    REQUIRE(cache.last_update_rebuilt());
+    REQUIRE(cache.last_update_count() == 3);
+
+    cache.update(registry);
+    REQUIRE_FALSE(cache.last_update_rebuilt());
+    REQUIRE(cache.last_update_count() == 0);
+
+    registry.get<TransformComponent>(child).position.x = 2.0f;
+    cache.update(registry);
+    REQUIRE(cache.last_update_count() == 1);
+    REQUIRE(world_position(cache, child).x == Catch::Approx(2.0f));
+
+    registry.get<TransformComponent>(root).position.y = 3.0f;
+    cache.update(registry);
+    REQUIRE(cache.last_update_count() == 2);
+    REQUIRE(world_position(cache, child).y == Catch::Approx(3.0f));
+    REQUIRE(world_position(cache, other).x == Catch::Approx(5.0f));
+}
+
+TEST_CASE("WorldTransformCache follows structural changes", "[scene][hierarchy]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    entt::registry registry;
+    const Entity parent = make_entity(registry, {4.0f, 0.0f, 0.0f});
+    const Entity child = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    REQUIRE(set_parent(registry, child, parent));
+
+    WorldTransformCache cache;
+    cache.update(registry);
+    REQUIRE(world_position(cache, child).x == Catch::Approx(5.0f));
+
+    // Reparenting is picked up without touching the transform
+    REQUIRE(set_parent(registry, child, entt::null));
+    cache.update(registry);
+    REQUIRE(cache.last_update_rebuilt());
+    REQUIRE(world_position(cache, child).x == Catch::Approx(1.0f));
+
+    // A destroyed parent leaves its child at the root
+    REQUIRE(set_parent(registry, child, parent));
+    cache.update(registry);
+    registry.destroy(parent);
+    cache.update(registry);
+    REQUIRE(cache.size() == 1);
+    REQUIRE(world_position(cache, child).x == Catch::Approx(1.0f));
+
+    // Cycles written around set_parent() are broken instead of hanging
+    const Entity a = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    const Entity b = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    registry.emplace<HierarchyComponent>(a, b);
+    registry.emplace<HierarchyComponent>(b, a);
+    cache.update(registry);
+    REQUIRE(cache.size() == 3);
+
+    Log::shutdown();
+}
+
+TEST_CASE("WorldTransformCache cuts cycles at a cycle edge", "[scene][hierarchy]") {
+    Log::init(LogLevel::Off, LogLevel::Off);
+
+    // The descendants come first in storage, so their walks reach the cycle first
+    entt::registry registry;
+    const Entity grandchild = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    const Entity child = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    const Entity a = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    const Entity b = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    const Entity c = make_entity(registry, {1.0f, 0.0f, 0.0f});
+    registry.emplace<HierarchyComponent>(grandchild, child);
+    registry.emplace<HierarchyComponent>(child, a);
+    registry.emplace<HierarchyComponent>(a, b);
+    registry.emplace<HierarchyComponent>(b, c);
+    registry.emplace<HierarchyComponent>(c, a);
+
+    WorldTransformCache cache;
+    cache.update(registry);
+    REQUIRE(cache.size() == 5);
+
+    // One cycle member becomes the root; the others and the descendants keep
+    // their parents, each one unit further along x
+    std::vector<f32> cycle_x{world_position(cache, a).x, world_position(cache, b).x,
+                             world_position(cache, c).x};
+    std::sort(cycle_x.begin(), cycle_x.end());
+    REQUIRE(cycle_x[0] == Catch::Approx(1.0f));
+    REQUIRE(cycle_x[1] == Catch::Approx(2.0f));
+    REQUIRE(cycle_x[2] == Catch::Approx(3.0f));
+    REQUIRE(world_position(cache, child).x ==
+            Catch::Approx(world_position(cache, a).x + 1.0f));
+    REQUIRE(world_position(cache, grandchild).x ==
+            Catch::Approx(world_position(cache, a).x + 2.0f));
+
+    Log::shutdown();
+}
+
+TEST_CASE("Scene keeps a world transform cache", "[scene][hierarchy]") {
+    Scene scene;
+    const Entity entity = make_entity(scene.registry(), {0.0f, 7.0f, 0.0f});
+
+    scene.update_world_transforms();
+    REQUIRE(world_position(scene.world_transforms(), entity).y == Catch::Approx(7.0f));
+    REQUIRE(scene.world_transforms().world_matrices().size() == 1);
+}
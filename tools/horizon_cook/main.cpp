@@ -0,0 +1,203 @@
+/**
+ * @file main.cpp
+ * @brief horizon_cook - offline asset cooker
+ *
+ * Imports source models (OBJ, GLTF/GLB, FBX) and writes them as cooked
+ * models next to the source, which the runtime maps instead of parsing.
+ * Compresses source images (PNG, JPG, TGA, BMP) to BC textures with a full
+ * mip chain, written as DDS next to the source:
+ *
+ *     horizon_cook [--force] [--format=auto|bc1|bc3|bc5|bc7] [--linear] <file or directory>...
+ *
+ * Directories are searched recursively. Assets whose cooked file is already
+ * up to date are skipped unless --force is given. --format=auto is BC7; cook
+ * normal maps with an explicit --format=bc5, which keeps only X and Y (the
+ * shaders rebuild Z). Color mips are filtered in linear light unless --linear
+ * says the images hold data rather than color; BC5 is always treated as data.
+ * Needs no window or GL context, so it can run on build machines.
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <engine/assets/block_compression.hpp>
+#include <engine/assets/cooked_model.hpp>
+#include <engine/assets/cooked_texture.hpp>
+#include <engine/assets/model.hpp>
+#include <engine/assets/texture.hpp>
+#include <engine/core/jobs.hpp>
+#include <engine/core/log.hpp>
+
+namespace {
+
+bool is_source_model(const std::filesystem::path& path) {
+    const std::string extension = path.extension().string();
+    return extension == ".obj" || extension == ".gltf" || extension == ".glb" ||
+           extension == ".fbx";
+}
+
+bool is_source_image(const std::filesystem::path& path) {
+    const std::string extension = path.extension().string();
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+           extension == ".tga" || extension == ".bmp";
+}
+
+void collect_assets(const std::filesystem::path& path, std::vector<std::filesystem::path>& out) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(path, error)) {
+        out.push_back(path);
+        return;
+    }
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(path, error)) {
+        if (entry.is_regular_file() &&
+            (is_source_model(entry.path()) || is_source_image(entry.path()))) {
+            out.push_back(entry.path());
+        }
+    }
+}
+
+struct TextureOptions {
+    std::optional<hz::TextureFormat> format; // Empty for auto
+    bool linear{false};
+};
+
+bool parse_format(std::string_view name, TextureOptions& options) {
+    if (name == "auto") {
+        options.format.reset();
+    } else if (name == "bc1") {
+        options.format = hz::TextureFormat::BC1;
+    } else if (name == "bc3") {
+        options.format = hz::TextureFormat::BC3;
+    } else if (name == "bc5") {
+        options.format = hz::TextureFormat::BC5;
+    } else if (name == "bc7") {
+        options.format = hz::TextureFormat::BC7;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// Recorded in the file for other tools; the runtime follows TextureParams::srgb
+hz::TextureFormat srgb_variant(hz::TextureFormat format) {
+    switch (format) {
+    case hz::TextureFormat::BC1:
+        return hz::TextureFormat::BC1_SRGB;
+    case hz::TextureFormat::BC3:
+        return hz::TextureFormat::BC3_SRGB;
+    case hz::TextureFormat::BC7:
+        return hz::TextureFormat::BC7_SRGB;
+    default:
+        return format;
+    }
+}
+
+bool cook_model(const std::filesystem::path& source) {
+    const hz::ModelData data = hz::Model::import_file(source.string());
+    if (data.meshes.empty()) {
+        HZ_LOG_ERROR("No meshes imported from {}", source.string());
+        return false;
+    }
+    const std::filesystem::path cooked = hz::cooked_model_path(source);
+    if (!hz::write_cooked_model(data, cooked)) {
+        return false;
+    }
+    HZ_LOG_INFO("Cooked {} ({} meshes)", cooked.string(), data.meshes.size());
+    return true;
+}
+
+bool cook_texture(const std::filesystem::path& source, const TextureOptions& options) {
+    // Decode from memory: Texture::decode_file would return the old cooked file
+    std::ifstream file(source, std::ios::binary | std::ios::ate);
+    if (!file) {
+        HZ_LOG_ERROR("Failed to open {}", source.string());
+        return false;
+    }
+    std::vector<unsigned char> bytes(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+    hz::TextureImage image = hz::Texture::decode_memory(bytes.data(), bytes.size());
+    if (!image.is_valid()) {
+        return false;
+    }
+    image.path = source.string();
+
+    // A file name is no evidence of content ("abnormal_rust.png"), so BC5 is opt-in
+    hz::TextureFormat format = options.format.value_or(hz::TextureFormat::BC7);
+    const bool srgb = !options.linear && format != hz::TextureFormat::BC5;
+    if (srgb) {
+        format = srgb_variant(format);
+    }
+
+    const hz::TextureImage compressed = hz::compress_texture(image, format, srgb);
+    const std::filesystem::path cooked = hz::cooked_texture_path(source);
+    if (!compressed.is_valid() || !hz::write_dds(compressed, cooked)) {
+        return false;
+    }
+    HZ_LOG_INFO("Cooked {} ({}x{}, {} mips)", cooked.string(), compressed.width,
+                compressed.height, compressed.mip_count);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    hz::Log::init(hz::LogLevel::Warn, hz::LogLevel::Info);
+
+    bool force = false;
+    bool usage_error = false;
+    TextureOptions texture_options;
+    std::vector<std::filesystem::path> assets;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--force") {
+            force = true;
+        } else if (arg == "--linear") {
+            texture_options.linear = true;
+        } else if (arg.starts_with("--format=")) {
+            if (!parse_format(arg.substr(9), texture_options)) {
+                usage_error = true;
+            }
+        } else {
+            collect_assets(arg, assets);
+        }
+    }
+    if (assets.empty() || usage_error) {
+        std::fprintf(stderr, "usage: horizon_cook [--force] [--format=auto|bc1|bc3|bc5|bc7] "
+                             "[--linear] <file or directory>...\n");
+        return 2;
+    }
+
+    // OBJ shapes import and texture blocks compress in parallel on the job system
+    hz::JobSystem::init();
+    hz::usize cooked = 0;
+    hz::usize skipped = 0;
+    hz::usize failed = 0;
+    for (const std::filesystem::path& asset : assets) {
+        std::error_code error;
+        const bool image = is_source_image(asset);
+        if (!std::filesystem::exists(asset, error)) {
+            HZ_LOG_ERROR("No such file: {}", asset.string());
+            ++failed;
+        } else if (!force && (image ? hz::is_cooked_texture_current(asset)
+                                    : hz::is_cooked_model_current(asset))) {
+            ++skipped;
+        } else if (image ? cook_texture(asset, texture_options) : cook_model(asset)) {
+            ++cooked;
+        } else {
+            ++failed;
+        }
+    }
+
+    HZ_LOG_INFO("{} cooked, {} up to date, {} failed", cooked, skipped, failed);
+    hz::JobSystem::shutdown();
+    hz::Log::shutdown();
+    return failed == 0 ? 0 : 1;
+}